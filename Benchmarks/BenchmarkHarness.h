@@ -0,0 +1,266 @@
+// © 2021 NVIDIA Corporation
+
+// Shared by "NRI_Benchmarks" and "NRI_ValidationOverhead": device setup, common resources, timing and error reporting
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "NRI.h"
+
+#include "Extensions/NRIDeviceCreation.h"
+#include "Extensions/NRIHelper.h"
+#include "Extensions/NRIStreamer.h"
+
+constexpr uint64_t UPLOAD_SIZE = 64 * 1024;
+constexpr uint32_t STREAM_CHUNK_SIZE = 256;
+constexpr uint32_t STREAMER_FRAME_SIZE = 1024; // streamed chunks per "EndStreamerFrame"
+
+struct Sample {
+    const char* workload;
+    const char* entryPoint;
+    uint32_t iterations;
+    double nsPerOp;
+    uint64_t bytesPerOp; // "0" if not a throughput test
+};
+
+struct Interface
+    : public nri::CoreInterface,
+      public nri::HelperInterface,
+      public nri::StreamerInterface {
+};
+
+struct Bench {
+    Interface NRI = {};
+    nri::Device* device = nullptr;
+    nri::Queue* queue = nullptr;
+    nri::CommandAllocator* commandAllocator = nullptr;
+    nri::CommandBuffer* commandBuffer = nullptr;
+    nri::Fence* fence = nullptr;
+    nri::Buffer* buffer = nullptr;
+    nri::Buffer* uploadBuffer = nullptr;
+    nri::Texture* texture = nullptr;
+    nri::Descriptor* colorAttachment = nullptr;
+    nri::Descriptor* shaderResource = nullptr;
+    nri::PipelineLayout* pipelineLayout = nullptr;
+    nri::DescriptorPool* descriptorPool = nullptr;
+    nri::DescriptorSet* descriptorSets[2] = {};
+    nri::Streamer* streamer = nullptr;
+    std::vector<Sample> samples;
+    uint64_t fenceValue = 0;
+    uint32_t iterations = 0;
+};
+
+inline uint32_t g_ErrorNum = 0;   // reported by NRI
+inline uint32_t g_FailureNum = 0; // failed calls in measured loops
+
+inline void NRI_CALL MessageCallback(nri::Message messageType, const char* file, uint32_t line, const char* message, void*) {
+    if (messageType != nri::Message::ERROR)
+        return;
+
+    // Report a few, but keep going: a benchmark must not be aborted by validation
+    if (g_ErrorNum++ < 8)
+        fprintf(stderr, "ERROR: %s (%s:%u)\n", message, file, line);
+}
+
+inline void NRI_CALL AbortExecution(void*) {
+}
+
+// Must wrap calls returning "Result" in measured loops
+inline void Check(nri::Result result) {
+    if (result != nri::Result::SUCCESS)
+        g_FailureNum++;
+}
+
+template <typename F>
+inline void Measure(Bench& bench, const char* workload, const char* entryPoint, uint32_t iterations, uint64_t bytesPerOp, F&& f) {
+    uint32_t failureNum = g_FailureNum;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+        f(i);
+    auto end = std::chrono::steady_clock::now();
+
+    // Timings of failed calls are meaningless, and following calls would operate on NULL objects
+    if (g_FailureNum != failureNum) {
+        fprintf(stderr, "ERROR: '%s' failed %u time(s), the sample is skipped\n", entryPoint, g_FailureNum - failureNum);
+        return;
+    }
+
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    bench.samples.push_back({workload, entryPoint, iterations, ns / iterations, bytesPerOp});
+}
+
+inline const Sample* FindSample(const std::vector<Sample>& samples, const Sample& sample) {
+    for (const Sample& s : samples) {
+        if (!strcmp(s.workload, sample.workload) && !strcmp(s.entryPoint, sample.entryPoint))
+            return &s;
+    }
+
+    return nullptr;
+}
+
+inline uint32_t Scaled(const Bench& bench, uint32_t divisor) {
+    return std::max(bench.iterations / divisor, 1u);
+}
+
+inline void BeginRecording(Bench& bench) {
+    bench.NRI.ResetCommandAllocator(*bench.commandAllocator);
+    Check(bench.NRI.BeginCommandBuffer(*bench.commandBuffer, bench.descriptorPool));
+}
+
+inline void EndRecording(Bench& bench) {
+    Check(bench.NRI.EndCommandBuffer(*bench.commandBuffer));
+}
+
+inline bool CreateResources(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+    nri::Device& device = *bench.device;
+
+    if (NRI.GetQueue(device, nri::QueueType::GRAPHICS, 0, bench.queue) != nri::Result::SUCCESS)
+        return false;
+
+    if (NRI.CreateCommandAllocator(*bench.queue, bench.commandAllocator) != nri::Result::SUCCESS)
+        return false;
+
+    if (NRI.CreateCommandBuffer(*bench.commandAllocator, bench.commandBuffer) != nri::Result::SUCCESS)
+        return false;
+
+    if (NRI.CreateFence(device, 0, bench.fence) != nri::Result::SUCCESS)
+        return false;
+
+    nri::BufferDesc bufferDesc = {};
+    bufferDesc.size = UPLOAD_SIZE;
+    bufferDesc.usage = nri::BufferUsageBits::VERTEX_BUFFER | nri::BufferUsageBits::INDEX_BUFFER | nri::BufferUsageBits::CONSTANT_BUFFER;
+
+    if (NRI.CreateCommittedBuffer(device, nri::MemoryLocation::DEVICE, 0.0f, bufferDesc, bench.buffer) != nri::Result::SUCCESS)
+        return false;
+
+    bufferDesc.usage = nri::BufferUsageBits::NONE;
+
+    if (NRI.CreateCommittedBuffer(device, nri::MemoryLocation::HOST_UPLOAD, 0.0f, bufferDesc, bench.uploadBuffer) != nri::Result::SUCCESS)
+        return false;
+
+    nri::TextureDesc textureDesc = {};
+    textureDesc.type = nri::TextureType::TEXTURE_2D;
+    textureDesc.usage = nri::TextureUsageBits::SHADER_RESOURCE | nri::TextureUsageBits::COLOR_ATTACHMENT;
+    textureDesc.format = nri::Format::RGBA8_UNORM;
+    textureDesc.width = 256;
+    textureDesc.height = 256;
+    textureDesc.mipNum = 1;
+
+    if (NRI.CreateCommittedTexture(device, nri::MemoryLocation::DEVICE, 0.0f, textureDesc, bench.texture) != nri::Result::SUCCESS)
+        return false;
+
+    nri::TextureViewDesc textureViewDesc = {};
+    textureViewDesc.texture = bench.texture;
+    textureViewDesc.type = nri::TextureView::COLOR_ATTACHMENT;
+    textureViewDesc.format = textureDesc.format;
+
+    if (NRI.CreateTextureView(textureViewDesc, bench.colorAttachment) != nri::Result::SUCCESS)
+        return false;
+
+    textureViewDesc.type = nri::TextureView::TEXTURE;
+
+    if (NRI.CreateTextureView(textureViewDesc, bench.shaderResource) != nri::Result::SUCCESS)
+        return false;
+
+    nri::DescriptorRangeDesc rangeDesc = {0, 1, nri::DescriptorType::TEXTURE, nri::StageBits::ALL};
+    nri::DescriptorSetDesc setDesc = {0, &rangeDesc, 1};
+    nri::RootConstantDesc rootConstantDesc = {1, 16, nri::StageBits::ALL};
+
+    nri::PipelineLayoutDesc pipelineLayoutDesc = {};
+    pipelineLayoutDesc.rootConstants = &rootConstantDesc;
+    pipelineLayoutDesc.rootConstantNum = 1;
+    pipelineLayoutDesc.descriptorSets = &setDesc;
+    pipelineLayoutDesc.descriptorSetNum = 1;
+    pipelineLayoutDesc.shaderStages = nri::StageBits::GRAPHICS_SHADERS;
+
+    if (NRI.CreatePipelineLayout(device, pipelineLayoutDesc, bench.pipelineLayout) != nri::Result::SUCCESS)
+        return false;
+
+    nri::DescriptorPoolDesc descriptorPoolDesc = {};
+    descriptorPoolDesc.descriptorSetMaxNum = 2;
+    descriptorPoolDesc.textureMaxNum = 2;
+
+    if (NRI.CreateDescriptorPool(device, descriptorPoolDesc, bench.descriptorPool) != nri::Result::SUCCESS)
+        return false;
+
+    if (NRI.AllocateDescriptorSets(*bench.descriptorPool, *bench.pipelineLayout, 0, bench.descriptorSets, 2, 0) != nri::Result::SUCCESS)
+        return false;
+
+    // Optional
+    nri::StreamerDesc streamerDesc = {};
+    streamerDesc.constantBufferMemoryLocation = nri::MemoryLocation::HOST_UPLOAD;
+    streamerDesc.constantBufferSize = STREAM_CHUNK_SIZE * STREAMER_FRAME_SIZE * 4;
+    streamerDesc.dynamicBufferMemoryLocation = nri::MemoryLocation::HOST_UPLOAD;
+    streamerDesc.dynamicBufferDesc = {0, 0, nri::BufferUsageBits::VERTEX_BUFFER | nri::BufferUsageBits::INDEX_BUFFER};
+    streamerDesc.queuedFrameNum = 2;
+
+    if (NRI.CreateStreamer(device, streamerDesc, bench.streamer) != nri::Result::SUCCESS)
+        bench.streamer = nullptr;
+
+    return true;
+}
+
+inline void DestroyResources(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+
+    if (bench.queue)
+        NRI.QueueWaitIdle(bench.queue);
+
+    if (bench.streamer)
+        NRI.DestroyStreamer(bench.streamer);
+
+    NRI.DestroyDescriptorPool(bench.descriptorPool);
+    NRI.DestroyPipelineLayout(bench.pipelineLayout);
+    NRI.DestroyDescriptor(bench.shaderResource);
+    NRI.DestroyDescriptor(bench.colorAttachment);
+    NRI.DestroyTexture(bench.texture);
+    NRI.DestroyBuffer(bench.uploadBuffer);
+    NRI.DestroyBuffer(bench.buffer);
+    NRI.DestroyFence(bench.fence);
+    NRI.DestroyCommandBuffer(bench.commandBuffer);
+    NRI.DestroyCommandAllocator(bench.commandAllocator);
+}
+
+// NONE runs in host emulation mode: uploads and submissions do real work, and the validation layer wraps real objects
+inline bool CreateBench(nri::GraphicsAPI graphicsAPI, bool enableNRIValidation, uint32_t iterations, Bench& bench) {
+    nri::DeviceCreationDesc deviceCreationDesc = {};
+    deviceCreationDesc.graphicsAPI = graphicsAPI;
+    deviceCreationDesc.enableNRIValidation = enableNRIValidation;
+    deviceCreationDesc.enableNONEHostEmulation = true;
+    deviceCreationDesc.callbackInterface.MessageCallback = MessageCallback;
+    deviceCreationDesc.callbackInterface.AbortExecution = AbortExecution;
+
+    bench.iterations = iterations;
+
+    if (nriCreateDevice(deviceCreationDesc, bench.device) != nri::Result::SUCCESS) {
+        bench.device = nullptr;
+        return false;
+    }
+
+    Interface& NRI = bench.NRI;
+    bool isOk = nriGetInterface(*bench.device, NRI_INTERFACE(nri::CoreInterface), (nri::CoreInterface*)&NRI) == nri::Result::SUCCESS;
+    isOk = isOk && nriGetInterface(*bench.device, NRI_INTERFACE(nri::HelperInterface), (nri::HelperInterface*)&NRI) == nri::Result::SUCCESS;
+    isOk = isOk && nriGetInterface(*bench.device, NRI_INTERFACE(nri::StreamerInterface), (nri::StreamerInterface*)&NRI) == nri::Result::SUCCESS;
+
+    return isOk && CreateResources(bench);
+}
+
+inline void DestroyBench(Bench& bench) {
+    if (!bench.device)
+        return;
+
+    // Interfaces may be missing if "CreateBench" failed early
+    if (bench.NRI.DestroyCommandAllocator)
+        DestroyResources(bench);
+
+    nriDestroyDevice(bench.device);
+    bench.device = nullptr;
+}
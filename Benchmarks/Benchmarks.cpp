@@ -0,0 +1,513 @@
+// © 2021 NVIDIA Corporation
+
+// Microbenchmarks for Core, Helper and Streamer entry points, meant to be tracked over releases.
+// Creation, recording, descriptor, submission and streaming workloads run on NONE (host emulation) and VK. For stable VK numbers
+// use a software ICD, i.e. point "VK_ICD_FILENAMES" to lavapipe or SwiftShader. Results are printed and saved as JSON.
+// Usage: NRI_Benchmarks [--iterations N] [--api NONE|VK] [--json <file>]
+
+#include <string>
+
+#include "BenchmarkHarness.h"
+
+constexpr uint32_t SCHEMA_VERSION = 1;
+constexpr uint32_t RECORDER_THREAD_NUM = 4;
+constexpr uint32_t RECORDER_QUEUED_FRAME_NUM = 2;
+
+struct Result {
+    const char* api;
+    std::string adapter;
+    std::vector<Sample> samples;
+    bool isAvailable;
+};
+
+static void SubmitAndWait(Bench& bench, bool withCommandBuffer) {
+    nri::FenceSubmitDesc signal = {bench.fence, ++bench.fenceValue};
+
+    nri::QueueSubmitDesc queueSubmitDesc = {};
+    queueSubmitDesc.commandBuffers = &bench.commandBuffer;
+    queueSubmitDesc.commandBufferNum = withCommandBuffer ? 1 : 0;
+    queueSubmitDesc.signalFences = &signal;
+    queueSubmitDesc.signalFenceNum = 1;
+
+    Check(bench.NRI.QueueSubmit(*bench.queue, queueSubmitDesc));
+    bench.NRI.Wait(*bench.fence, bench.fenceValue);
+}
+
+static void Creation(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+
+    // Creation is much slower than recording, and it's not worth exhausting device memory
+    uint32_t iterations = Scaled(bench, 100);
+
+    std::vector<nri::Buffer*> buffers(iterations);
+    nri::BufferDesc bufferDesc = {};
+    bufferDesc.size = 4096;
+    bufferDesc.usage = nri::BufferUsageBits::CONSTANT_BUFFER;
+
+    Measure(bench, "creation", "CreateCommittedBuffer", iterations, 0, [&](uint32_t i) {
+        Check(NRI.CreateCommittedBuffer(*bench.device, nri::MemoryLocation::DEVICE, 0.0f, bufferDesc, buffers[i]));
+    });
+
+    Measure(bench, "creation", "DestroyBuffer", iterations, 0, [&](uint32_t i) {
+        NRI.DestroyBuffer(buffers[i]);
+    });
+
+    std::vector<nri::Texture*> textures(iterations);
+    nri::TextureDesc textureDesc = {};
+    textureDesc.type = nri::TextureType::TEXTURE_2D;
+    textureDesc.usage = nri::TextureUsageBits::SHADER_RESOURCE;
+    textureDesc.format = nri::Format::RGBA8_UNORM;
+    textureDesc.width = 64;
+    textureDesc.height = 64;
+    textureDesc.mipNum = 1;
+
+    Measure(bench, "creation", "CreateCommittedTexture", iterations, 0, [&](uint32_t i) {
+        Check(NRI.CreateCommittedTexture(*bench.device, nri::MemoryLocation::DEVICE, 0.0f, textureDesc, textures[i]));
+    });
+
+    Measure(bench, "creation", "DestroyTexture", iterations, 0, [&](uint32_t i) {
+        NRI.DestroyTexture(textures[i]);
+    });
+
+    std::vector<nri::Descriptor*> descriptors(iterations);
+    nri::TextureViewDesc textureViewDesc = {};
+    textureViewDesc.texture = bench.texture;
+    textureViewDesc.type = nri::TextureView::TEXTURE;
+    textureViewDesc.format = nri::Format::RGBA8_UNORM;
+
+    Measure(bench, "creation", "CreateTextureView", iterations, 0, [&](uint32_t i) {
+        Check(NRI.CreateTextureView(textureViewDesc, descriptors[i]));
+    });
+
+    Measure(bench, "creation", "DestroyDescriptor (view)", iterations, 0, [&](uint32_t i) {
+        NRI.DestroyDescriptor(descriptors[i]);
+    });
+
+    nri::SamplerDesc samplerDesc = {};
+    samplerDesc.filters = {nri::Filter::LINEAR, nri::Filter::LINEAR, nri::Filter::LINEAR};
+    samplerDesc.mipMax = 16.0f;
+
+    Measure(bench, "creation", "CreateSampler", iterations, 0, [&](uint32_t i) {
+        Check(NRI.CreateSampler(*bench.device, samplerDesc, descriptors[i]));
+    });
+
+    Measure(bench, "creation", "DestroyDescriptor (sampler)", iterations, 0, [&](uint32_t i) {
+        NRI.DestroyDescriptor(descriptors[i]);
+    });
+
+    std::vector<nri::Fence*> fences(iterations);
+
+    Measure(bench, "creation", "CreateFence", iterations, 0, [&](uint32_t i) {
+        Check(NRI.CreateFence(*bench.device, 0, fences[i]));
+    });
+
+    Measure(bench, "creation", "DestroyFence", iterations, 0, [&](uint32_t i) {
+        NRI.DestroyFence(fences[i]);
+    });
+}
+
+static void Recording(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+    nri::CommandBuffer& commandBuffer = *bench.commandBuffer;
+
+    Measure(bench, "recording", "BeginCommandBuffer + EndCommandBuffer", Scaled(bench, 100), 0, [&](uint32_t) {
+        BeginRecording(bench);
+        EndRecording(bench);
+    });
+
+    BeginRecording(bench);
+    {
+        // Ping-pong between 2 states to keep every barrier meaningful
+        const nri::AccessStage bufferStates[] = {
+            {nri::AccessBits::COPY_DESTINATION, nri::StageBits::COPY},
+            {nri::AccessBits::CONSTANT_BUFFER, nri::StageBits::ALL_SHADERS},
+        };
+
+        nri::BufferBarrierDesc bufferBarrier = {};
+        bufferBarrier.buffer = bench.buffer;
+
+        nri::BarrierDesc bufferBarrierDesc = {};
+        bufferBarrierDesc.buffers = &bufferBarrier;
+        bufferBarrierDesc.bufferNum = 1;
+
+        Measure(bench, "recording", "CmdBarrier (buffer)", bench.iterations, 0, [&](uint32_t i) {
+            bufferBarrier.before = bufferStates[i & 0x1];
+            bufferBarrier.after = bufferStates[(i + 1) & 0x1];
+
+            NRI.CmdBarrier(commandBuffer, bufferBarrierDesc);
+        });
+
+        const nri::AccessLayoutStage textureStates[] = {
+            {nri::AccessBits::COLOR_ATTACHMENT, nri::Layout::COLOR_ATTACHMENT, nri::StageBits::COLOR_ATTACHMENT},
+            {nri::AccessBits::SHADER_RESOURCE, nri::Layout::SHADER_RESOURCE, nri::StageBits::FRAGMENT_SHADER},
+        };
+
+        nri::TextureBarrierDesc textureBarrier = {};
+        textureBarrier.texture = bench.texture;
+
+        nri::BarrierDesc textureBarrierDesc = {};
+        textureBarrierDesc.textures = &textureBarrier;
+        textureBarrierDesc.textureNum = 1;
+
+        Measure(bench, "recording", "CmdBarrier (texture)", bench.iterations, 0, [&](uint32_t i) {
+            textureBarrier.before = textureStates[i & 0x1];
+            textureBarrier.after = textureStates[(i + 1) & 0x1];
+
+            NRI.CmdBarrier(commandBuffer, textureBarrierDesc);
+        });
+
+        Measure(bench, "recording", "CmdCopyBuffer", bench.iterations, 0, [&](uint32_t) {
+            NRI.CmdCopyBuffer(commandBuffer, *bench.buffer, 0, *bench.uploadBuffer, 0, 256);
+        });
+
+        Measure(bench, "recording", "CmdZeroBuffer", bench.iterations, 0, [&](uint32_t) {
+            NRI.CmdZeroBuffer(commandBuffer, *bench.buffer, 0, 256);
+        });
+
+        Measure(bench, "recording", "CmdSetPipelineLayout", bench.iterations, 0, [&](uint32_t) {
+            NRI.CmdSetPipelineLayout(commandBuffer, nri::BindPoint::GRAPHICS, *bench.pipelineLayout);
+        });
+
+        nri::SetDescriptorSetDesc setDesc = {};
+        setDesc.descriptorSet = bench.descriptorSets[0];
+
+        Measure(bench, "recording", "CmdSetDescriptorSet", bench.iterations, 0, [&](uint32_t) {
+            NRI.CmdSetDescriptorSet(commandBuffer, setDesc);
+        });
+
+        const uint32_t constants[4] = {};
+
+        nri::SetRootConstantsDesc rootConstantsDesc = {};
+        rootConstantsDesc.data = constants;
+        rootConstantsDesc.size = sizeof(constants);
+
+        Measure(bench, "recording", "CmdSetRootConstants", bench.iterations, 0, [&](uint32_t) {
+            NRI.CmdSetRootConstants(commandBuffer, rootConstantsDesc);
+        });
+
+        nri::AttachmentDesc color = {};
+        color.descriptor = bench.colorAttachment;
+        color.loadOp = nri::LoadOp::CLEAR;
+        color.storeOp = nri::StoreOp::STORE;
+
+        nri::RenderingDesc renderingDesc = {};
+        renderingDesc.colors = &color;
+        renderingDesc.colorNum = 1;
+
+        NRI.CmdBeginRendering(commandBuffer, renderingDesc);
+        {
+            const nri::Viewport viewport = {0.0f, 0.0f, 256.0f, 256.0f, 0.0f, 1.0f};
+            Measure(bench, "recording", "CmdSetViewports", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdSetViewports(commandBuffer, &viewport, 1);
+            });
+
+            const nri::Rect scissor = {0, 0, 256, 256};
+            Measure(bench, "recording", "CmdSetScissors", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdSetScissors(commandBuffer, &scissor, 1);
+            });
+
+            const nri::VertexBufferDesc vertexBufferDesc = {bench.buffer, 0, 16};
+            Measure(bench, "recording", "CmdSetVertexBuffers", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdSetVertexBuffers(commandBuffer, 0, &vertexBufferDesc, 1);
+            });
+
+            Measure(bench, "recording", "CmdSetIndexBuffer", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdSetIndexBuffer(commandBuffer, *bench.buffer, 0, nri::IndexType::UINT16);
+            });
+
+            const nri::DrawDesc drawDesc = {3, 1, 0, 0};
+            Measure(bench, "recording", "CmdDraw", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdDraw(commandBuffer, drawDesc);
+            });
+
+            const nri::DrawIndexedDesc drawIndexedDesc = {3, 1, 0, 0, 0};
+            Measure(bench, "recording", "CmdDrawIndexed", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdDrawIndexed(commandBuffer, drawIndexedDesc);
+            });
+        }
+        NRI.CmdEndRendering(commandBuffer);
+    }
+    EndRecording(bench);
+}
+
+static void Descriptors(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+
+    nri::UpdateDescriptorRangeDesc updateDesc = {};
+    updateDesc.descriptorSet = bench.descriptorSets[0];
+    updateDesc.descriptors = &bench.shaderResource;
+    updateDesc.descriptorNum = 1;
+
+    Measure(bench, "descriptor", "UpdateDescriptorRanges", bench.iterations, 0, [&](uint32_t) {
+        NRI.UpdateDescriptorRanges(&updateDesc, 1);
+    });
+
+    nri::CopyDescriptorRangeDesc copyDesc = {};
+    copyDesc.dstDescriptorSet = bench.descriptorSets[1];
+    copyDesc.srcDescriptorSet = bench.descriptorSets[0];
+    copyDesc.descriptorNum = 1;
+
+    Measure(bench, "descriptor", "CopyDescriptorRanges", bench.iterations, 0, [&](uint32_t) {
+        NRI.CopyDescriptorRanges(&copyDesc, 1);
+    });
+
+    // A dedicated pool, since "ResetDescriptorPool" wipes out all sets
+    nri::DescriptorPoolDesc descriptorPoolDesc = {};
+    descriptorPoolDesc.descriptorSetMaxNum = 1;
+    descriptorPoolDesc.textureMaxNum = 1;
+
+    nri::DescriptorPool* descriptorPool = nullptr;
+    if (NRI.CreateDescriptorPool(*bench.device, descriptorPoolDesc, descriptorPool) == nri::Result::SUCCESS) {
+        Measure(bench, "descriptor", "AllocateDescriptorSets + ResetDescriptorPool", Scaled(bench, 10), 0, [&](uint32_t) {
+            nri::DescriptorSet* descriptorSet = nullptr;
+            Check(NRI.AllocateDescriptorSets(*descriptorPool, *bench.pipelineLayout, 0, &descriptorSet, 1, 0));
+            NRI.ResetDescriptorPool(*descriptorPool);
+        });
+
+        NRI.DestroyDescriptorPool(descriptorPool);
+    }
+}
+
+static void Submission(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+
+    // Queue operations can't be batched without waiting, use fewer iterations
+    uint32_t iterations = Scaled(bench, 100);
+
+    // Fence only submits: no waiting in between, since no command buffer can be in flight twice
+    nri::FenceSubmitDesc signal = {bench.fence, 0};
+
+    nri::QueueSubmitDesc queueSubmitDesc = {};
+    queueSubmitDesc.signalFences = &signal;
+    queueSubmitDesc.signalFenceNum = 1;
+
+    Measure(bench, "submission", "QueueSubmit (fence only)", iterations, 0, [&](uint32_t) {
+        signal.value = ++bench.fenceValue;
+        Check(NRI.QueueSubmit(*bench.queue, queueSubmitDesc));
+    });
+
+    NRI.Wait(*bench.fence, bench.fenceValue);
+
+    BeginRecording(bench);
+    EndRecording(bench);
+
+    Measure(bench, "submission", "QueueSubmit + Wait", iterations, 0, [&](uint32_t) {
+        SubmitAndWait(bench, true);
+    });
+
+    Measure(bench, "submission", "QueueWaitIdle", iterations, 0, [&](uint32_t) {
+        NRI.QueueWaitIdle(bench.queue);
+    });
+
+    // A frame of the command recorder: per-thread command buffers are acquired from warm pools and submitted at once
+    nri::CommandRecorderDesc commandRecorderDesc = {};
+    commandRecorderDesc.threadNum = RECORDER_THREAD_NUM;
+    commandRecorderDesc.queuedFrameNum = RECORDER_QUEUED_FRAME_NUM;
+
+    nri::CommandRecorder* commandRecorder = nullptr;
+    if (NRI.CreateCommandRecorder(*bench.queue, commandRecorderDesc, commandRecorder) != nri::Result::SUCCESS)
+        return;
+
+    Measure(bench, "submission", "SubmitCommandRecorderFrame (4 threads)", iterations, 0, [&](uint32_t) {
+        if (bench.fenceValue >= RECORDER_QUEUED_FRAME_NUM)
+            NRI.Wait(*bench.fence, bench.fenceValue + 1 - RECORDER_QUEUED_FRAME_NUM);
+
+        NRI.BeginCommandRecorderFrame(*commandRecorder);
+
+        for (uint32_t i = 0; i < RECORDER_THREAD_NUM; i++) {
+            nri::CommandBuffer* commandBuffer = nullptr;
+            Check(NRI.AcquireCommandBuffer(*commandRecorder, i, RECORDER_THREAD_NUM - i, commandBuffer));
+            Check(NRI.BeginCommandBuffer(*commandBuffer, nullptr));
+            Check(NRI.EndCommandBuffer(*commandBuffer));
+        }
+
+        signal.value = ++bench.fenceValue;
+        Check(NRI.SubmitCommandRecorderFrame(*commandRecorder, queueSubmitDesc));
+    });
+
+    NRI.Wait(*bench.fence, bench.fenceValue);
+    NRI.DestroyCommandRecorder(commandRecorder);
+}
+
+static void Streaming(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+
+    std::vector<uint8_t> data(UPLOAD_SIZE, 0x5A);
+
+    nri::BufferUploadDesc bufferUploadDesc = {};
+    bufferUploadDesc.data = data.data();
+    bufferUploadDesc.buffer = bench.buffer;
+    bufferUploadDesc.after = {nri::AccessBits::CONSTANT_BUFFER, nri::StageBits::ALL_SHADERS};
+
+    // Each call is a full round trip (a staging copy and a submission)
+    Measure(bench, "streaming", "UploadData", Scaled(bench, 1000), UPLOAD_SIZE, [&](uint32_t) {
+        Check(NRI.UploadData(*bench.queue, nullptr, 0, &bufferUploadDesc, 1));
+    });
+
+    Measure(bench, "streaming", "MapBuffer + UnmapBuffer", bench.iterations, 0, [&](uint32_t) {
+        NRI.MapBuffer(*bench.uploadBuffer, 0, nri::WHOLE_SIZE);
+        NRI.UnmapBuffer(*bench.uploadBuffer);
+    });
+
+    if (!bench.streamer)
+        return;
+
+    // Frames are committed periodically to recycle the ring buffers, the cost is amortized
+    Measure(bench, "streaming", "StreamConstantData", bench.iterations, STREAM_CHUNK_SIZE, [&](uint32_t i) {
+        NRI.StreamConstantData(*bench.streamer, data.data(), STREAM_CHUNK_SIZE);
+
+        if (i % STREAMER_FRAME_SIZE == STREAMER_FRAME_SIZE - 1)
+            NRI.EndStreamerFrame(*bench.streamer);
+    });
+
+    nri::DataSize dataChunk = {data.data(), STREAM_CHUNK_SIZE};
+
+    nri::StreamBufferDataDesc streamBufferDataDesc = {};
+    streamBufferDataDesc.dataChunks = &dataChunk;
+    streamBufferDataDesc.dataChunkNum = 1;
+    streamBufferDataDesc.placementAlignment = 16;
+
+    Measure(bench, "streaming", "StreamBufferData", bench.iterations, STREAM_CHUNK_SIZE, [&](uint32_t i) {
+        NRI.StreamBufferData(*bench.streamer, streamBufferDataDesc);
+
+        if (i % STREAMER_FRAME_SIZE == STREAMER_FRAME_SIZE - 1)
+            NRI.EndStreamerFrame(*bench.streamer);
+    });
+
+    NRI.EndStreamerFrame(*bench.streamer);
+}
+
+static bool Run(nri::GraphicsAPI graphicsAPI, uint32_t iterations, Result& result) {
+    Bench bench;
+    bool isOk = CreateBench(graphicsAPI, false, iterations, bench);
+
+    if (isOk) {
+        result.adapter = bench.NRI.GetDeviceDesc(*bench.device).adapterDesc.name;
+
+        Creation(bench);
+        Recording(bench);
+        Descriptors(bench);
+        Submission(bench);
+        Streaming(bench);
+
+        result.samples = std::move(bench.samples);
+    }
+
+    DestroyBench(bench);
+
+    return isOk;
+}
+
+static void WriteJsonString(FILE* file, const char* s) {
+    fputc('"', file);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\')
+            fprintf(file, "\\%c", *s);
+        else if ((uint8_t)*s < 0x20)
+            fprintf(file, "\\u%04x", (uint8_t)*s);
+        else
+            fputc(*s, file);
+    }
+    fputc('"', file);
+}
+
+static bool WriteJson(const char* fileName, const std::vector<Result>& results, uint32_t iterations) {
+    FILE* file = strcmp(fileName, "-") ? fopen(fileName, "w") : stdout;
+    if (!file)
+        return false;
+
+    fprintf(file, "{\n  \"version\": %u,\n  \"iterations\": %u,\n  \"backends\": [", SCHEMA_VERSION, iterations);
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+
+        fprintf(file, "%s\n    {\n      \"api\": ", i ? "," : "");
+        WriteJsonString(file, result.api);
+        fprintf(file, ",\n      \"available\": %s,\n      \"adapter\": ", result.isAvailable ? "true" : "false");
+        WriteJsonString(file, result.adapter.c_str());
+        fprintf(file, ",\n      \"results\": [");
+
+        for (size_t j = 0; j < result.samples.size(); j++) {
+            const Sample& sample = result.samples[j];
+            double bytesPerSec = sample.bytesPerOp ? sample.bytesPerOp * 1e9 / sample.nsPerOp : 0.0;
+
+            fprintf(file, "%s\n        {\"workload\": ", j ? "," : "");
+            WriteJsonString(file, sample.workload);
+            fprintf(file, ", \"name\": ");
+            WriteJsonString(file, sample.entryPoint);
+            fprintf(file, ", \"iterations\": %u, \"nsPerOp\": %.3f, \"bytesPerSec\": %.0f}", sample.iterations, sample.nsPerOp, bytesPerSec);
+        }
+
+        fprintf(file, "%s]\n    }", result.samples.empty() ? "" : "\n      ");
+    }
+
+    fprintf(file, "\n  ]\n}\n");
+
+    if (file != stdout)
+        fclose(file);
+
+    return true;
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = 100000;
+    const char* api = nullptr;
+    const char* jsonFileName = "NRI_Benchmarks.json";
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--iterations") && i + 1 < argc)
+            iterations = std::max((uint32_t)atoi(argv[++i]), 1u);
+        else if (!strcmp(argv[i], "--api") && i + 1 < argc)
+            api = argv[++i];
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc)
+            jsonFileName = argv[++i];
+        else {
+            printf("Usage: NRI_Benchmarks [--iterations N] [--api NONE|VK] [--json <file>] (\"-\" for stdout)\n");
+            return 1;
+        }
+    }
+
+    const std::pair<nri::GraphicsAPI, const char*> configs[] = {
+        {nri::GraphicsAPI::NONE, "NONE"},
+        {nri::GraphicsAPI::VK, "VK"},
+    };
+
+    // Human readable output goes to "stderr" if JSON is printed to "stdout"
+    FILE* out = strcmp(jsonFileName, "-") ? stdout : stderr;
+
+    std::vector<Result> results;
+    for (const auto& config : configs) {
+        if (api && strcmp(api, config.second))
+            continue;
+
+        Result result = {config.second, "", {}, false};
+        result.isAvailable = Run(config.first, iterations, result);
+
+        fprintf(out, "%s (%u iterations):\n", config.second, iterations);
+        if (!result.isAvailable)
+            fprintf(out, "  unavailable\n\n");
+        else {
+            fprintf(out, "  Adapter: %s\n", result.adapter.c_str());
+            fprintf(out, "  %-12s %-48s %12s %12s\n", "Workload", "Entry point", "ns/op", "MB/s");
+            for (const Sample& sample : result.samples) {
+                if (sample.bytesPerOp)
+                    fprintf(out, "  %-12s %-48s %12.1f %12.1f\n", sample.workload, sample.entryPoint, sample.nsPerOp, sample.bytesPerOp * 1e3 / sample.nsPerOp);
+                else
+                    fprintf(out, "  %-12s %-48s %12.1f %12s\n", sample.workload, sample.entryPoint, sample.nsPerOp, "-");
+            }
+            fprintf(out, "\n");
+        }
+
+        results.push_back(std::move(result));
+    }
+
+    if (!WriteJson(jsonFileName, results, iterations)) {
+        fprintf(stderr, "ERROR: can't write '%s'\n", jsonFileName);
+        return 1;
+    }
+
+    if (g_ErrorNum || g_FailureNum)
+        fprintf(out, "Errors: %u, failed calls: %u\n", g_ErrorNum, g_FailureNum);
+
+    return (g_ErrorNum || g_FailureNum) ? 1 : 0;
+}
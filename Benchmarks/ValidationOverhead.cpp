@@ -0,0 +1,263 @@
+// © 2021 NVIDIA Corporation
+
+// Measures the cost added by the embedded validation layer ("enableNRIValidation") to Core entry points.
+// Representative draw-, barrier-, descriptor- and creation-heavy streams are recorded (never submitted)
+// on NONE and VK devices, with and without validation. Usage: NRI_ValidationOverhead [iterations]
+
+#include "BenchmarkHarness.h"
+
+static void DrawHeavy(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+    nri::CommandBuffer& commandBuffer = *bench.commandBuffer;
+
+    BeginRecording(bench);
+    {
+        nri::TextureBarrierDesc textureBarrier = {};
+        textureBarrier.texture = bench.texture;
+        textureBarrier.after = {nri::AccessBits::COLOR_ATTACHMENT, nri::Layout::COLOR_ATTACHMENT, nri::StageBits::COLOR_ATTACHMENT};
+
+        nri::BarrierDesc barrierDesc = {};
+        barrierDesc.textures = &textureBarrier;
+        barrierDesc.textureNum = 1;
+
+        NRI.CmdBarrier(commandBuffer, barrierDesc);
+
+        nri::AttachmentDesc color = {};
+        color.descriptor = bench.colorAttachment;
+        color.loadOp = nri::LoadOp::CLEAR;
+        color.storeOp = nri::StoreOp::STORE;
+
+        nri::RenderingDesc renderingDesc = {};
+        renderingDesc.colors = &color;
+        renderingDesc.colorNum = 1;
+
+        NRI.CmdBeginRendering(commandBuffer, renderingDesc);
+        {
+            const nri::Viewport viewport = {0.0f, 0.0f, 256.0f, 256.0f, 0.0f, 1.0f};
+            Measure(bench, "draw", "CmdSetViewports", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdSetViewports(commandBuffer, &viewport, 1);
+            });
+
+            const nri::Rect scissor = {0, 0, 256, 256};
+            Measure(bench, "draw", "CmdSetScissors", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdSetScissors(commandBuffer, &scissor, 1);
+            });
+
+            const nri::VertexBufferDesc vertexBufferDesc = {bench.buffer, 0, 16};
+            Measure(bench, "draw", "CmdSetVertexBuffers", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdSetVertexBuffers(commandBuffer, 0, &vertexBufferDesc, 1);
+            });
+
+            Measure(bench, "draw", "CmdSetIndexBuffer", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdSetIndexBuffer(commandBuffer, *bench.buffer, 0, nri::IndexType::UINT16);
+            });
+
+            const nri::DrawDesc drawDesc = {3, 1, 0, 0};
+            Measure(bench, "draw", "CmdDraw", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdDraw(commandBuffer, drawDesc);
+            });
+
+            const nri::DrawIndexedDesc drawIndexedDesc = {3, 1, 0, 0, 0};
+            Measure(bench, "draw", "CmdDrawIndexed", bench.iterations, 0, [&](uint32_t) {
+                NRI.CmdDrawIndexed(commandBuffer, drawIndexedDesc);
+            });
+        }
+        NRI.CmdEndRendering(commandBuffer);
+    }
+    EndRecording(bench);
+}
+
+static void BarrierHeavy(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+    nri::CommandBuffer& commandBuffer = *bench.commandBuffer;
+
+    BeginRecording(bench);
+    {
+        // Ping-pong between 2 states to keep every barrier meaningful
+        const nri::AccessStage bufferStates[] = {
+            {nri::AccessBits::COPY_DESTINATION, nri::StageBits::COPY},
+            {nri::AccessBits::CONSTANT_BUFFER, nri::StageBits::ALL_SHADERS},
+        };
+
+        nri::BufferBarrierDesc bufferBarrier = {};
+        bufferBarrier.buffer = bench.buffer;
+
+        nri::BarrierDesc bufferBarrierDesc = {};
+        bufferBarrierDesc.buffers = &bufferBarrier;
+        bufferBarrierDesc.bufferNum = 1;
+
+        Measure(bench, "barrier", "CmdBarrier (buffer)", bench.iterations, 0, [&](uint32_t i) {
+            bufferBarrier.before = bufferStates[i & 0x1];
+            bufferBarrier.after = bufferStates[(i + 1) & 0x1];
+
+            NRI.CmdBarrier(commandBuffer, bufferBarrierDesc);
+        });
+
+        const nri::AccessLayoutStage textureStates[] = {
+            {nri::AccessBits::COLOR_ATTACHMENT, nri::Layout::COLOR_ATTACHMENT, nri::StageBits::COLOR_ATTACHMENT},
+            {nri::AccessBits::SHADER_RESOURCE, nri::Layout::SHADER_RESOURCE, nri::StageBits::FRAGMENT_SHADER},
+        };
+
+        nri::TextureBarrierDesc textureBarrier = {};
+        textureBarrier.texture = bench.texture;
+
+        nri::BarrierDesc textureBarrierDesc = {};
+        textureBarrierDesc.textures = &textureBarrier;
+        textureBarrierDesc.textureNum = 1;
+
+        Measure(bench, "barrier", "CmdBarrier (texture)", bench.iterations, 0, [&](uint32_t i) {
+            textureBarrier.before = textureStates[i & 0x1];
+            textureBarrier.after = textureStates[(i + 1) & 0x1];
+
+            NRI.CmdBarrier(commandBuffer, textureBarrierDesc);
+        });
+    }
+    EndRecording(bench);
+}
+
+static void DescriptorHeavy(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+    nri::CommandBuffer& commandBuffer = *bench.commandBuffer;
+
+    nri::UpdateDescriptorRangeDesc updateDesc = {};
+    updateDesc.descriptorSet = bench.descriptorSets[0];
+    updateDesc.descriptors = &bench.shaderResource;
+    updateDesc.descriptorNum = 1;
+
+    Measure(bench, "descriptor", "UpdateDescriptorRanges", bench.iterations, 0, [&](uint32_t) {
+        NRI.UpdateDescriptorRanges(&updateDesc, 1);
+    });
+
+    BeginRecording(bench);
+    {
+        Measure(bench, "descriptor", "CmdSetPipelineLayout", bench.iterations, 0, [&](uint32_t) {
+            NRI.CmdSetPipelineLayout(commandBuffer, nri::BindPoint::GRAPHICS, *bench.pipelineLayout);
+        });
+
+        nri::SetDescriptorSetDesc setDesc = {};
+        setDesc.descriptorSet = bench.descriptorSets[0];
+
+        Measure(bench, "descriptor", "CmdSetDescriptorSet", bench.iterations, 0, [&](uint32_t) {
+            NRI.CmdSetDescriptorSet(commandBuffer, setDesc);
+        });
+    }
+    EndRecording(bench);
+}
+
+static void CreationHeavy(Bench& bench) {
+    const Interface& NRI = bench.NRI;
+
+    // Creation is much slower than recording, and it's not worth exhausting device memory
+    uint32_t iterations = Scaled(bench, 100);
+
+    std::vector<nri::Buffer*> buffers(iterations);
+    nri::BufferDesc bufferDesc = {};
+    bufferDesc.size = 4096;
+    bufferDesc.usage = nri::BufferUsageBits::CONSTANT_BUFFER;
+
+    Measure(bench, "creation", "CreateCommittedBuffer", iterations, 0, [&](uint32_t i) {
+        Check(NRI.CreateCommittedBuffer(*bench.device, nri::MemoryLocation::DEVICE, 0.0f, bufferDesc, buffers[i]));
+    });
+
+    Measure(bench, "creation", "DestroyBuffer", iterations, 0, [&](uint32_t i) {
+        NRI.DestroyBuffer(buffers[i]);
+    });
+
+    std::vector<nri::Descriptor*> descriptors(iterations);
+    nri::TextureViewDesc textureViewDesc = {};
+    textureViewDesc.texture = bench.texture;
+    textureViewDesc.type = nri::TextureView::TEXTURE;
+    textureViewDesc.format = nri::Format::RGBA8_UNORM;
+
+    Measure(bench, "creation", "CreateTextureView", iterations, 0, [&](uint32_t i) {
+        Check(NRI.CreateTextureView(textureViewDesc, descriptors[i]));
+    });
+
+    Measure(bench, "creation", "DestroyDescriptor (view)", iterations, 0, [&](uint32_t i) {
+        NRI.DestroyDescriptor(descriptors[i]);
+    });
+
+    nri::SamplerDesc samplerDesc = {};
+    samplerDesc.filters = {nri::Filter::LINEAR, nri::Filter::LINEAR, nri::Filter::LINEAR};
+    samplerDesc.mipMax = 16.0f;
+
+    Measure(bench, "creation", "CreateSampler", iterations, 0, [&](uint32_t i) {
+        Check(NRI.CreateSampler(*bench.device, samplerDesc, descriptors[i]));
+    });
+
+    Measure(bench, "creation", "DestroyDescriptor (sampler)", iterations, 0, [&](uint32_t i) {
+        NRI.DestroyDescriptor(descriptors[i]);
+    });
+}
+
+static void PrintEntryPointStats(const nri::Device& device) {
+    uint32_t entryPointStatNum = 0;
+    if (nriGetEntryPointStats(device, nullptr, entryPointStatNum) != nri::Result::SUCCESS)
+        return;
+
+    std::vector<nri::EntryPointStats> entryPointStats(entryPointStatNum);
+    nriGetEntryPointStats(device, entryPointStats.data(), entryPointStatNum);
+
+    printf("  Validation layer entry point stats:\n");
+    for (const nri::EntryPointStats& stats : entryPointStats) {
+        if (stats.name)
+            printf("    %-32s %10llu calls %12.1f ns/call\n", stats.name, (unsigned long long)stats.callNum, (double)stats.timeNs / stats.callNum);
+    }
+}
+
+static bool Run(nri::GraphicsAPI graphicsAPI, bool enableNRIValidation, uint32_t iterations, std::vector<Sample>& samples) {
+    Bench bench;
+    bool isOk = CreateBench(graphicsAPI, enableNRIValidation, iterations, bench);
+
+    if (isOk) {
+        DrawHeavy(bench);
+        BarrierHeavy(bench);
+        DescriptorHeavy(bench);
+        CreationHeavy(bench);
+
+        if (enableNRIValidation)
+            PrintEntryPointStats(*bench.device);
+
+        samples = std::move(bench.samples);
+    }
+
+    DestroyBench(bench);
+
+    return isOk;
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = argc > 1 ? (uint32_t)atoi(argv[1]) : 100000;
+    if (!iterations)
+        iterations = 1;
+
+    const std::pair<nri::GraphicsAPI, const char*> configs[] = {
+        {nri::GraphicsAPI::NONE, "NONE"},
+        {nri::GraphicsAPI::VK, "VK"},
+    };
+
+    for (const auto& config : configs) {
+        printf("%s (%u iterations):\n", config.second, iterations);
+
+        std::vector<Sample> samplesNoValidation;
+        std::vector<Sample> samplesValidation;
+        if (!Run(config.first, false, iterations, samplesNoValidation) || !Run(config.first, true, iterations, samplesValidation)) {
+            printf("  unavailable\n\n");
+            continue;
+        }
+
+        printf("  %-12s %-32s %12s %12s %12s\n", "Workload", "Entry point", "ns/call", "+Val ns/call", "Added ns");
+        for (const Sample& a : samplesNoValidation) {
+            const Sample* b = FindSample(samplesValidation, a);
+            if (b)
+                printf("  %-12s %-32s %12.1f %12.1f %12.1f\n", a.workload, a.entryPoint, a.nsPerOp, b->nsPerOp, b->nsPerOp - a.nsPerOp);
+        }
+
+        printf("\n");
+    }
+
+    if (g_ErrorNum || g_FailureNum)
+        printf("Validation errors: %u, failed calls: %u\n", g_ErrorNum, g_FailureNum);
+
+    return (g_ErrorNum || g_FailureNum) ? 1 : 0;
+}
@@ -44,6 +44,14 @@ NriStruct(VKExtensions) {
     uint32_t deviceExtensionNum;
 };
 
+// Simulated GPU timing for "enableNONEHostEmulation" (all zeros: work completes immediately in "QueueSubmit")
+NriStruct(NONETimingDesc) {
+    uint32_t submitLatency;     // ns, per "QueueSubmit"
+    uint32_t drawCost;          // ns, per draw (indirect draws count as "drawNum" draws)
+    uint32_t dispatchCost;      // ns, per dispatch (including ray dispatches)
+    float copyThroughput;       // GB/s, for copied, uploaded, read back and zeroed bytes (0 - instant)
+};
+
 // A collection of queues of the same type
 NriStruct(QueueFamilyDesc) {
     NriOptional const float* queuePriorities;   // [-1; 1]: low < 0, normal = 0, high > 0 ("queueNum" entries expected)
@@ -70,12 +78,23 @@ NriStruct(DeviceCreationDesc) {
     Nri(VKBindingOffsets) vkBindingOffsets;
     NriOptional Nri(VKExtensions) vkExtensions; // to enable
 
+    // NONE specific
+    NriOptional Nri(NONETimingDesc) noneTiming; // requires "enableNONEHostEmulation"
+
+    // Capture
+    NriOptional const char* captureFileName;    // record "Core", "Helper" and "Streamer" calls into a file for "NRI_Replay" (requires "NRI_ENABLE_CAPTURE_SUPPORT")
+
     // Switches (disabled by default)
     bool enableNRIValidation;                   // embedded validation layer, checks for NRI specifics
     bool enableGraphicsAPIValidation;           // GAPI-provided validation layer
     bool enableD3D11CommandBufferEmulation;     // enable? but why? (auto-enabled if deferred contexts are not supported)
     bool enableD3D12RayTracingValidation;       // slow but useful, can only be enabled if envvar "NV_ALLOW_RAYTRACING_VALIDATION" is set to "1"
     bool enableMemoryZeroInitialization;        // page-clears are fast, but memory is not cleared by default in VK
+    bool enableNONEHostEmulation;               // NONE: objects get host memory, "MapBuffer" works and fences advance on "QueueSubmit" (CPU-only testing and profiling)
+    bool enableStatistics;                      // "NRIStatistics": per command buffer and per frame command counters, host allocation tagging (requires "NRI_ENABLE_STATISTICS_SUPPORT", ignored for NONE without host emulation)
+    bool enableHostAllocationReport;            // "EndStatisticsFrame" warns about host allocations made during the frame (requires "enableStatistics")
+    bool enableRedundantStateFiltering;         // VK: command buffers drop rebinds of already bound pipelines, descriptor sets, vertex/index buffers, viewports, scissors and depth bias (see "GetFilteredCommandNumVK")
+    bool enableBarrierBatching;                 // VK: "CmdBarrier" calls are deferred and merged into one "vkCmdPipelineBarrier2" emitted before the next command executing on the GPU
 
     // Switches (enabled by default)
     bool disableVKRayTracing;                   // to save CPU memory in some implementations
@@ -92,4 +111,16 @@ NRI_API void NRI_CALL nriDestroyDevice(NriPtr(Device) device);
 // It's global state for D3D, not needed for VK because validation is tied to the logical device
 NRI_API void NRI_CALL nriReportLiveObjects();
 
+// Cumulative per entry point statistics, gathered by the validation layer (requires "NRI_ENABLE_VALIDATION_PROFILING" and "enableNRIValidation")
+NriStruct(EntryPointStats) {
+    const char* name;   // "CoreInterface" function name, NULL if never called
+    uint64_t callNum;
+    uint64_t timeNs;    // includes time spent in the underlying implementation
+};
+
+// Entries are indexed by a function pointer slot in "CoreInterface"
+// if "entryPointStats == NULL", then "entryPointStatNum" is set to the number of entry points
+// else "entryPointStatNum" must be set to number of elements in "entryPointStats"
+NRI_API Nri(Result) NRI_CALL nriGetEntryPointStats(const NriRef(Device) device, NriPtr(EntryPointStats) entryPointStats, NonNriRef(uint32_t) entryPointStatNum);
+
 NriNamespaceEnd
@@ -0,0 +1,110 @@
+// © 2021 NVIDIA Corporation
+
+// Goal: GPU-driven rendering with pipeline switches, root constants, vertex / index buffers, draws and dispatches written into a buffer by the GPU
+// https://docs.vulkan.org/features/latest/features/proposals/VK_EXT_device_generated_commands.html
+
+#pragma once
+
+#define NRI_DEVICE_GENERATED_COMMANDS_H 1
+
+NriNamespaceBegin
+
+NriForwardStruct(IndirectCommandLayout); // the layout of a "sequence" in an argument buffer: state commands, followed by an action command
+NriForwardStruct(IndirectExecutionSet);  // a table of pipelines, which can be switched by the "EXECUTION_SET" command
+
+// An argument buffer is an array of sequences, "IndirectCommandLayoutDesc::stride" bytes each. Arguments are 4 bytes aligned
+NriEnum(IndirectCommandType, uint8_t,
+    // State (optional)
+    EXECUTION_SET,      // uint32_t: a pipeline index in "IndirectExecutionSet" (must be the first command)
+    ROOT_CONSTANTS,     // "RootConstantDesc::size" bytes for the root constant "rootConstantIndex"
+    VERTEX_BUFFER,      // "BindVertexBufferIndirectDesc" for the vertex buffer slot "vertexBufferSlot" (requires a dynamic vertex stride)
+    INDEX_BUFFER,       // "BindIndexBufferIndirectDesc"
+
+    // Action (one, must be the last command)
+    DRAW,               // "DrawDesc"
+    DRAW_INDEXED,       // "DrawIndexedDesc"
+    DRAW_MESH_TASKS,    // "DrawMeshTasksDesc" (requires "features.meshShader")
+    DISPATCH            // "DispatchDesc"
+);
+
+NriStruct(BindVertexBufferIndirectDesc) {
+    uint64_t bufferAddress;                 // see "GetBufferDeviceAddress"
+    uint32_t size;
+    uint32_t stride;
+};
+
+NriStruct(BindIndexBufferIndirectDesc) {
+    uint64_t bufferAddress;                 // see "GetBufferDeviceAddress"
+    uint32_t size;
+    uint32_t indexType;                     // "IndexType"
+};
+
+NriStruct(IndirectCommandDesc) {
+    Nri(IndirectCommandType) type;
+    uint32_t offset;                        // in a sequence
+    uint32_t rootConstantIndex;             // ROOT_CONSTANTS: an index in "rootConstants" in "pipelineLayout"
+    uint32_t vertexBufferSlot;              // VERTEX_BUFFER: "VertexStreamDesc::bindingSlot"
+};
+
+NriStruct(IndirectCommandLayoutDesc) {
+    NriOptional const NriPtr(PipelineLayout) pipelineLayout; // required for "ROOT_CONSTANTS"
+    const NriPtr(IndirectCommandDesc) commands;
+    uint32_t commandNum;
+    uint32_t stride;                        // sequence size in bytes
+    Nri(StageBits) shaderStages;            // shader stages of all pipelines executed with the layout
+    bool unorderedSequences;                // sequences can be executed in any order
+};
+
+NriStruct(IndirectExecutionSetDesc) {
+    const NriPtr(Pipeline) initialPipeline; // placed at index 0
+    uint32_t pipelineMaxNum;
+};
+
+NriStruct(IndirectCommandsPreprocessDesc) {
+    const NriPtr(IndirectCommandLayout) indirectCommandLayout;
+    NriOptional const NriPtr(IndirectExecutionSet) indirectExecutionSet; // required if "EXECUTION_SET" is used
+    NriOptional const NriPtr(Pipeline) pipeline;                          // required if "indirectExecutionSet" is not provided (the pipeline bound at execution time)
+    uint32_t sequenceMaxNum;
+};
+
+// Expectations at execution time:
+//  - pipeline layout and descriptor sets are bound, a pipeline is bound (one from "indirectExecutionSet", if provided)
+//  - "argumentBuffer" and "countBuffer" are in "AccessBits::ARGUMENT_BUFFER" and "StageBits::INDIRECT" state
+//  - the state changed by the layout commands is undefined after the command (i.e. must be set again, if needed)
+NriStruct(ExecuteIndirectCommandsDesc) {
+    const NriPtr(IndirectCommandLayout) indirectCommandLayout;
+    NriOptional const NriPtr(IndirectExecutionSet) indirectExecutionSet;
+    const NriPtr(Buffer) argumentBuffer;
+    uint64_t argumentBufferOffset;
+    uint32_t sequenceMaxNum;
+    NriOptional const NriPtr(Buffer) countBuffer;                         // sequenceNum = min(sequenceMaxNum, countBuffer[countBufferOffset])
+    uint64_t countBufferOffset;
+    NriPtr(Buffer) preprocessBuffer;                                      // "BufferUsageBits::PREPROCESS_BUFFER" (executions recorded back to back must use different ranges)
+    uint64_t preprocessBufferOffset;                                      // see "GetIndirectCommandsPreprocessBufferSize"
+};
+
+// Requires "features.deviceGeneratedCommands" (VK: "VK_EXT_device_generated_commands", NONE: host emulation doesn't decode sequences, "sequenceMaxNum" draws or dispatches are accounted in simulated timing)
+// Pipelines used in "IndirectExecutionSet" must be created with "allowIndirectBinding = true"
+// Threadsafe: yes (but an execution set must not be updated while it's being used by the GPU)
+NriStruct(DeviceGeneratedCommandsInterface) {
+    // Create
+    Nri(Result) (NRI_CALL *CreateIndirectCommandLayout)             (NriRef(Device) device, const NriRef(IndirectCommandLayoutDesc) indirectCommandLayoutDesc, NriOut NriRef(IndirectCommandLayout*) indirectCommandLayout);
+    Nri(Result) (NRI_CALL *CreateIndirectExecutionSet)              (NriRef(Device) device, const NriRef(IndirectExecutionSetDesc) indirectExecutionSetDesc, NriOut NriRef(IndirectExecutionSet*) indirectExecutionSet);
+
+    // Get
+    uint64_t    (NRI_CALL *GetIndirectCommandsPreprocessBufferSize) (const NriRef(Device) device, const NriRef(IndirectCommandsPreprocessDesc) indirectCommandsPreprocessDesc);
+
+    // Update
+    void        (NRI_CALL *UpdateIndirectExecutionSet)              (NriRef(IndirectExecutionSet) indirectExecutionSet, uint32_t baseIndex, const NriPtr(Pipeline) const* pipelines, uint32_t pipelineNum);
+
+    // Destroy
+    void        (NRI_CALL *DestroyIndirectCommandLayout)            (NriPtr(IndirectCommandLayout) indirectCommandLayout);
+    void        (NRI_CALL *DestroyIndirectExecutionSet)             (NriPtr(IndirectExecutionSet) indirectExecutionSet);
+
+    // Command buffer
+    // {
+        void    (NRI_CALL *CmdExecuteIndirectCommands)              (NriRef(CommandBuffer) commandBuffer, const NriRef(ExecuteIndirectCommandsDesc) executeIndirectCommandsDesc);
+    // }
+};
+
+NriNamespaceEnd
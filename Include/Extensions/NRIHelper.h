@@ -8,6 +8,8 @@
 
 NriNamespaceBegin
 
+NriForwardStruct(CommandRecorder);
+
 NriStruct(VideoMemoryInfo) {
     uint64_t budgetSize;    // the OS-provided video memory budget. If "usageSize" > "budgetSize", the application may incur stuttering or performance penalties
     uint64_t usageSize;     // specifies the application’s current video memory usage
@@ -42,6 +44,14 @@ NriStruct(ResourceGroupDesc) {
     uint64_t preferredMemorySize; // desired chunk size (but can be greater if a resource doesn't fit), 256 Mb if 0
 };
 
+// A ring of per-thread command allocators for parallel recording. A thread owns its "threadIndex" slot, i.e. "AcquireCommandBuffer"
+// doesn't lock and reuses command buffers of the same frame slot. Recorded command buffers are submitted at once, sorted by "sortKey".
+// "SubmitCommandRecorderFrame" can be called several times per frame, each call submits command buffers acquired since the previous one
+NriStruct(CommandRecorderDesc) {
+    uint32_t threadNum;      // max number of concurrently recording threads
+    uint32_t queuedFrameNum; // number of frames "in-flight" (usually 1-3)
+};
+
 NriStruct(FormatProps) {
     const char* name;            // format name
     Nri(Format) format;          // self
@@ -77,6 +87,13 @@ NriStruct(HelperInterface) {
 
     // Information about video memory
     Nri(Result) (NRI_CALL *QueryVideoMemoryInfo)        (const NriRef(Device) device, Nri(MemoryLocation) memoryLocation, NriOut NriRef(VideoMemoryInfo) videoMemoryInfo);
+
+    // Multi-threaded command recording
+    Nri(Result) (NRI_CALL *CreateCommandRecorder)       (NriRef(Queue) queue, const NriRef(CommandRecorderDesc) commandRecorderDesc, NriOut NriRef(CommandRecorder*) commandRecorder);
+    void        (NRI_CALL *DestroyCommandRecorder)      (NriPtr(CommandRecorder) commandRecorder);
+    void        (NRI_CALL *BeginCommandRecorderFrame)   (NriRef(CommandRecorder) commandRecorder); // resets allocators of the oldest frame slot, i.e. the frame submitted "queuedFrameNum" frames ago must be completed
+    Nri(Result) (NRI_CALL *AcquireCommandBuffer)        (NriRef(CommandRecorder) commandRecorder, uint32_t threadIndex, uint32_t sortKey, NriOut NriRef(CommandBuffer*) commandBuffer); // "threadIndex" must not be shared by concurrently recording threads
+    Nri(Result) (NRI_CALL *SubmitCommandRecorderFrame)  (NriRef(CommandRecorder) commandRecorder, const NriRef(QueueSubmitDesc) queueSubmitDesc); // all acquired command buffers must be ended, "commandBuffers" must be empty
 };
 
 // Format utilities
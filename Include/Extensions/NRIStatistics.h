@@ -0,0 +1,124 @@
+// © 2021 NVIDIA Corporation
+
+// Goal: cheap in-process command stream counters, host memory accounting and a live object census (for HUDs, performance regression gates and leak hunting)
+
+#pragma once
+
+#define NRI_STATISTICS_H 1
+
+NriNamespaceBegin
+
+NriForwardStruct(CommandBuffer);
+NriForwardStruct(Device);
+NriForwardStruct(Queue);
+
+NriStruct(CommandStats) {
+    uint64_t copyBytes;             // payload of "CmdCopyBuffer", "CmdCopyTexture", "CmdUploadBufferToTexture", "CmdReadbackTextureToBuffer" and "CmdZeroBuffer"
+    uint32_t drawNum;               // "CmdDraw", "CmdDrawIndexed", "CmdDraw(Indexed)Multi" (per draw) and "CmdDrawMeshTasks"
+    uint32_t drawIndirectNum;       // indirect draw calls (the number of draws is unknown on the host)
+    uint32_t dispatchNum;           // "CmdDispatch" and "CmdDispatchRays"
+    uint32_t dispatchIndirectNum;   // indirect dispatch calls
+    uint32_t barrierNum;            // "CmdBarrier" calls
+    uint32_t globalBarrierNum;
+    uint32_t bufferBarrierNum;
+    uint32_t textureBarrierNum;
+    uint32_t descriptorSetBindNum;  // "CmdSetDescriptorSet"
+    uint32_t rootBindNum;           // "CmdSetRootConstants" and "CmdSetRootDescriptor"
+    uint32_t pipelineLayoutBindNum; // "CmdSetPipelineLayout"
+    uint32_t pipelineBindNum;       // "CmdSetPipeline"
+    uint32_t pipelineSwitchNum;     // "CmdSetPipeline" with a pipeline different from the currently bound one
+    uint32_t renderingNum;          // "CmdBeginRendering"
+    uint32_t copyNum;               // copies, uploads, readbacks, resolves and "CmdZeroBuffer"
+    uint32_t clearNum;              // "CmdClearAttachments" and "CmdClearStorage"
+    uint32_t commandBufferNum;      // submitted command buffers (roll-ups only)
+    uint32_t submitNum;             // "QueueSubmit" calls (roll-ups only)
+};
+
+// Host allocations made through "AllocationCallbacks" (including "disable3rdPartyAllocationCallbacks = false" ones) are tagged
+// by object type or subsystem, the innermost wins (i.e. a buffer created by "Streamer" is "RESOURCE", but its bookkeeping is "STREAMER").
+// Layers bookkeeping is tagged as the layer, unless it happens inside an object type or subsystem scope
+NriEnum(AllocationTag, uint8_t,
+    DEVICE,     // devices, queues, fences, query pools and everything untagged
+    COMMAND,    // command allocators and command buffers
+    DESCRIPTOR, // descriptor pools, descriptor sets, views and samplers
+    PIPELINE,   // pipelines, pipeline layouts, indirect command layouts and indirect execution sets
+    RESOURCE,   // buffers, textures, memory, acceleration structures and micromaps
+    SWAP_CHAIN,
+    VALIDATION, // "Validation" layer bookkeeping
+    CAPTURE,    // "Capture" layer bookkeeping
+    HELPER,     // "UploadData" and "AllocateAndBindMemory"
+    STREAMER,
+    IMGUI,
+    UPSCALER
+);
+
+NriStruct(AllocationStats) {
+    uint64_t liveBytes;
+    uint64_t peakBytes;
+    uint64_t allocationNum;         // since device creation
+    uint32_t liveAllocationNum;
+    uint32_t frameAllocationNum;    // between the last two "EndStatisticsFrame" calls (heap churn in the hot path, ideally 0 in steady state)
+};
+
+NriStruct(HostMemoryStats) {
+    Nri(AllocationStats) tags[(uint32_t)NriScopedMember(AllocationTag, MAX_NUM)];
+    Nri(AllocationStats) total;     // "peakBytes" is the peak of the sum, not the sum of peaks
+};
+
+// Objects created via interfaces queried from the device (swap chain textures and objects created internally by extensions are not included)
+NriEnum(ObjectType, uint8_t,
+    COMMAND_ALLOCATOR,
+    COMMAND_BUFFER,
+    FENCE,
+    QUERY_POOL,
+    DESCRIPTOR_POOL,
+    DESCRIPTOR,
+    PIPELINE_LAYOUT,
+    PIPELINE,
+    MEMORY,
+    BUFFER,
+    TEXTURE,
+    ACCELERATION_STRUCTURE,
+    MICROMAP
+);
+
+// Bytes are approximate:
+// - host: allocated through "AllocationCallbacks" during creation
+// - device: "Memory" objects, query pools and resources owning memory (committed or placed into a VMA-backed heap, i.e. "memory = NULL"),
+//   resources placed into "Memory" objects are not counted to avoid double counting
+NriStruct(ObjectTypeStats) {
+    uint64_t hostBytes;
+    uint64_t deviceBytes;
+    uint32_t liveNum;
+};
+
+NriStruct(ObjectCensus) {
+    Nri(ObjectTypeStats) types[(uint32_t)NriScopedMember(ObjectType, MAX_NUM)];
+    Nri(ObjectTypeStats) total;
+};
+
+NriStruct(LiveObjectDesc) {
+    const NriPtr(Object) object;
+    const char* name;               // "SetDebugName", can be NULL (valid until the object is renamed or destroyed)
+    uint64_t hostBytes;
+    uint64_t deviceBytes;
+    Nri(ObjectType) type;
+};
+
+// Requires "DeviceCreationDesc::enableStatistics", otherwise the interface is unsupported and entry points are not instrumented
+// Counters are gathered for "Core", "MeshShader" and "RayTracing" commands recorded via interfaces queried from the device
+// Objects still alive at "nriDestroyDevice" are reported as warnings
+// Threadsafe: yes (but a command buffer must not be queried while it's being recorded on another thread)
+NriStruct(StatisticsInterface) {
+    void (NRI_CALL *GetCommandBufferStats)  (const NriRef(CommandBuffer) commandBuffer, NriOut NriRef(CommandStats) commandStats); // since the last "BeginCommandBuffer"
+    void (NRI_CALL *GetQueueSubmitStats)    (const NriRef(Queue) queue, NriOut NriRef(CommandStats) commandStats); // the last "QueueSubmit" to the queue
+    void (NRI_CALL *EndStatisticsFrame)     (NriRef(Device) device, NriOut NriRef(CommandStats) frameStats); // all "QueueSubmit" calls since the previous call
+    void (NRI_CALL *GetHostMemoryStats)     (const NriRef(Device) device, NriOut NriRef(HostMemoryStats) hostMemoryStats);
+    void (NRI_CALL *GetObjectCensus)        (const NriRef(Device) device, NriOut NriRef(ObjectCensus) objectCensus);
+
+    // if "liveObjectDescs == NULL", then "liveObjectDescNum" is set to the number of live objects
+    // else "liveObjectDescNum" must be set to number of elements in "liveObjectDescs" (on return it's the number of written elements)
+    void (NRI_CALL *GetLiveObjects)         (const NriRef(Device) device, NriPtr(LiveObjectDesc) liveObjectDescs, NonNriRef(uint32_t) liveObjectDescNum);
+};
+
+NriNamespaceEnd
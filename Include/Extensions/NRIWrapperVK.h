@@ -40,6 +40,8 @@ NriStruct(DeviceCreationVKDesc) {
     // Switches (disabled by default)
     bool enableNRIValidation;
     bool enableMemoryZeroInitialization;                // page-clears are fast, but memory is not cleared by default in VK
+    bool enableRedundantStateFiltering;                 // see "DeviceCreationDesc"
+    bool enableBarrierBatching;                         // see "DeviceCreationDesc"
 };
 
 NriStruct(CommandAllocatorVKDesc) {
@@ -124,6 +126,7 @@ NriStruct(WrapperVKInterface) {
     Nri(Result) (NRI_CALL *CreateAccelerationStructureVK)   (NriRef(Device) device, const NriRef(AccelerationStructureVKDesc) accelerationStructureVKDesc, NriOut NriRef(AccelerationStructure*) accelerationStructure);
 
     uint32_t    (NRI_CALL *GetQueueFamilyIndexVK)           (const NriRef(Queue) queue);
+    uint32_t    (NRI_CALL *GetFilteredCommandNumVK)         (const NriRef(CommandBuffer) commandBuffer); // dropped redundant binds since "BeginCommandBuffer" (requires "enableRedundantStateFiltering", native commands recorded in between are not tracked)
     VKHandle    (NRI_CALL *GetPhysicalDeviceVK)             (const NriRef(Device) device);
     VKHandle    (NRI_CALL *GetInstanceVK)                   (const NriRef(Device) device);
     void*       (NRI_CALL *GetInstanceProcAddrVK)           (const NriRef(Device) device);
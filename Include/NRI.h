@@ -38,8 +38,8 @@ Implicit:
 
 #pragma once
 
-#define NRI_VERSION 179
-#define NRI_VERSION_DATE "27 February 2026"
+#define NRI_VERSION 180
+#define NRI_VERSION_DATE "19 October 2026"
 
 // C/C++ compatible interface (auto-selection or via "NRI_FORCE_C" macro)
 #include "NRIDescs.h"
@@ -53,7 +53,7 @@ NriNamespaceBegin
 NRI_API Nri(Result) NRI_CALL nriGetInterface(const NriRef(Device) device, const char* interfaceName, size_t interfaceSize, void* interfacePtr);
 
 // Annotations for profiling tools: host
-// - Host annotations currently use NVTX (NVIDIA Nsight Systems)
+// - Host annotations currently use NVTX (NVIDIA Nsight Systems) and the built-in tracer (if "NRI_ENABLE_TRACE_SUPPORT")
 // - Device (command buffer and queue) annotations use GAPI or PIX (if "WinPixEventRuntime.dll" is nearby)
 // - Colorization requires PIX or NVTX
 NRI_API void NRI_CALL nriBeginAnnotation(const char* name, uint32_t bgra);  // start a named range
@@ -61,6 +61,28 @@ NRI_API void NRI_CALL nriEndAnnotation();                                   // e
 NRI_API void NRI_CALL nriAnnotation(const char* name, uint32_t bgra);       // emit a named simultaneous event
 NRI_API void NRI_CALL nriSetThreadName(const char* name);                   // assign a name to the current thread
 
+// Built-in host tracer (requires "NRI_ENABLE_TRACE_SUPPORT", otherwise "UNSUPPORTED" is returned)
+// - records host annotations and internal zones (pipeline creation, "QueueSubmit", "Streamer" copies, "Helper" uploads)
+// - output is Chrome trace JSON ("chrome://tracing" or "ui.perfetto.dev"), threads are named via "nriSetThreadName"
+// - start and stop must not be called concurrently, events emitted by other threads in the meantime are fine
+NRI_API Nri(Result) NRI_CALL nriStartTrace();                               // start a new session (events of the previous one are discarded)
+NRI_API Nri(Result) NRI_CALL nriStopTrace(const char* fileName);            // stop the session and export it ("fileName" can be NULL to discard)
+
+// Frame arena (opt-in, process-wide, must not be changed while command buffers are being recorded)
+// - transient scratch exceeding the stack budget (large barrier batches, descriptor updates...) is carved from a per-thread linear arena instead of the heap
+// - a frame boundary grows arenas to the high-water mark of the previous frames, i.e. after warm-up scratch never touches the heap
+// - after "warmUpFrameNum" boundaries heap allocations are reported via "HeapAllocationCallback" (or an assert if NULL): scratch overflows and,
+//   if "enableStatistics", any host allocation made between "BeginCommandBuffer" and "EndCommandBuffer" on the same thread
+NriStruct(FrameArenaDesc) {
+    void (NRI_CALL *HeapAllocationCallback)(size_t size, bool isScratch, void* userArg);
+    void* userArg;
+    uint64_t arenaSize;                                                     // initial size of a per-thread arena (0 - 1 MB)
+    uint32_t warmUpFrameNum;
+};
+
+NRI_API void NRI_CALL nriSetFrameArena(const NriPtr(FrameArenaDesc) frameArenaDesc); // NULL disables (memory of arenas is released on thread exit)
+NRI_API void NRI_CALL nriResetFrameArena();                                 // a frame boundary (arenas of all threads are reset lazily)
+
 // Threadsafe: yes
 NriStruct(CoreInterface) {
     // Get
@@ -79,6 +101,9 @@ NriStruct(CoreInterface) {
     // Create (doesn't assume allocation of big chunks of memory on the device, but it happens for some entities implicitly)
     Nri(Result)         (NRI_CALL *CreateCommandAllocator)          (NriRef(Queue) queue, NriOut NriRef(CommandAllocator*) commandAllocator);
     Nri(Result)         (NRI_CALL *CreateCommandBuffer)             (NriRef(CommandAllocator) commandAllocator, NriOut NriRef(CommandBuffer*) commandBuffer);
+    Nri(Result)         (NRI_CALL *CreateCommandBundle)             (NriRef(CommandAllocator) commandAllocator, const NriRef(CommandBundleDesc) commandBundleDesc, NriOut NriRef(CommandBuffer*) commandBundle); // requires "features.commandBundles", destroyed via "DestroyCommandBuffer"
+    Nri(Result)         (NRI_CALL *CreateReusableCommandBuffer)     (NriRef(CommandAllocator) commandAllocator, const NriRef(ReusableCommandBufferDesc) reusableCommandBufferDesc, NriOut NriRef(CommandBuffer*) commandBuffer); // destroyed via "DestroyCommandBuffer"
+    Nri(Result)         (NRI_CALL *CreateCommandBuffers)            (NriRef(CommandAllocator) commandAllocator, NriOut NriPtr(CommandBuffer)* commandBuffers, uint32_t commandBufferNum); // same as "CreateCommandBuffer" called "commandBufferNum" times, but batched
     Nri(Result)         (NRI_CALL *CreateFence)                     (NriRef(Device) device, uint64_t initialValue, NriOut NriRef(Fence*) fence);
     Nri(Result)         (NRI_CALL *CreateDescriptorPool)            (NriRef(Device) device, const NriRef(DescriptorPoolDesc) descriptorPoolDesc, NriOut NriRef(DescriptorPool*) descriptorPool);
     Nri(Result)         (NRI_CALL *CreatePipelineLayout)            (NriRef(Device) device, const NriRef(PipelineLayoutDesc) pipelineLayoutDesc, NriOut NriRef(PipelineLayout*) pipelineLayout);
@@ -189,6 +214,10 @@ NriStruct(CoreInterface) {
             void                (NRI_CALL *CmdDraw)                 (NriRef(CommandBuffer) commandBuffer, const NriRef(DrawDesc) drawDesc);
             void                (NRI_CALL *CmdDrawIndexed)          (NriRef(CommandBuffer) commandBuffer, const NriRef(DrawIndexedDesc) drawIndexedDesc);
 
+            // Draw multi: a batch of draws sharing the state (VK: "VK_EXT_multi_draw" for runs of draws with the same "instanceNum" and "baseInstance", otherwise a loop)
+            void                (NRI_CALL *CmdDrawMulti)            (NriRef(CommandBuffer) commandBuffer, const NriPtr(DrawDesc) drawDescs, uint32_t drawDescNum);
+            void                (NRI_CALL *CmdDrawIndexedMulti)     (NriRef(CommandBuffer) commandBuffer, const NriPtr(DrawIndexedDesc) drawIndexedDescs, uint32_t drawIndexedDescNum);
+
             // Draw indirect:
             //  - drawNum = min(drawNum, countBuffer ? countBuffer[countBufferOffset] : INF)
             //  - see "Modified draw command signatures"
@@ -197,6 +226,9 @@ NriStruct(CoreInterface) {
         // }                }
         void                (NRI_CALL *CmdEndRendering)             (NriRef(CommandBuffer) commandBuffer);
 
+        // Bundle (inside of rendering, if the bundle has attachments)
+        void                (NRI_CALL *CmdExecuteBundle)            (NriRef(CommandBuffer) commandBuffer, const NriRef(CommandBuffer) commandBundle);
+
         // Compute (outside of rendering)
         void                (NRI_CALL *CmdDispatch)                 (NriRef(CommandBuffer) commandBuffer, const NriRef(DispatchDesc) dispatchDesc);
         void                (NRI_CALL *CmdDispatchIndirect)         (NriRef(CommandBuffer) commandBuffer, const NriRef(Buffer) buffer, uint64_t offset); // buffer contains "DispatchDesc" commands
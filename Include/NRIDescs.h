@@ -538,6 +538,10 @@ NriStruct(BufferBarrierDesc) {
     NriPtr(Buffer) buffer;  // use "GetAccelerationStructureBuffer" and "GetMicromapBuffer" for related barriers
     Nri(AccessStage) before;
     Nri(AccessStage) after;
+
+    // Optional range (VK only, D3D barriers always cover the whole buffer)
+    uint64_t offset;
+    uint64_t size;          // can be "WHOLE_SIZE"
 };
 
 NriStruct(TextureBarrierDesc) {
@@ -620,7 +624,8 @@ NriBits(BufferUsageBits, uint16_t,                  // Min compatible access:
     ACCELERATION_STRUCTURE_BUILD_INPUT  = NriBit(8),    // SHADER_RESOURCE                          Read-only input in "CmdBuildAccelerationStructures" command
     ACCELERATION_STRUCTURE_STORAGE      = NriBit(9),    // ACCELERATION_STRUCTURE_READ/WRITE        (INTERNAL) acceleration structure storage
     MICROMAP_BUILD_INPUT                = NriBit(10),   // SHADER_RESOURCE                          Read-only input in "CmdBuildMicromaps" command
-    MICROMAP_STORAGE                    = NriBit(11)    // MICROMAP_READ/WRITE                      (INTERNAL) micromap storage
+    MICROMAP_STORAGE                    = NriBit(11),   // MICROMAP_READ/WRITE                      (INTERNAL) micromap storage
+    PREPROCESS_BUFFER                   = NriBit(12)    // -                                        Preprocess buffer in "CmdExecuteIndirectCommands" command
 );
 
 NriStruct(TextureDesc) {
@@ -1447,12 +1452,14 @@ NriStruct(GraphicsPipelineDesc) {
     const NriPtr(ShaderDesc) shaders;
     uint32_t shaderNum;
     NriOptional Nri(Robustness) robustness;
+    NriOptional bool allowIndirectBinding;  // allows to use the pipeline in "IndirectExecutionSet" (requires "features.deviceGeneratedCommands")
 };
 
 NriStruct(ComputePipelineDesc) {
     const NriPtr(PipelineLayout) pipelineLayout;
     Nri(ShaderDesc) shader;
     NriOptional Nri(Robustness) robustness;
+    NriOptional bool allowIndirectBinding;  // allows to use the pipeline in "IndirectExecutionSet" (requires "features.deviceGeneratedCommands")
 };
 
 #pragma endregion
@@ -1502,6 +1509,30 @@ NriStruct(RenderingDesc) {
     Nri(AttachmentDesc) stencil;                        // (optional) separation is needed for multisample resolve
     NriOptional const NriPtr(Descriptor) shadingRate;   // requires "tiers.shadingRate >= 2"
     NriOptional uint32_t viewMask;                      // if non-0, requires "viewMaxNum > 1"
+    NriOptional bool bundlesOnly;                       // the content is recorded only via "CmdExecuteBundle" (VK requirement for executing bundles)
+};
+
+// Bundle: a command buffer recorded once via regular commands and executed many times by primary command buffers ("CmdExecuteBundle")
+// - a bundle with attachments is executed inside "CmdBeginRendering/CmdEndRendering" with "bundlesOnly = true" and matching attachment formats,
+//   a bundle without attachments is executed outside of rendering
+// - a bundle doesn't inherit state: pipeline, pipeline layout, descriptor sets, vertex/index buffers and dynamic state must be set inside,
+//   after execution the state of the primary command buffer is undefined
+// - can't contain "CmdBeginRendering/CmdEndRendering", "CmdClearAttachments" and other bundles
+// - must not be re-recorded or destroyed while executing, "ResetCommandAllocator" of the parent allocator invalidates the content
+NriStruct(CommandBundleDesc) {
+    const NriPtr(Format) colorFormats;
+    uint32_t colorFormatNum;
+    Nri(Format) depthStencilFormat;
+    Nri(Sample_t) sampleNum;                            // "0" is treated as "1"
+    NriOptional uint32_t viewMask;
+};
+
+// Reusable command buffer: recorded once and submitted via "QueueSubmit" many times (until the next "BeginCommandBuffer" or "ResetCommandAllocator")
+// - a still pending command buffer can be re-submitted or re-recorded, the previous submission is waited for on the host if the API requires it (VK),
+//   unless "simultaneousUse" is set
+// - a regular command buffer is "one time submit" (VK hint), i.e. it must be re-recorded before the next submission
+NriStruct(ReusableCommandBufferDesc) {
+    bool simultaneousUse;                               // can be pending in several submissions at once (no tracking, but can be slower on some drivers)
 };
 
 #pragma endregion
@@ -1986,6 +2017,8 @@ NriStruct(DeviceDesc) {
         uint32_t swapChain                                       : 1; // NRISwapChain
         uint32_t meshShader                                      : 1; // NRIMeshShader
         uint32_t lowLatency                                      : 1; // NRILowLatency
+        uint32_t commandBundles                                  : 1; // see "CommandBundleDesc"
+        uint32_t deviceGeneratedCommands                         : 1; // NRIDeviceGeneratedCommands
 
         // Smaller
         uint32_t componentSwizzle                                : 1; // see "ComponentSwizzle" (unsupported only in D3D11)
@@ -3,6 +3,6 @@
 #define STR_HELPER(x) #x
 #define STR(x) STR_HELPER(x)
 
-#define VERSION 179
+#define VERSION 180
 
 #define VERSION_STRING STR(VERSION)
@@ -0,0 +1,114 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+// Host writes into a mapped buffer are captured as deltas against "shadow"
+struct BufferMapCapture {
+    inline BufferMapCapture(StdAllocator<uint8_t>& stdAllocator)
+        : shadow(stdAllocator) {
+    }
+
+    Vector<uint8_t> shadow; // tracked range at "MapBuffer" or the last flush
+    uint8_t* base = nullptr; // memory corresponding to buffer offset "0"
+    uint64_t offset = 0;
+    uint64_t size = 0;
+    uint32_t mapNum = 0;
+    bool isCaptured = false; // the first flush stores the whole range
+};
+
+struct IsInterfaceSupported {
+    uint32_t streamer                : 1;
+    uint32_t imgui                   : 1;
+    uint32_t lowLatency              : 1;
+    uint32_t meshShader              : 1;
+    uint32_t rayTracing              : 1;
+    uint32_t swapChain               : 1;
+    uint32_t upscaler                : 1;
+    uint32_t wrapperD3D11            : 1;
+    uint32_t wrapperD3D12            : 1;
+    uint32_t wrapperVK               : 1;
+};
+
+struct DeviceCapture final : public DeviceBase {
+    DeviceCapture(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, DeviceBase& device);
+    ~DeviceCapture();
+
+    inline Device& GetImpl() const {
+        return m_Impl;
+    }
+
+    inline const CoreInterface& GetCoreInterface() const {
+        return m_iCore;
+    }
+
+    template <typename Interface>
+    inline const Interface& GetInterfaceImpl() const {
+        return std::get<Interface>(m_InterfacesImpl);
+    }
+
+    inline Lock& GetLock() {
+        return m_Lock;
+    }
+
+    inline Vector<uint8_t>& GetRecord() {
+        return m_Record;
+    }
+
+    bool Create(const DeviceCreationDesc& desc);
+    uint32_t GetObjectID(const void* object) const;
+    uint32_t RegisterObject(const void* object);
+    void UnregisterObject(const void* object);
+    void BeginRecord(CaptureInterface interfaceIndex, uint8_t slot);
+    void EndRecord();
+    void WriteSpecial(CaptureSpecial special, const void* data, size_t size, const void* payload, uint64_t payloadSize);
+    void OnMapBuffer(const Buffer& buffer, void* data, uint64_t offset, uint64_t size);
+    void OnUnmapBuffer(const Buffer& buffer);
+    void FlushMappedBuffers();
+
+    //================================================================================================================
+    // DeviceBase
+    //================================================================================================================
+
+    const DeviceDesc& GetDesc() const override {
+        return m_Desc;
+    }
+
+    void Destruct() override;
+    Result GetEntryPointStats(EntryPointStats* entryPointStats, uint32_t& entryPointStatNum) const override;
+    Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(ImguiInterface& table) const override;
+    Result FillFunctionTable(LowLatencyInterface& table) const override;
+    Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(StreamerInterface& table) const override;
+    Result FillFunctionTable(SwapChainInterface& table) const override;
+    Result FillFunctionTable(UpscalerInterface& table) const override;
+    Result FillFunctionTable(WrapperD3D11Interface& table) const override;
+    Result FillFunctionTable(WrapperD3D12Interface& table) const override;
+    Result FillFunctionTable(WrapperVKInterface& table) const override;
+
+private:
+    void FlushMappedBuffer(const Buffer& buffer, BufferMapCapture& bufferMap);
+    void FlushStream();
+
+private:
+    Device& m_Impl;
+    DeviceDesc m_Desc = {};     // with features of not captured extensions masked out
+    CoreInterface m_iCore = {}; // captured, for helpers built on top of it
+    std::tuple<CoreInterface, HelperInterface, StreamerInterface, ImguiInterface, LowLatencyInterface, MeshShaderInterface, RayTracingInterface,
+        SwapChainInterface, UpscalerInterface, WrapperD3D11Interface, WrapperD3D12Interface, WrapperVKInterface>
+        m_InterfacesImpl = {};
+    Vector<uint8_t> m_Stream;
+    Vector<uint8_t> m_Record;
+    UnorderedMap<const void*, uint32_t> m_Objects;
+    UnorderedMap<const Buffer*, BufferMapCapture*> m_BufferMaps;
+    FILE* m_File = nullptr;
+    uint32_t m_NextObjectID = CAPTURE_DEVICE_ID + 1;
+    IsInterfaceSupported m_IsInterfaceSupported = {};
+    Lock m_Lock;
+};
+
+} // namespace nri
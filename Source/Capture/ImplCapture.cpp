@@ -0,0 +1,788 @@
+// © 2021 NVIDIA Corporation
+
+#include <cstdio> // fopen
+
+#include "SharedExternal.h"
+
+#include "StreamCapture.h"
+
+#include "DeviceCapture.h"
+#include "HelperInterface.h"
+
+using namespace nri;
+
+constexpr size_t CAPTURE_STREAM_SIZE = 4 * 1024 * 1024; // file writes are batched
+constexpr uint64_t CAPTURE_BLOCK_SIZE = 64;             // granularity of mapped memory deltas
+constexpr uint64_t CAPTURE_BUFFER_DATA_MAX_SIZE = 256 * 1024 * 1024;
+
+// Objects are not wrapped, entry points without a device argument find the device here
+static DeviceCapture* g_DeviceCapture = nullptr;
+
+DeviceBase* CreateDeviceCapture(const DeviceCreationDesc& desc, DeviceBase& device) {
+    DeviceCapture* deviceCapture = Allocate<DeviceCapture>(desc.allocationCallbacks, desc.callbackInterface, desc.allocationCallbacks, device);
+
+    // The inner device is destroyed by the wrapper
+    if (!deviceCapture->Create(desc)) {
+        Destroy(desc.allocationCallbacks, deviceCapture);
+        return nullptr;
+    }
+
+    return deviceCapture;
+}
+
+//============================================================================================================================================================================================
+#pragma region[  Writer  ]
+
+struct CaptureWriter {
+    static constexpr bool IS_READER = false;
+
+    inline CaptureWriter(DeviceCapture& device)
+        : m_Device(device)
+        , m_Record(device.GetRecord()) {
+    }
+
+    inline void SetCallFailed(bool isCallFailed) {
+        m_IsCallFailed = isCallFailed;
+    }
+
+    inline void Bytes(const void* data, size_t size) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        m_Record.insert(m_Record.end(), bytes, bytes + size);
+    }
+
+    template <typename T>
+    inline void Device(T*) {
+    }
+
+    template <typename T>
+    inline void Object(T* object) {
+        uint32_t id = GetObjectID(object);
+        Bytes(&id, sizeof(id));
+    }
+
+    template <typename T>
+    inline void Objects(T* const* objects, uint64_t num) {
+        for (uint64_t i = 0; i < num; i++)
+            Object(objects[i]);
+    }
+
+    template <typename T>
+    inline void OutObject(T* object) {
+        uint32_t id = (object && !m_IsCallFailed) ? m_Device.RegisterObject(object) : 0;
+        Bytes(&id, sizeof(id));
+    }
+
+    template <typename T>
+    inline void OutObjects(T** objects, uint64_t num) {
+        for (uint64_t i = 0; i < num; i++)
+            OutObject(objects[i]);
+    }
+
+    template <typename T>
+    inline void Array(const T* items, uint64_t num) {
+        Bytes(items, sizeof(T) * num);
+
+        for (uint64_t i = 0; i < num; i++)
+            Fixup(*this, const_cast<T&>(items[i]));
+    }
+
+    template <typename T>
+    inline void Optional(const T* item) {
+        uint8_t isPresent = item ? 1 : 0;
+        Bytes(&isPresent, sizeof(isPresent));
+
+        if (item)
+            Transfer(*this, const_cast<T&>(*item));
+    }
+
+    inline void Blob(const void* data, uint64_t size) {
+        size = data ? size : 0;
+        Bytes(&size, sizeof(size));
+        Bytes(data, (size_t)size);
+    }
+
+    inline void String(const char* string) {
+        uint32_t size = string ? (uint32_t)strlen(string) + 1 : 0;
+        Bytes(&size, sizeof(size));
+        Bytes(string, size);
+    }
+
+    inline uint64_t GetSubresourceNum(const Texture& texture) const {
+        const TextureDesc& textureDesc = m_Device.GetInterfaceImpl<CoreInterface>().GetTextureDesc(texture);
+
+        return (uint64_t)std::max(textureDesc.layerNum, (Dim_t)1) * std::max(textureDesc.mipNum, (Dim_t)1);
+    }
+
+    inline uint64_t GetBufferSize(const Buffer& buffer) const {
+        return m_Device.GetInterfaceImpl<CoreInterface>().GetBufferDesc(buffer).size;
+    }
+
+    // Mirrors "StreamTextureData": the last row of the last slice is read up to the row size
+    uint64_t GetStreamTextureDataSize(const StreamTextureDataDesc& streamTextureDataDesc) const {
+        if (!streamTextureDataDesc.data || !streamTextureDataDesc.dstTexture)
+            return 0;
+
+        const TextureDesc& textureDesc = m_Device.GetInterfaceImpl<CoreInterface>().GetTextureDesc(*streamTextureDataDesc.dstTexture);
+        const TextureRegionDesc& region = streamTextureDataDesc.dstRegion;
+        GraphicsAPI graphicsAPI = m_Device.GetDesc().graphicsAPI;
+
+        Dim_t w = region.width == WHOLE_SIZE ? GetDimension(graphicsAPI, textureDesc, 0, region.mipOffset) : region.width;
+        Dim_t h = region.height == WHOLE_SIZE ? GetDimension(graphicsAPI, textureDesc, 1, region.mipOffset) : region.height;
+        Dim_t d = region.depth == WHOLE_SIZE ? GetDimension(graphicsAPI, textureDesc, 2, region.mipOffset) : region.depth;
+        if (!w || !h || !d)
+            return 0;
+
+        uint64_t rowSize = (uint64_t)w * GetFormatProps(textureDesc.format).stride;
+
+        return (d - 1ull) * streamTextureDataDesc.dataSlicePitch + (h - 1ull) * streamTextureDataDesc.dataRowPitch + rowSize;
+    }
+
+private:
+    template <typename T>
+    uint32_t GetObjectID(T* object) {
+        if (!object)
+            return 0;
+
+        if ((const void*)object == (const void*)&m_Device)
+            return CAPTURE_DEVICE_ID;
+
+        uint32_t id = m_Device.GetObjectID(object);
+        if (id)
+            return id;
+
+        // Created outside of captured calls: buffers and textures get stand-ins, other objects stay unresolved in replay
+        id = m_Device.RegisterObject(object);
+
+        using B = std::remove_cv_t<T>;
+        if constexpr (std::is_same_v<B, Buffer>) {
+            const BufferDesc& bufferDesc = m_Device.GetInterfaceImpl<CoreInterface>().GetBufferDesc(*object);
+            m_Device.WriteSpecial(CaptureSpecial::EXTERNAL_BUFFER, &id, sizeof(id), &bufferDesc, sizeof(bufferDesc));
+        } else if constexpr (std::is_same_v<B, Texture>) {
+            const TextureDesc& textureDesc = m_Device.GetInterfaceImpl<CoreInterface>().GetTextureDesc(*object);
+            m_Device.WriteSpecial(CaptureSpecial::EXTERNAL_TEXTURE, &id, sizeof(id), &textureDesc, sizeof(textureDesc));
+        }
+
+        return id;
+    }
+
+private:
+    DeviceCapture& m_Device;
+    Vector<uint8_t>& m_Record;
+    bool m_IsCallFailed = false;
+};
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Thunks  ]
+
+template <typename T>
+inline T Unwrap(DeviceCapture& device, T arg) {
+    using B = std::remove_cv_t<std::remove_pointer_t<std::remove_reference_t<T>>>;
+
+    if constexpr (std::is_same_v<B, Device>) {
+        if constexpr (std::is_reference_v<T>)
+            return device.GetImpl();
+        else
+            return arg ? &device.GetImpl() : nullptr;
+    } else if constexpr (std::is_same_v<T, void*>)
+        return arg == (void*)&device ? (void*)&device.GetImpl() : arg;
+    else
+        return arg;
+}
+
+template <auto Member, uint8_t SLOT>
+struct CaptureThunk;
+
+template <typename Interface, typename R, typename... Args, R (NRI_CALL* Interface::*Member)(Args...), uint8_t SLOT>
+struct CaptureThunk<Member, SLOT> {
+    using Call = CaptureCall<decltype(Member)>;
+
+    static R NRI_CALL Execute(Args... args) {
+        DeviceCapture& device = *g_DeviceCapture;
+        const Interface& impl = device.GetInterfaceImpl<Interface>();
+
+        if constexpr (Call::IsDestroy()) {
+            Record<int>(device, nullptr, args...);
+            (impl.*Member)(Unwrap<Args>(device, args)...);
+        } else if constexpr (std::is_void_v<R>) {
+            (impl.*Member)(Unwrap<Args>(device, args)...);
+            Record<int>(device, nullptr, args...);
+        } else {
+            R result = (impl.*Member)(Unwrap<Args>(device, args)...);
+            Record(device, &result, args...);
+
+            return result;
+        }
+    }
+
+    template <typename T>
+    static void Record(DeviceCapture& device, T* result, Args... args) {
+        ExclusiveScope lock(device.GetLock());
+
+        device.BeginRecord(GetCaptureInterface<Interface>(), SLOT);
+        {
+            typename Call::Storage storage = {ToCaptureStorage<Args>(args)...};
+
+            // Outputs of failed calls are undefined
+            CaptureWriter writer(device);
+            if constexpr (std::is_same_v<T, Result>)
+                writer.SetCallFailed(*result != Result::SUCCESS);
+
+            TransferArgs<Args...>(writer, storage, std::index_sequence_for<Args...>{});
+
+            if (result)
+                TransferResult(writer, *result);
+
+            if constexpr (Call::IsDestroy())
+                device.UnregisterObject(std::get<0>(storage));
+        }
+        device.EndRecord();
+    }
+};
+
+// Not captured: only the device is unwrapped
+template <auto Member>
+struct PassThroughThunk;
+
+template <typename Interface, typename R, typename... Args, R (NRI_CALL* Interface::*Member)(Args...)>
+struct PassThroughThunk<Member> {
+    static R NRI_CALL Execute(Args... args) {
+        DeviceCapture& device = *g_DeviceCapture;
+
+        return (device.GetInterfaceImpl<Interface>().*Member)(Unwrap<Args>(device, args)...);
+    }
+};
+
+#define NRI_CAPTURE_THUNK(interface, name) CaptureThunk<&interface::name, NRI_CAPTURE_SLOT(interface, name)>
+
+static const DeviceDesc& NRI_CALL GetDeviceDesc(const Device& device) {
+    NRI_CAPTURE_THUNK(CoreInterface, GetDeviceDesc)::Execute(device);
+
+    return ((DeviceCapture&)device).GetDesc();
+}
+
+static void* NRI_CALL MapBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    void* data = NRI_CAPTURE_THUNK(CoreInterface, MapBuffer)::Execute(buffer, offset, size);
+    if (data)
+        g_DeviceCapture->OnMapBuffer(buffer, data, offset, size);
+
+    return data;
+}
+
+static void NRI_CALL UnmapBuffer(Buffer& buffer) {
+    g_DeviceCapture->OnUnmapBuffer(buffer);
+    NRI_CAPTURE_THUNK(CoreInterface, UnmapBuffer)::Execute(buffer);
+}
+
+static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSubmitDesc) {
+    g_DeviceCapture->FlushMappedBuffers(); // persistently mapped memory
+
+    return NRI_CAPTURE_THUNK(CoreInterface, QueueSubmit)::Execute(queue, queueSubmitDesc);
+}
+
+static Result NRI_CALL AllocateAndBindMemory(Device& device, const ResourceGroupDesc& resourceGroupDesc, Memory** allocations) {
+    DeviceCapture& deviceCapture = (DeviceCapture&)device;
+    const HelperInterface& helperInterface = deviceCapture.GetInterfaceImpl<HelperInterface>();
+
+    Result result = helperInterface.AllocateAndBindMemory(deviceCapture.GetImpl(), resourceGroupDesc, allocations);
+    if (result != Result::SUCCESS)
+        return result;
+
+    uint32_t allocationNum = helperInterface.CalculateAllocationNumber(deviceCapture.GetImpl(), resourceGroupDesc);
+
+    ExclusiveScope lock(deviceCapture.GetLock());
+
+    deviceCapture.BeginRecord(CaptureInterface::HELPER, NRI_CAPTURE_SLOT(HelperInterface, AllocateAndBindMemory));
+    {
+        ResourceGroupDesc resourceGroupDescCopy = resourceGroupDesc;
+
+        CaptureWriter writer(deviceCapture);
+        TransferAllocateAndBindMemory(writer, resourceGroupDescCopy, allocations, allocationNum);
+    }
+    deviceCapture.EndRecord();
+
+    return result;
+}
+
+// Command buffers are created and submitted via the captured "CoreInterface", i.e. the recorder itself is not a part of the stream
+static Result NRI_CALL CreateCommandRecorder(Queue& queue, const CommandRecorderDesc& commandRecorderDesc, CommandRecorder*& commandRecorder) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::COMMAND);
+
+    DeviceCapture& deviceCapture = *g_DeviceCapture;
+    CommandRecorderImpl* impl = Allocate<CommandRecorderImpl>(deviceCapture.GetAllocationCallbacks(), (Device&)deviceCapture, deviceCapture.GetCoreInterface(), queue);
+    Result result = impl ? impl->Create(commandRecorderDesc) : Result::OUT_OF_MEMORY;
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        commandRecorder = nullptr;
+    } else
+        commandRecorder = (CommandRecorder*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyCommandRecorder(CommandRecorder* commandRecorder) {
+    Destroy((CommandRecorderImpl*)commandRecorder);
+}
+
+static void NRI_CALL BeginCommandRecorderFrame(CommandRecorder& commandRecorder) {
+    ((CommandRecorderImpl&)commandRecorder).BeginFrame();
+}
+
+static Result NRI_CALL AcquireCommandBuffer(CommandRecorder& commandRecorder, uint32_t threadIndex, uint32_t sortKey, CommandBuffer*& commandBuffer) {
+    return ((CommandRecorderImpl&)commandRecorder).AcquireCommandBuffer(threadIndex, sortKey, commandBuffer);
+}
+
+static Result NRI_CALL SubmitCommandRecorderFrame(CommandRecorder& commandRecorder, const QueueSubmitDesc& queueSubmitDesc) {
+    return ((CommandRecorderImpl&)commandRecorder).Submit(queueSubmitDesc);
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DeviceCapture  ]
+
+DeviceCapture::DeviceCapture(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, DeviceBase& device)
+    : DeviceBase(callbacks, allocationCallbacks)
+    , m_Impl(*(Device*)&device)
+    , m_Stream(GetStdAllocator())
+    , m_Record(GetStdAllocator())
+    , m_Objects(GetStdAllocator())
+    , m_BufferMaps(GetStdAllocator()) {
+    // "NRIDeviceGeneratedCommands" isn't recorded into the stream, passing its calls through would silently lose them
+    m_Desc = device.GetDesc();
+    m_Desc.features.deviceGeneratedCommands = 0;
+}
+
+DeviceCapture::~DeviceCapture() {
+    if (m_File) {
+        FlushStream();
+        fclose(m_File);
+    }
+
+    for (auto& it : m_BufferMaps)
+        Destroy(GetAllocationCallbacks(), it.second);
+
+    if (g_DeviceCapture == this)
+        g_DeviceCapture = nullptr;
+
+    ((DeviceBase*)&m_Impl)->Destruct();
+}
+
+bool DeviceCapture::Create(const DeviceCreationDesc& desc) {
+    NRI_RETURN_ON_FAILURE(this, !g_DeviceCapture, false, "Only one device can be captured at a time");
+
+    const DeviceBase& deviceBaseImpl = (DeviceBase&)m_Impl;
+
+    Result result = deviceBaseImpl.FillFunctionTable(std::get<CoreInterface>(m_InterfacesImpl));
+    NRI_RETURN_ON_FAILURE(this, result == Result::SUCCESS, false, "Failed to get 'CoreInterface' interface");
+
+    result = deviceBaseImpl.FillFunctionTable(std::get<HelperInterface>(m_InterfacesImpl));
+    NRI_RETURN_ON_FAILURE(this, result == Result::SUCCESS, false, "Failed to get 'HelperInterface' interface");
+
+    FillFunctionTable(m_iCore);
+
+    m_IsInterfaceSupported.streamer = deviceBaseImpl.FillFunctionTable(std::get<StreamerInterface>(m_InterfacesImpl)) == Result::SUCCESS;
+    m_IsInterfaceSupported.imgui = deviceBaseImpl.FillFunctionTable(std::get<ImguiInterface>(m_InterfacesImpl)) == Result::SUCCESS;
+    m_IsInterfaceSupported.lowLatency = deviceBaseImpl.FillFunctionTable(std::get<LowLatencyInterface>(m_InterfacesImpl)) == Result::SUCCESS;
+    m_IsInterfaceSupported.meshShader = deviceBaseImpl.FillFunctionTable(std::get<MeshShaderInterface>(m_InterfacesImpl)) == Result::SUCCESS;
+    m_IsInterfaceSupported.rayTracing = deviceBaseImpl.FillFunctionTable(std::get<RayTracingInterface>(m_InterfacesImpl)) == Result::SUCCESS;
+    m_IsInterfaceSupported.swapChain = deviceBaseImpl.FillFunctionTable(std::get<SwapChainInterface>(m_InterfacesImpl)) == Result::SUCCESS;
+    m_IsInterfaceSupported.upscaler = deviceBaseImpl.FillFunctionTable(std::get<UpscalerInterface>(m_InterfacesImpl)) == Result::SUCCESS;
+    m_IsInterfaceSupported.wrapperD3D11 = deviceBaseImpl.FillFunctionTable(std::get<WrapperD3D11Interface>(m_InterfacesImpl)) == Result::SUCCESS;
+    m_IsInterfaceSupported.wrapperD3D12 = deviceBaseImpl.FillFunctionTable(std::get<WrapperD3D12Interface>(m_InterfacesImpl)) == Result::SUCCESS;
+    m_IsInterfaceSupported.wrapperVK = deviceBaseImpl.FillFunctionTable(std::get<WrapperVKInterface>(m_InterfacesImpl)) == Result::SUCCESS;
+
+    m_File = fopen(desc.captureFileName, "wb");
+    NRI_RETURN_ON_FAILURE(this, m_File, false, "Can't open '%s' for writing", desc.captureFileName);
+
+    // Header
+    CaptureHeader header = {};
+    header.magic = CAPTURE_MAGIC;
+    header.version = CAPTURE_VERSION;
+    header.graphicsAPI = GetDesc().graphicsAPI;
+
+    if (desc.queueFamilyNum) {
+        for (uint32_t i = 0; i < desc.queueFamilyNum; i++)
+            header.queueNum[(size_t)desc.queueFamilies[i].queueType] += desc.queueFamilies[i].queueNum;
+    } else
+        header.queueNum[(size_t)QueueType::GRAPHICS] = 1;
+
+    m_Stream.reserve(CAPTURE_STREAM_SIZE);
+    m_Stream.insert(m_Stream.end(), (const uint8_t*)&header, (const uint8_t*)(&header + 1));
+
+    g_DeviceCapture = this;
+
+    return true;
+}
+
+void DeviceCapture::Destruct() {
+    Destroy(GetAllocationCallbacks(), this);
+}
+
+uint32_t DeviceCapture::GetObjectID(const void* object) const {
+    const auto& it = m_Objects.find(object);
+
+    return it == m_Objects.end() ? 0 : it->second;
+}
+
+uint32_t DeviceCapture::RegisterObject(const void* object) {
+    const auto& it = m_Objects.try_emplace(object, m_NextObjectID);
+    if (it.second)
+        m_NextObjectID++;
+
+    return it.first->second;
+}
+
+void DeviceCapture::UnregisterObject(const void* object) {
+    m_Objects.erase(object);
+
+    const auto& it = m_BufferMaps.find((const Buffer*)object);
+    if (it != m_BufferMaps.end()) {
+        Destroy(GetAllocationCallbacks(), it->second);
+        m_BufferMaps.erase(it);
+    }
+}
+
+void DeviceCapture::BeginRecord(CaptureInterface interfaceIndex, uint8_t slot) {
+    CaptureRecordHeader recordHeader = {};
+    recordHeader.interfaceIndex = interfaceIndex;
+    recordHeader.slot = slot;
+
+    m_Record.clear();
+    m_Record.insert(m_Record.end(), (const uint8_t*)&recordHeader, (const uint8_t*)(&recordHeader + 1));
+}
+
+void DeviceCapture::EndRecord() {
+    CaptureRecordHeader* recordHeader = (CaptureRecordHeader*)m_Record.data();
+    recordHeader->size = (uint32_t)(m_Record.size() - sizeof(CaptureRecordHeader));
+
+    m_Stream.insert(m_Stream.end(), m_Record.begin(), m_Record.end());
+
+    if (m_Stream.size() >= CAPTURE_STREAM_SIZE)
+        FlushStream();
+}
+
+void DeviceCapture::WriteSpecial(CaptureSpecial special, const void* data, size_t size, const void* payload, uint64_t payloadSize) {
+    CaptureRecordHeader recordHeader = {};
+    recordHeader.interfaceIndex = CaptureInterface::SPECIAL;
+    recordHeader.slot = (uint8_t)special;
+    recordHeader.size = (uint32_t)(size + payloadSize);
+
+    m_Stream.insert(m_Stream.end(), (const uint8_t*)&recordHeader, (const uint8_t*)(&recordHeader + 1));
+    m_Stream.insert(m_Stream.end(), (const uint8_t*)data, (const uint8_t*)data + size);
+
+    // Big payloads bypass the stream
+    if (payloadSize >= CAPTURE_STREAM_SIZE) {
+        FlushStream();
+        fwrite(payload, 1, (size_t)payloadSize, m_File);
+    } else {
+        m_Stream.insert(m_Stream.end(), (const uint8_t*)payload, (const uint8_t*)payload + payloadSize);
+
+        if (m_Stream.size() >= CAPTURE_STREAM_SIZE)
+            FlushStream();
+    }
+}
+
+void DeviceCapture::OnMapBuffer(const Buffer& buffer, void* data, uint64_t offset, uint64_t size) {
+    if (size == WHOLE_SIZE)
+        size = GetInterfaceImpl<CoreInterface>().GetBufferDesc(buffer).size - offset;
+
+    ExclusiveScope lock(m_Lock);
+
+    BufferMapCapture*& bufferMap = m_BufferMaps[&buffer];
+    if (!bufferMap)
+        bufferMap = Allocate<BufferMapCapture>(GetAllocationCallbacks(), GetStdAllocator());
+
+    // Nested maps extend the tracked range, writes made so far are flushed first
+    uint64_t begin = offset;
+    uint64_t end = offset + size;
+    if (bufferMap->mapNum) {
+        FlushMappedBuffer(buffer, *bufferMap);
+
+        begin = std::min(begin, bufferMap->offset);
+        end = std::max(end, bufferMap->offset + bufferMap->size);
+    }
+
+    bufferMap->base = (uint8_t*)data - offset;
+    bufferMap->offset = begin;
+    bufferMap->size = end - begin;
+    bufferMap->mapNum++;
+
+    const uint8_t* src = bufferMap->base + begin;
+    bufferMap->shadow.assign(src, src + bufferMap->size);
+}
+
+void DeviceCapture::OnUnmapBuffer(const Buffer& buffer) {
+    ExclusiveScope lock(m_Lock);
+
+    const auto& it = m_BufferMaps.find(&buffer);
+    if (it == m_BufferMaps.end() || !it->second->mapNum)
+        return;
+
+    FlushMappedBuffer(buffer, *it->second);
+    it->second->mapNum--;
+}
+
+void DeviceCapture::FlushMappedBuffers() {
+    ExclusiveScope lock(m_Lock);
+
+    for (auto& it : m_BufferMaps) {
+        if (it.second->mapNum)
+            FlushMappedBuffer(*it.first, *it.second);
+    }
+}
+
+void DeviceCapture::FlushMappedBuffer(const Buffer& buffer, BufferMapCapture& bufferMap) {
+    const uint8_t* src = bufferMap.base + bufferMap.offset;
+    uint8_t* shadow = bufferMap.shadow.data();
+
+    CaptureBufferData bufferData = {};
+    bufferData.id = RegisterObject(&buffer); // known since "MapBuffer"
+
+    auto writeRange = [&](uint64_t rangeOffset, uint64_t rangeSize) {
+        memcpy(shadow + rangeOffset, src + rangeOffset, (size_t)rangeSize);
+
+        while (rangeSize) {
+            bufferData.offset = bufferMap.offset + rangeOffset;
+            bufferData.size = std::min(rangeSize, CAPTURE_BUFFER_DATA_MAX_SIZE);
+
+            WriteSpecial(CaptureSpecial::BUFFER_DATA, &bufferData, sizeof(bufferData), src + rangeOffset, bufferData.size);
+
+            rangeOffset += bufferData.size;
+            rangeSize -= bufferData.size;
+        }
+    };
+
+    // Nothing is known about the initial contents
+    if (!bufferMap.isCaptured) {
+        bufferMap.isCaptured = true;
+        writeRange(0, bufferMap.size);
+
+        return;
+    }
+
+    // Dirty blocks, adjacent ones get merged
+    uint64_t dirtyBegin = bufferMap.size;
+    for (uint64_t i = 0; i < bufferMap.size; i += CAPTURE_BLOCK_SIZE) {
+        size_t blockSize = (size_t)std::min(CAPTURE_BLOCK_SIZE, bufferMap.size - i);
+        bool isDirty = memcmp(src + i, shadow + i, blockSize) != 0;
+
+        if (isDirty && dirtyBegin == bufferMap.size)
+            dirtyBegin = i;
+        else if (!isDirty && dirtyBegin != bufferMap.size) {
+            writeRange(dirtyBegin, i - dirtyBegin);
+            dirtyBegin = bufferMap.size;
+        }
+    }
+
+    if (dirtyBegin != bufferMap.size)
+        writeRange(dirtyBegin, bufferMap.size - dirtyBegin);
+}
+
+void DeviceCapture::FlushStream() {
+    if (!m_Stream.empty())
+        fwrite(m_Stream.data(), 1, m_Stream.size(), m_File);
+
+    m_Stream.clear();
+}
+
+Result DeviceCapture::GetEntryPointStats(EntryPointStats* entryPointStats, uint32_t& entryPointStatNum) const {
+    return ((DeviceBase&)m_Impl).GetEntryPointStats(entryPointStats, entryPointStatNum);
+}
+
+#define NRI_CAPTURE_FILL(interface, name) table.name = NRI_CAPTURE_THUNK(interface, name)::Execute;
+#define NRI_PASS_THROUGH_FILL(interface, name) table.name = PassThroughThunk<&interface::name>::Execute;
+
+Result DeviceCapture::FillFunctionTable(CoreInterface& table) const {
+    NRI_CAPTURE_CORE_CALLS(NRI_CAPTURE_FILL)
+
+    table.GetDeviceDesc = ::GetDeviceDesc;
+    table.MapBuffer = ::MapBuffer;
+    table.UnmapBuffer = ::UnmapBuffer;
+    table.QueueSubmit = ::QueueSubmit;
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(HelperInterface& table) const {
+    NRI_CAPTURE_HELPER_CALLS(NRI_CAPTURE_FILL)
+
+    table.AllocateAndBindMemory = ::AllocateAndBindMemory;
+    table.CreateCommandRecorder = ::CreateCommandRecorder;
+    table.DestroyCommandRecorder = ::DestroyCommandRecorder;
+    table.BeginCommandRecorderFrame = ::BeginCommandRecorderFrame;
+    table.AcquireCommandBuffer = ::AcquireCommandBuffer;
+    table.SubmitCommandRecorderFrame = ::SubmitCommandRecorderFrame;
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(StreamerInterface& table) const {
+    if (!m_IsInterfaceSupported.streamer)
+        return Result::UNSUPPORTED;
+
+    NRI_CAPTURE_STREAMER_CALLS(NRI_CAPTURE_FILL)
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(ImguiInterface& table) const {
+    if (!m_IsInterfaceSupported.imgui)
+        return Result::UNSUPPORTED;
+
+    NRI_PASS_THROUGH_FILL(ImguiInterface, CreateImgui)
+    NRI_PASS_THROUGH_FILL(ImguiInterface, DestroyImgui)
+    NRI_PASS_THROUGH_FILL(ImguiInterface, CmdCopyImguiData)
+    NRI_PASS_THROUGH_FILL(ImguiInterface, CmdDrawImgui)
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(LowLatencyInterface& table) const {
+    if (!m_IsInterfaceSupported.lowLatency)
+        return Result::UNSUPPORTED;
+
+    NRI_PASS_THROUGH_FILL(LowLatencyInterface, SetLatencySleepMode)
+    NRI_PASS_THROUGH_FILL(LowLatencyInterface, SetLatencyMarker)
+    NRI_PASS_THROUGH_FILL(LowLatencyInterface, LatencySleep)
+    NRI_PASS_THROUGH_FILL(LowLatencyInterface, GetLatencyReport)
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(MeshShaderInterface& table) const {
+    if (!m_IsInterfaceSupported.meshShader)
+        return Result::UNSUPPORTED;
+
+    NRI_PASS_THROUGH_FILL(MeshShaderInterface, CmdDrawMeshTasks)
+    NRI_PASS_THROUGH_FILL(MeshShaderInterface, CmdDrawMeshTasksIndirect)
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(RayTracingInterface& table) const {
+    if (!m_IsInterfaceSupported.rayTracing)
+        return Result::UNSUPPORTED;
+
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CreateRayTracingPipeline)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CreateAccelerationStructureDescriptor)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetAccelerationStructureHandle)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetAccelerationStructureUpdateScratchBufferSize)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetAccelerationStructureBuildScratchBufferSize)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetMicromapBuildScratchBufferSize)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetAccelerationStructureBuffer)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetMicromapBuffer)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, DestroyAccelerationStructure)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, DestroyMicromap)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CreateAccelerationStructure)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CreateMicromap)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetAccelerationStructureMemoryDesc)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetMicromapMemoryDesc)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, BindAccelerationStructureMemory)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, BindMicromapMemory)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetAccelerationStructureMemoryDesc2)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetMicromapMemoryDesc2)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CreateCommittedAccelerationStructure)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CreateCommittedMicromap)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CreatePlacedAccelerationStructure)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CreatePlacedMicromap)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, WriteShaderGroupIdentifiers)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CmdBuildMicromaps)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CmdWriteMicromapsSizes)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CmdCopyMicromap)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CmdBuildTopLevelAccelerationStructures)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CmdBuildBottomLevelAccelerationStructures)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CmdWriteAccelerationStructuresSizes)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CmdCopyAccelerationStructure)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CmdDispatchRays)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, CmdDispatchRaysIndirect)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetAccelerationStructureNativeObject)
+    NRI_PASS_THROUGH_FILL(RayTracingInterface, GetMicromapNativeObject)
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(SwapChainInterface& table) const {
+    if (!m_IsInterfaceSupported.swapChain)
+        return Result::UNSUPPORTED;
+
+    NRI_PASS_THROUGH_FILL(SwapChainInterface, CreateSwapChain)
+    NRI_PASS_THROUGH_FILL(SwapChainInterface, DestroySwapChain)
+    NRI_PASS_THROUGH_FILL(SwapChainInterface, GetSwapChainTextures)
+    NRI_PASS_THROUGH_FILL(SwapChainInterface, GetDisplayDesc)
+    NRI_PASS_THROUGH_FILL(SwapChainInterface, AcquireNextTexture)
+    NRI_PASS_THROUGH_FILL(SwapChainInterface, WaitForPresent)
+    NRI_PASS_THROUGH_FILL(SwapChainInterface, QueuePresent)
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(UpscalerInterface& table) const {
+    if (!m_IsInterfaceSupported.upscaler)
+        return Result::UNSUPPORTED;
+
+    NRI_PASS_THROUGH_FILL(UpscalerInterface, CreateUpscaler)
+    NRI_PASS_THROUGH_FILL(UpscalerInterface, DestroyUpscaler)
+    NRI_PASS_THROUGH_FILL(UpscalerInterface, IsUpscalerSupported)
+    NRI_PASS_THROUGH_FILL(UpscalerInterface, GetUpscalerProps)
+    NRI_PASS_THROUGH_FILL(UpscalerInterface, CmdDispatchUpscale)
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(WrapperD3D11Interface& table) const {
+    if (!m_IsInterfaceSupported.wrapperD3D11)
+        return Result::UNSUPPORTED;
+
+    NRI_PASS_THROUGH_FILL(WrapperD3D11Interface, CreateCommandBufferD3D11)
+    NRI_PASS_THROUGH_FILL(WrapperD3D11Interface, CreateBufferD3D11)
+    NRI_PASS_THROUGH_FILL(WrapperD3D11Interface, CreateTextureD3D11)
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(WrapperD3D12Interface& table) const {
+    if (!m_IsInterfaceSupported.wrapperD3D12)
+        return Result::UNSUPPORTED;
+
+    NRI_PASS_THROUGH_FILL(WrapperD3D12Interface, CreateCommandBufferD3D12)
+    NRI_PASS_THROUGH_FILL(WrapperD3D12Interface, CreateDescriptorPoolD3D12)
+    NRI_PASS_THROUGH_FILL(WrapperD3D12Interface, CreateBufferD3D12)
+    NRI_PASS_THROUGH_FILL(WrapperD3D12Interface, CreateTextureD3D12)
+    NRI_PASS_THROUGH_FILL(WrapperD3D12Interface, CreateMemoryD3D12)
+    NRI_PASS_THROUGH_FILL(WrapperD3D12Interface, CreateFenceD3D12)
+    NRI_PASS_THROUGH_FILL(WrapperD3D12Interface, CreateAccelerationStructureD3D12)
+
+    return Result::SUCCESS;
+}
+
+Result DeviceCapture::FillFunctionTable(WrapperVKInterface& table) const {
+    if (!m_IsInterfaceSupported.wrapperVK)
+        return Result::UNSUPPORTED;
+
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreateCommandAllocatorVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreateCommandBufferVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreateDescriptorPoolVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreateBufferVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreateTextureVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreateMemoryVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreatePipelineVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreateQueryPoolVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreateFenceVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, CreateAccelerationStructureVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, GetQueueFamilyIndexVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, GetFilteredCommandNumVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, GetPhysicalDeviceVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, GetInstanceVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, GetInstanceProcAddrVK)
+    NRI_PASS_THROUGH_FILL(WrapperVKInterface, GetDeviceProcAddrVK)
+
+    return Result::SUCCESS;
+}
+
+#undef NRI_CAPTURE_FILL
+#undef NRI_PASS_THROUGH_FILL
+
+#pragma endregion
@@ -0,0 +1,671 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+/*
+Capture stream format, shared by the capture layer and "NRI_Replay" (depends only on public headers).
+Layout:
+- "CaptureHeader"
+- a sequence of records: "CaptureRecordHeader" followed by "size" bytes of payload
+Objects are replaced by IDs ("0" is "nullptr", "CAPTURE_DEVICE_ID" is the device). Arguments are serialized by the
+same "Transfer" code on both sides, it's driven by function signatures and a "Fixup" overload per struct with pointers.
+An archive ("A") implements:
+- "Bytes" - raw data
+- "Device" - a device handle (nothing is stored)
+- "Object / Objects" - IDs of existing objects
+- "OutObject / OutObjects" - IDs of returned objects
+- "Array / Optional" - structs, followed by their own fixups
+- "Blob / String" - opaque data
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "NRI.h"
+
+#include "Extensions/NRIHelper.h"
+#include "Extensions/NRIRayTracing.h"
+#include "Extensions/NRIStreamer.h"
+
+namespace nri {
+
+constexpr uint32_t CAPTURE_MAGIC = 0x5041434E; // "NCAP"
+constexpr uint32_t CAPTURE_VERSION = 6;
+constexpr uint32_t CAPTURE_DEVICE_ID = 1;
+
+enum class CaptureInterface : uint8_t {
+    CORE,
+    HELPER,
+    STREAMER,
+    SPECIAL
+};
+
+// Records not mapped to entry points ("CaptureInterface::SPECIAL")
+enum class CaptureSpecial : uint8_t {
+    BUFFER_DATA,      // id, offset, size, data - host writes into a mapped buffer
+    EXTERNAL_BUFFER,  // id, "BufferDesc" - a buffer created outside of captured calls
+    EXTERNAL_TEXTURE, // id, "TextureDesc" - a texture created outside of captured calls (swap chain textures)
+};
+
+struct CaptureHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t queueNum[(size_t)QueueType::MAX_NUM]; // queues requested at device creation
+    GraphicsAPI graphicsAPI;
+    uint8_t reserved[3];
+};
+
+struct CaptureRecordHeader {
+    CaptureInterface interfaceIndex;
+    uint8_t slot; // function index in the interface
+    uint16_t reserved;
+    uint32_t size;
+};
+
+// "CaptureSpecial::BUFFER_DATA" payload is followed by "size" bytes
+struct CaptureBufferData {
+    uint32_t id;
+    uint32_t reserved;
+    uint64_t offset;
+    uint64_t size;
+};
+
+#define NRI_CAPTURE_SLOT(interface, name) uint8_t(offsetof(interface, name) / sizeof(void*))
+
+// Entry points recorded by the generic code ("HelperInterface::AllocateAndBindMemory" is handled separately)
+#define NRI_CAPTURE_CORE_CALLS(X) \
+    X(CoreInterface, GetDeviceDesc) \
+    X(CoreInterface, GetBufferDesc) \
+    X(CoreInterface, GetTextureDesc) \
+    X(CoreInterface, GetFormatSupport) \
+    X(CoreInterface, GetQueue) \
+    X(CoreInterface, CreateCommandAllocator) \
+    X(CoreInterface, CreateCommandBuffer) \
+    X(CoreInterface, CreateCommandBundle) \
+    X(CoreInterface, CreateReusableCommandBuffer) \
+    X(CoreInterface, CreateCommandBuffers) \
+    X(CoreInterface, CreateFence) \
+    X(CoreInterface, CreateDescriptorPool) \
+    X(CoreInterface, CreatePipelineLayout) \
+    X(CoreInterface, CreateGraphicsPipeline) \
+    X(CoreInterface, CreateComputePipeline) \
+    X(CoreInterface, CreateQueryPool) \
+    X(CoreInterface, CreateSampler) \
+    X(CoreInterface, CreateBufferView) \
+    X(CoreInterface, CreateTextureView) \
+    X(CoreInterface, DestroyCommandAllocator) \
+    X(CoreInterface, DestroyCommandBuffer) \
+    X(CoreInterface, DestroyDescriptorPool) \
+    X(CoreInterface, DestroyBuffer) \
+    X(CoreInterface, DestroyTexture) \
+    X(CoreInterface, DestroyDescriptor) \
+    X(CoreInterface, DestroyPipelineLayout) \
+    X(CoreInterface, DestroyPipeline) \
+    X(CoreInterface, DestroyQueryPool) \
+    X(CoreInterface, DestroyFence) \
+    X(CoreInterface, AllocateMemory) \
+    X(CoreInterface, FreeMemory) \
+    X(CoreInterface, CreateBuffer) \
+    X(CoreInterface, CreateTexture) \
+    X(CoreInterface, GetBufferMemoryDesc) \
+    X(CoreInterface, GetTextureMemoryDesc) \
+    X(CoreInterface, BindBufferMemory) \
+    X(CoreInterface, BindTextureMemory) \
+    X(CoreInterface, GetBufferMemoryDesc2) \
+    X(CoreInterface, GetTextureMemoryDesc2) \
+    X(CoreInterface, CreateCommittedBuffer) \
+    X(CoreInterface, CreateCommittedTexture) \
+    X(CoreInterface, CreatePlacedBuffer) \
+    X(CoreInterface, CreatePlacedTexture) \
+    X(CoreInterface, AllocateDescriptorSets) \
+    X(CoreInterface, UpdateDescriptorRanges) \
+    X(CoreInterface, CopyDescriptorRanges) \
+    X(CoreInterface, ResetDescriptorPool) \
+    X(CoreInterface, GetDescriptorSetOffsets) \
+    X(CoreInterface, BeginCommandBuffer) \
+    X(CoreInterface, CmdSetDescriptorPool) \
+    X(CoreInterface, CmdSetPipelineLayout) \
+    X(CoreInterface, CmdSetDescriptorSet) \
+    X(CoreInterface, CmdSetRootConstants) \
+    X(CoreInterface, CmdSetRootDescriptor) \
+    X(CoreInterface, CmdSetPipeline) \
+    X(CoreInterface, CmdBarrier) \
+    X(CoreInterface, CmdSetIndexBuffer) \
+    X(CoreInterface, CmdSetVertexBuffers) \
+    X(CoreInterface, CmdSetViewports) \
+    X(CoreInterface, CmdSetScissors) \
+    X(CoreInterface, CmdSetStencilReference) \
+    X(CoreInterface, CmdSetDepthBounds) \
+    X(CoreInterface, CmdSetBlendConstants) \
+    X(CoreInterface, CmdSetSampleLocations) \
+    X(CoreInterface, CmdSetShadingRate) \
+    X(CoreInterface, CmdSetDepthBias) \
+    X(CoreInterface, CmdBeginRendering) \
+    X(CoreInterface, CmdClearAttachments) \
+    X(CoreInterface, CmdDraw) \
+    X(CoreInterface, CmdDrawIndexed) \
+    X(CoreInterface, CmdDrawMulti) \
+    X(CoreInterface, CmdDrawIndexedMulti) \
+    X(CoreInterface, CmdDrawIndirect) \
+    X(CoreInterface, CmdDrawIndexedIndirect) \
+    X(CoreInterface, CmdEndRendering) \
+    X(CoreInterface, CmdExecuteBundle) \
+    X(CoreInterface, CmdDispatch) \
+    X(CoreInterface, CmdDispatchIndirect) \
+    X(CoreInterface, CmdCopyBuffer) \
+    X(CoreInterface, CmdCopyTexture) \
+    X(CoreInterface, CmdUploadBufferToTexture) \
+    X(CoreInterface, CmdReadbackTextureToBuffer) \
+    X(CoreInterface, CmdZeroBuffer) \
+    X(CoreInterface, CmdResolveTexture) \
+    X(CoreInterface, CmdClearStorage) \
+    X(CoreInterface, CmdResetQueries) \
+    X(CoreInterface, CmdBeginQuery) \
+    X(CoreInterface, CmdEndQuery) \
+    X(CoreInterface, CmdCopyQueries) \
+    X(CoreInterface, CmdBeginAnnotation) \
+    X(CoreInterface, CmdEndAnnotation) \
+    X(CoreInterface, CmdAnnotation) \
+    X(CoreInterface, EndCommandBuffer) \
+    X(CoreInterface, QueueBeginAnnotation) \
+    X(CoreInterface, QueueEndAnnotation) \
+    X(CoreInterface, QueueAnnotation) \
+    X(CoreInterface, ResetQueries) \
+    X(CoreInterface, GetQuerySize) \
+    X(CoreInterface, QueueSubmit) \
+    X(CoreInterface, QueueWaitIdle) \
+    X(CoreInterface, DeviceWaitIdle) \
+    X(CoreInterface, Wait) \
+    X(CoreInterface, GetFenceValue) \
+    X(CoreInterface, ResetCommandAllocator) \
+    X(CoreInterface, MapBuffer) \
+    X(CoreInterface, UnmapBuffer) \
+    X(CoreInterface, GetBufferDeviceAddress) \
+    X(CoreInterface, SetDebugName) \
+    X(CoreInterface, GetDeviceNativeObject) \
+    X(CoreInterface, GetQueueNativeObject) \
+    X(CoreInterface, GetCommandBufferNativeObject) \
+    X(CoreInterface, GetBufferNativeObject) \
+    X(CoreInterface, GetTextureNativeObject) \
+    X(CoreInterface, GetDescriptorNativeObject)
+
+#define NRI_CAPTURE_HELPER_CALLS(X) \
+    X(HelperInterface, CalculateAllocationNumber) \
+    X(HelperInterface, UploadData) \
+    X(HelperInterface, QueryVideoMemoryInfo)
+
+#define NRI_CAPTURE_STREAMER_CALLS(X) \
+    X(StreamerInterface, CreateStreamer) \
+    X(StreamerInterface, DestroyStreamer) \
+    X(StreamerInterface, GetStreamerConstantBuffer) \
+    X(StreamerInterface, StreamBufferData) \
+    X(StreamerInterface, StreamTextureData) \
+    X(StreamerInterface, StreamConstantData) \
+    X(StreamerInterface, CmdCopyStreamedData) \
+    X(StreamerInterface, EndStreamerFrame)
+
+template <typename Interface>
+constexpr CaptureInterface GetCaptureInterface() {
+    if constexpr (std::is_same_v<Interface, CoreInterface>)
+        return CaptureInterface::CORE;
+    else if constexpr (std::is_same_v<Interface, HelperInterface>)
+        return CaptureInterface::HELPER;
+    else {
+        static_assert(std::is_same_v<Interface, StreamerInterface>, "Not a captured interface");
+        return CaptureInterface::STREAMER;
+    }
+}
+
+//============================================================================================================================================================================================
+#pragma region[  Signatures  ]
+
+// All opaque handles, which can be passed to or returned from captured calls ("Device" is handled separately)
+template <typename T>
+struct IsCaptureObject : std::false_type {};
+
+#define NRI_CAPTURE_OBJECT(name) \
+    template <> \
+    struct IsCaptureObject<name> : std::true_type {}
+
+NRI_CAPTURE_OBJECT(AccelerationStructure);
+NRI_CAPTURE_OBJECT(Buffer);
+NRI_CAPTURE_OBJECT(CommandAllocator);
+NRI_CAPTURE_OBJECT(CommandBuffer);
+NRI_CAPTURE_OBJECT(Descriptor);
+NRI_CAPTURE_OBJECT(DescriptorPool);
+NRI_CAPTURE_OBJECT(DescriptorSet);
+NRI_CAPTURE_OBJECT(Fence);
+NRI_CAPTURE_OBJECT(Memory);
+NRI_CAPTURE_OBJECT(Micromap);
+NRI_CAPTURE_OBJECT(Pipeline);
+NRI_CAPTURE_OBJECT(PipelineLayout);
+NRI_CAPTURE_OBJECT(QueryPool);
+NRI_CAPTURE_OBJECT(Queue);
+NRI_CAPTURE_OBJECT(Streamer);
+NRI_CAPTURE_OBJECT(SwapChain);
+NRI_CAPTURE_OBJECT(Texture);
+
+#undef NRI_CAPTURE_OBJECT
+
+template <typename T>
+constexpr bool IsCaptureHandle = IsCaptureObject<T>::value || std::is_same_v<T, Device>;
+
+// Sentinel for the argument following the last one
+struct CaptureNoArg {};
+
+enum class CaptureArg : uint8_t {
+    DEVICE,           // "Device&" or "Device*", nothing is stored
+    POD,              // passed by value
+    OBJECT,           // "X&" or "X*" (including "Object*")
+    OUT_OBJECT,       // "X*&"
+    OUT_OBJECT_ARRAY, // "X**", followed by a count
+    STRING,           // "const char*"
+    BLOB,             // "const void*", followed by a size
+    STRUCT,           // "const S&"
+    STRUCT_ARRAY,     // "const S*", followed by a count
+    OPTIONAL_STRUCT,  // "const S*"
+    OUT,              // "S&", not stored
+};
+
+template <typename T>
+constexpr bool IsCaptureCount = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+template <typename T, typename Next>
+constexpr CaptureArg GetCaptureArg() {
+    if constexpr (std::is_lvalue_reference_v<T>) {
+        using U = std::remove_reference_t<T>;
+        using B = std::remove_cv_t<U>;
+
+        if constexpr (std::is_same_v<B, Device>)
+            return CaptureArg::DEVICE;
+        else if constexpr (IsCaptureObject<B>::value)
+            return CaptureArg::OBJECT;
+        else if constexpr (std::is_pointer_v<B>) {
+            static_assert(IsCaptureObject<std::remove_pointer_t<B>>::value, "Only objects can be returned via 'X*&'");
+            return CaptureArg::OUT_OBJECT;
+        } else if constexpr (std::is_const_v<U>)
+            return CaptureArg::STRUCT;
+        else
+            return CaptureArg::OUT;
+    } else if constexpr (std::is_pointer_v<T>) {
+        using E = std::remove_pointer_t<T>;
+        using B = std::remove_cv_t<E>;
+
+        if constexpr (std::is_same_v<B, Device>)
+            return CaptureArg::DEVICE;
+        else if constexpr (std::is_same_v<B, void>) {
+            if constexpr (std::is_const_v<E>) {
+                static_assert(IsCaptureCount<Next>, "'const void*' must be followed by a size");
+                return CaptureArg::BLOB;
+            } else
+                return CaptureArg::OBJECT;
+        } else if constexpr (std::is_same_v<B, char>)
+            return CaptureArg::STRING;
+        else if constexpr (IsCaptureObject<B>::value)
+            return CaptureArg::OBJECT;
+        else if constexpr (std::is_pointer_v<B>) {
+            static_assert(IsCaptureCount<Next>, "'X**' must be followed by a count");
+            return CaptureArg::OUT_OBJECT_ARRAY;
+        } else if constexpr (IsCaptureCount<Next>)
+            return CaptureArg::STRUCT_ARRAY;
+        else
+            return CaptureArg::OPTIONAL_STRUCT;
+    } else
+        return CaptureArg::POD;
+}
+
+// How an argument is kept between deserialization and the call: handles by pointer, structs by value
+template <typename T>
+struct CaptureStorage {
+    using type = T;
+};
+
+template <typename T>
+struct CaptureStorage<T&> {
+    using type = std::conditional_t<IsCaptureHandle<std::remove_cv_t<T>>, T*, std::remove_cv_t<T>>;
+};
+
+template <typename T>
+using CaptureStorage_t = typename CaptureStorage<T>::type;
+
+template <typename T>
+inline CaptureStorage_t<T> ToCaptureStorage(T arg) {
+    if constexpr (std::is_reference_v<T> && IsCaptureHandle<std::remove_cv_t<std::remove_reference_t<T>>>)
+        return &arg;
+    else
+        return arg;
+}
+
+template <typename T>
+inline T FromCaptureStorage(CaptureStorage_t<T>& storage) {
+    if constexpr (std::is_reference_v<T> && IsCaptureHandle<std::remove_cv_t<std::remove_reference_t<T>>>)
+        return *storage;
+    else
+        return storage;
+}
+
+template <typename Member>
+struct CaptureCall;
+
+template <typename Interface, typename R, typename... Args>
+struct CaptureCall<R (NRI_CALL* Interface::*)(Args...)> {
+    using Result = R;
+    using Storage = std::tuple<CaptureStorage_t<Args>...>;
+
+    // "void DestroyX(X*)": recorded before the call, the ID is released
+    static constexpr bool IsDestroy() {
+        if constexpr (std::is_void_v<R> && sizeof...(Args) == 1) {
+            using T = std::tuple_element_t<0, std::tuple<Args...>>;
+
+            return std::is_pointer_v<T> && !std::is_const_v<std::remove_pointer_t<T>> && IsCaptureObject<std::remove_pointer_t<T>>::value;
+        }
+
+        return false;
+    }
+};
+
+template <auto A, auto B>
+struct IsSameMember : std::false_type {};
+
+template <auto A>
+struct IsSameMember<A, A> : std::true_type {};
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Structs  ]
+
+template <typename A, typename T>
+inline void Fixup(A&, T&) {
+}
+
+template <typename A, typename T>
+inline void Transfer(A& a, T& value) {
+    a.Bytes(&value, sizeof(T));
+    Fixup(a, value);
+}
+
+template <typename A>
+inline void Fixup(A& a, BufferBarrierDesc& desc) {
+    a.Object(desc.buffer);
+}
+
+template <typename A>
+inline void Fixup(A& a, TextureBarrierDesc& desc) {
+    a.Object(desc.texture);
+    a.Object(desc.srcQueue);
+    a.Object(desc.dstQueue);
+}
+
+template <typename A>
+inline void Fixup(A& a, BarrierDesc& desc) {
+    a.Array(desc.globals, desc.globalNum);
+    a.Array(desc.buffers, desc.bufferNum);
+    a.Array(desc.textures, desc.textureNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, BindBufferMemoryDesc& desc) {
+    a.Object(desc.buffer);
+    a.Object(desc.memory);
+}
+
+template <typename A>
+inline void Fixup(A& a, BindTextureMemoryDesc& desc) {
+    a.Object(desc.texture);
+    a.Object(desc.memory);
+}
+
+template <typename A>
+inline void Fixup(A& a, TextureViewDesc& desc) {
+    a.Object(desc.texture);
+}
+
+template <typename A>
+inline void Fixup(A& a, BufferViewDesc& desc) {
+    a.Object(desc.buffer);
+}
+
+template <typename A>
+inline void Fixup(A& a, DescriptorSetDesc& desc) {
+    a.Array(desc.ranges, desc.rangeNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, PipelineLayoutDesc& desc) {
+    a.Array(desc.rootConstants, desc.rootConstantNum);
+    a.Array(desc.rootDescriptors, desc.rootDescriptorNum);
+    a.Array(desc.rootSamplers, desc.rootSamplerNum);
+    a.Array(desc.descriptorSets, desc.descriptorSetNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, UpdateDescriptorRangeDesc& desc) {
+    a.Object(desc.descriptorSet);
+    a.Objects(desc.descriptors, desc.descriptorNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, CopyDescriptorRangeDesc& desc) {
+    a.Object(desc.dstDescriptorSet);
+    a.Object(desc.srcDescriptorSet);
+}
+
+template <typename A>
+inline void Fixup(A& a, SetDescriptorSetDesc& desc) {
+    a.Object(desc.descriptorSet);
+}
+
+template <typename A>
+inline void Fixup(A& a, SetRootConstantsDesc& desc) {
+    a.Blob(desc.data, desc.size);
+}
+
+template <typename A>
+inline void Fixup(A& a, SetRootDescriptorDesc& desc) {
+    a.Object(desc.descriptor);
+}
+
+template <typename A>
+inline void Fixup(A& a, VertexAttributeDesc& desc) {
+    a.String(desc.d3d.semanticName);
+}
+
+template <typename A>
+inline void Fixup(A& a, VertexInputDesc& desc) {
+    a.Array(desc.attributes, desc.attributeNum);
+    a.Array(desc.streams, desc.streamNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, VertexBufferDesc& desc) {
+    a.Object(desc.buffer);
+}
+
+template <typename A>
+inline void Fixup(A& a, OutputMergerDesc& desc) {
+    a.Array(desc.colors, desc.colorNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, ShaderDesc& desc) {
+    a.Blob(desc.bytecode, desc.size);
+    a.String(desc.entryPointName);
+}
+
+template <typename A>
+inline void Fixup(A& a, GraphicsPipelineDesc& desc) {
+    a.Object(desc.pipelineLayout);
+    a.Optional(desc.vertexInput);
+    a.Optional(desc.multisample);
+    Fixup(a, desc.outputMerger);
+    a.Array(desc.shaders, desc.shaderNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, ComputePipelineDesc& desc) {
+    a.Object(desc.pipelineLayout);
+    Fixup(a, desc.shader);
+}
+
+template <typename A>
+inline void Fixup(A& a, AttachmentDesc& desc) {
+    a.Object(desc.descriptor);
+    a.Object(desc.resolveDst);
+}
+
+template <typename A>
+inline void Fixup(A& a, RenderingDesc& desc) {
+    a.Array(desc.colors, desc.colorNum);
+    Fixup(a, desc.depth);
+    Fixup(a, desc.stencil);
+    a.Object(desc.shadingRate);
+}
+
+template <typename A>
+inline void Fixup(A& a, FenceSubmitDesc& desc) {
+    a.Object(desc.fence);
+}
+
+template <typename A>
+inline void Fixup(A& a, CommandBundleDesc& desc) {
+    a.Array(desc.colorFormats, desc.colorFormatNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, QueueSubmitDesc& desc) {
+    a.Array(desc.waitFences, desc.waitFenceNum);
+    a.Objects(desc.commandBuffers, desc.commandBufferNum);
+    a.Array(desc.signalFences, desc.signalFenceNum);
+
+    // Presentation is not captured
+    if constexpr (A::IS_READER)
+        desc.swapChain = nullptr;
+}
+
+template <typename A>
+inline void Fixup(A& a, ClearStorageDesc& desc) {
+    a.Object(desc.descriptor);
+}
+
+template <typename A>
+inline void Fixup(A& a, ResourceGroupDesc& desc) {
+    a.Objects(desc.textures, desc.textureNum);
+    a.Objects(desc.buffers, desc.bufferNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, TextureSubresourceUploadDesc& desc) {
+    a.Blob(desc.slices, (uint64_t)desc.sliceNum * desc.slicePitch);
+}
+
+template <typename A>
+inline void Fixup(A& a, TextureUploadDesc& desc) {
+    // Subresource and data sizes depend on the texture, only the writer can compute them
+    uint64_t subresourceNum = 0;
+    if constexpr (!A::IS_READER)
+        subresourceNum = desc.subresources ? a.GetSubresourceNum(*desc.texture) : 0;
+
+    a.Object(desc.texture);
+    a.Bytes(&subresourceNum, sizeof(subresourceNum));
+    a.Array(desc.subresources, subresourceNum);
+}
+
+template <typename A>
+inline void Fixup(A& a, BufferUploadDesc& desc) {
+    uint64_t size = 0;
+    if constexpr (!A::IS_READER)
+        size = desc.data ? a.GetBufferSize(*desc.buffer) : 0;
+
+    a.Object(desc.buffer);
+    a.Blob(desc.data, size);
+}
+
+template <typename A>
+inline void Fixup(A& a, DataSize& desc) {
+    a.Blob(desc.data, desc.size);
+}
+
+template <typename A>
+inline void Fixup(A& a, StreamBufferDataDesc& desc) {
+    a.Array(desc.dataChunks, desc.dataChunkNum);
+    a.Object(desc.dstBuffer);
+}
+
+template <typename A>
+inline void Fixup(A& a, StreamTextureDataDesc& desc) {
+    uint64_t size = 0;
+    if constexpr (!A::IS_READER)
+        size = a.GetStreamTextureDataSize(desc);
+
+    a.Object(desc.dstTexture);
+    a.Blob(desc.data, size);
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Calls  ]
+
+template <uint32_t PASS, size_t I, typename... Args, typename A, typename Storage>
+inline void TransferArg(A& a, Storage& storage) {
+    using T = std::tuple_element_t<I, std::tuple<Args...>>;
+    using Next = std::tuple_element_t<I + 1, std::tuple<Args..., CaptureNoArg>>;
+
+    constexpr CaptureArg kind = GetCaptureArg<T, Next>();
+    auto& arg = std::get<I>(storage);
+
+    // Pass 0 makes counts and sizes available for pass 1
+    if constexpr (PASS == 0) {
+        if constexpr (kind == CaptureArg::DEVICE)
+            a.Device(arg);
+        else if constexpr (kind == CaptureArg::POD)
+            a.Bytes(&arg, sizeof(arg));
+    } else {
+        if constexpr (kind == CaptureArg::OBJECT)
+            a.Object(arg);
+        else if constexpr (kind == CaptureArg::OUT_OBJECT)
+            a.OutObject(arg);
+        else if constexpr (kind == CaptureArg::OUT_OBJECT_ARRAY)
+            a.OutObjects(arg, (uint64_t)std::get<I + 1>(storage));
+        else if constexpr (kind == CaptureArg::STRING)
+            a.String(arg);
+        else if constexpr (kind == CaptureArg::BLOB)
+            a.Blob(arg, (uint64_t)std::get<I + 1>(storage));
+        else if constexpr (kind == CaptureArg::STRUCT)
+            Transfer(a, arg);
+        else if constexpr (kind == CaptureArg::STRUCT_ARRAY)
+            a.Array(arg, (uint64_t)std::get<I + 1>(storage));
+        else if constexpr (kind == CaptureArg::OPTIONAL_STRUCT)
+            a.Optional(arg);
+    }
+}
+
+template <typename... Args, typename A, typename Storage, size_t... Is>
+inline void TransferArgs(A& a, Storage& storage, std::index_sequence<Is...>) {
+    (TransferArg<0, Is, Args...>(a, storage), ...);
+    (TransferArg<1, Is, Args...>(a, storage), ...);
+}
+
+template <typename A, typename R>
+inline void TransferResult(A& a, R& result) {
+    if constexpr (std::is_pointer_v<R> && IsCaptureObject<std::remove_cv_t<std::remove_pointer_t<R>>>::value)
+        a.OutObject(result);
+    else if constexpr (std::is_same_v<R, BufferOffset>)
+        a.OutObject(result.buffer);
+}
+
+// "allocations" has no count argument, it's "CalculateAllocationNumber" evaluated by the writer
+template <typename A>
+inline void TransferAllocateAndBindMemory(A& a, ResourceGroupDesc& resourceGroupDesc, Memory**& allocations, uint32_t& allocationNum) {
+    Transfer(a, resourceGroupDesc);
+    a.Bytes(&allocationNum, sizeof(allocationNum));
+    a.OutObjects(allocations, allocationNum);
+}
+
+#pragma endregion
+
+} // namespace nri
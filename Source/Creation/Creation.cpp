@@ -41,6 +41,16 @@ Result CreateDeviceD3D12(const DeviceCreationDesc& deviceCreationDesc, const Dev
 Result CreateDeviceVK(const DeviceCreationDesc& deviceCreationDesc, const DeviceCreationVKDesc& deviceCreationDescVK, DeviceBase*& device);
 Result CreateDeviceWebGPU(const DeviceCreationDesc& desc, const DeviceCreationWebGPUDesc& descWebGPU, DeviceBase*& device);
 DeviceBase* CreateDeviceValidation(const DeviceCreationDesc& deviceCreationDesc, DeviceBase& device);
+DeviceBase* CreateDeviceCapture(const DeviceCreationDesc& deviceCreationDesc, DeviceBase& device);
+bool CreateDeviceStatistics(const DeviceCreationDesc& deviceCreationDesc, DeviceBase& device);
+void DestroyDeviceStatistics(const DeviceBase& device);
+bool CreateHostAllocationTracker(AllocationCallbacks& allocationCallbacks);
+void SetHostAllocationTag(AllocationCallbacks& allocationCallbacks, AllocationTag tag);
+void DestroyHostAllocationTracker(const AllocationCallbacks& allocationCallbacks);
+void InstrumentFunctionTable(const DeviceBase& device, CoreInterface& table);
+void InstrumentFunctionTable(const DeviceBase& device, MeshShaderInterface& table);
+void InstrumentFunctionTable(const DeviceBase& device, RayTracingInterface& table);
+Result FillFunctionTable(const DeviceBase& device, StatisticsInterface& table);
 
 constexpr uint64_t Hash(const char* name) {
     return *name != 0 ? *name ^ (33 * Hash(name + 1)) : 5381;
@@ -487,9 +497,17 @@ static Result EnumerateAdaptersWebGPU(AdapterDesc* adapterDescs, uint32_t& adapt
 
 static Result FinalizeDeviceCreation(const DeviceCreationDesc& deviceCreationDesc, DeviceBase& deviceImpl, Device*& device) {
     MaybeUnused(deviceCreationDesc);
+    bool isNONEDummy = deviceCreationDesc.graphicsAPI == GraphicsAPI::NONE && !deviceCreationDesc.enableNONEHostEmulation;
+    MaybeUnused(isNONEDummy);
+
 #if NRI_ENABLE_VALIDATION_SUPPORT
-    if (deviceCreationDesc.enableNRIValidation && deviceCreationDesc.graphicsAPI != GraphicsAPI::NONE) {
-        Device* deviceVal = (Device*)CreateDeviceValidation(deviceCreationDesc, deviceImpl);
+    if (deviceCreationDesc.enableNRIValidation && !isNONEDummy) {
+        DeviceCreationDesc deviceCreationDescVal = deviceCreationDesc;
+#    if NRI_ENABLE_STATISTICS_SUPPORT
+        SetHostAllocationTag(deviceCreationDescVal.allocationCallbacks, AllocationTag::VALIDATION);
+#    endif
+
+        Device* deviceVal = (Device*)CreateDeviceValidation(deviceCreationDescVal, deviceImpl);
         if (!deviceVal) {
             nriDestroyDevice((Device*)&deviceImpl);
             return Result::FAILURE;
@@ -500,6 +518,36 @@ static Result FinalizeDeviceCreation(const DeviceCreationDesc& deviceCreationDes
 #endif
         device = (Device*)&deviceImpl;
 
+    // Capture goes on top of validation to record what the application does
+#if NRI_ENABLE_CAPTURE_SUPPORT
+    if (deviceCreationDesc.captureFileName && !isNONEDummy) {
+        DeviceCreationDesc deviceCreationDescCapture = deviceCreationDesc;
+#    if NRI_ENABLE_STATISTICS_SUPPORT
+        SetHostAllocationTag(deviceCreationDescCapture.allocationCallbacks, AllocationTag::CAPTURE);
+#    endif
+
+        Device* deviceCapture = (Device*)CreateDeviceCapture(deviceCreationDescCapture, *(DeviceBase*)device);
+        if (!deviceCapture) {
+#    if NRI_ENABLE_STATISTICS_SUPPORT
+            DestroyHostAllocationTracker(deviceCreationDesc.allocationCallbacks);
+#    endif
+            return Result::FAILURE; // the wrapped device is already destroyed
+        }
+
+        device = deviceCapture;
+    }
+#endif
+
+    // Statistics instrument function tables of the outermost device
+#if NRI_ENABLE_STATISTICS_SUPPORT
+    if (deviceCreationDesc.enableStatistics && !isNONEDummy) {
+        if (!CreateDeviceStatistics(deviceCreationDesc, *(DeviceBase*)device)) {
+            nriDestroyDevice(device);
+            return Result::FAILURE;
+        }
+    }
+#endif
+
 #if NRI_ENABLE_NVTX_SUPPORT
     nvtxInitialize(nullptr); // needed only to avoid stalls on the first use
 #endif
@@ -524,6 +572,14 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
         realInterfaceSize = sizeof(CoreInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(CoreInterface*)interfacePtr);
+#if NRI_ENABLE_STATISTICS_SUPPORT
+        if (result == Result::SUCCESS)
+            InstrumentFunctionTable(deviceBase, *(CoreInterface*)interfacePtr);
+#endif
+    } else if (hash == Hash(NRI_STRINGIFY(DeviceGeneratedCommandsInterface))) {
+        realInterfaceSize = sizeof(DeviceGeneratedCommandsInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(DeviceGeneratedCommandsInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(ImguiInterface))) {
         realInterfaceSize = sizeof(ImguiInterface);
         if (realInterfaceSize == interfaceSize)
@@ -540,10 +596,26 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
         realInterfaceSize = sizeof(MeshShaderInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(MeshShaderInterface*)interfacePtr);
+#if NRI_ENABLE_STATISTICS_SUPPORT
+        if (result == Result::SUCCESS)
+            InstrumentFunctionTable(deviceBase, *(MeshShaderInterface*)interfacePtr);
+#endif
     } else if (hash == Hash(NRI_STRINGIFY(RayTracingInterface))) {
         realInterfaceSize = sizeof(RayTracingInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(RayTracingInterface*)interfacePtr);
+#if NRI_ENABLE_STATISTICS_SUPPORT
+        if (result == Result::SUCCESS)
+            InstrumentFunctionTable(deviceBase, *(RayTracingInterface*)interfacePtr);
+#endif
+    } else if (hash == Hash(NRI_STRINGIFY(StatisticsInterface))) {
+        realInterfaceSize = sizeof(StatisticsInterface);
+#if NRI_ENABLE_STATISTICS_SUPPORT
+        if (realInterfaceSize == interfaceSize)
+            result = FillFunctionTable(deviceBase, *(StatisticsInterface*)interfacePtr);
+#else
+        result = Result::UNSUPPORTED;
+#endif
     } else if (hash == Hash(NRI_STRINGIFY(StreamerInterface))) {
         realInterfaceSize = sizeof(StreamerInterface);
         if (realInterfaceSize == interfaceSize)
@@ -594,6 +666,10 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
 NRI_API void NRI_CALL nriBeginAnnotation(const char* name, uint32_t bgra) {
     MaybeUnused(name, bgra);
 
+#if NRI_ENABLE_TRACE_SUPPORT
+    TraceBegin(name);
+#endif
+
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
 #    if NRI_ENABLE_NVTX_SUPPORT
 
@@ -616,6 +692,10 @@ NRI_API void NRI_CALL nriBeginAnnotation(const char* name, uint32_t bgra) {
 }
 
 NRI_API void NRI_CALL nriEndAnnotation() {
+#if NRI_ENABLE_TRACE_SUPPORT
+    TraceEnd();
+#endif
+
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
 #    if NRI_ENABLE_NVTX_SUPPORT
 
@@ -632,6 +712,10 @@ NRI_API void NRI_CALL nriEndAnnotation() {
 NRI_API void NRI_CALL nriAnnotation(const char* name, uint32_t bgra) {
     MaybeUnused(name, bgra);
 
+#if NRI_ENABLE_TRACE_SUPPORT
+    TraceInstant(name);
+#endif
+
 #if NRI_ENABLE_DEBUG_NAMES_AND_ANNOTATIONS
 #    if NRI_ENABLE_NVTX_SUPPORT
 
@@ -677,14 +761,51 @@ NRI_API void NRI_CALL nriSetThreadName(const char* name) {
 #    endif
 
     nvtxNameOsThreadA((uint32_t)tid, name);
+
+#    if NRI_ENABLE_TRACE_SUPPORT
+    TraceThreadName(name);
+#    endif
 }
 
 #else
 
-NRI_API void NRI_CALL nriSetThreadName(const char*) {
+NRI_API void NRI_CALL nriSetThreadName(const char* name) {
+    MaybeUnused(name);
+
+#    if NRI_ENABLE_TRACE_SUPPORT
+    TraceThreadName(name);
+#    endif
+}
+
+#endif
+
+NRI_API Result NRI_CALL nriStartTrace() {
+#if NRI_ENABLE_TRACE_SUPPORT
+    TraceStart();
+
+    return Result::SUCCESS;
+#else
+    return Result::UNSUPPORTED;
+#endif
 }
 
+NRI_API Result NRI_CALL nriStopTrace(const char* fileName) {
+    MaybeUnused(fileName);
+
+#if NRI_ENABLE_TRACE_SUPPORT
+    return TraceStop(fileName) ? Result::SUCCESS : Result::FAILURE;
+#else
+    return Result::UNSUPPORTED;
 #endif
+}
+
+NRI_API void NRI_CALL nriSetFrameArena(const FrameArenaDesc* frameArenaDesc) {
+    SetFrameArena(frameArenaDesc);
+}
+
+NRI_API void NRI_CALL nriResetFrameArena() {
+    ResetFrameArena();
+}
 
 NRI_API Result NRI_CALL nriCreateDevice(const DeviceCreationDesc& deviceCreationDesc, Device*& device) {
     Result result = Result::UNSUPPORTED;
@@ -723,6 +844,15 @@ NRI_API Result NRI_CALL nriCreateDevice(const DeviceCreationDesc& deviceCreation
             queueFamily.queueNum = supportedQueueNum;
     }
 
+    // Host allocations are tracked from the very beginning
+#if NRI_ENABLE_STATISTICS_SUPPORT
+    bool isNONEDummy = modifiedDeviceCreationDesc.graphicsAPI == GraphicsAPI::NONE && !modifiedDeviceCreationDesc.enableNONEHostEmulation;
+    if (modifiedDeviceCreationDesc.enableStatistics && !isNONEDummy) {
+        if (!CreateHostAllocationTracker(modifiedDeviceCreationDesc.allocationCallbacks))
+            return Result::OUT_OF_MEMORY;
+    }
+#endif
+
 #if NRI_ENABLE_NONE_SUPPORT
     if (modifiedDeviceCreationDesc.graphicsAPI == GraphicsAPI::NONE)
         result = CreateDeviceNONE(modifiedDeviceCreationDesc, deviceImpl);
@@ -748,8 +878,12 @@ NRI_API Result NRI_CALL nriCreateDevice(const DeviceCreationDesc& deviceCreation
         result = CreateDeviceWebGPU(modifiedDeviceCreationDesc, {}, deviceImpl);
 #endif
 
-    if (result != Result::SUCCESS)
+    if (result != Result::SUCCESS) {
+#if NRI_ENABLE_STATISTICS_SUPPORT
+        DestroyHostAllocationTracker(modifiedDeviceCreationDesc.allocationCallbacks);
+#endif
         return result;
+    }
 
     return FinalizeDeviceCreation(modifiedDeviceCreationDesc, *deviceImpl, device);
 }
@@ -872,6 +1006,8 @@ NRI_API Result NRI_CALL nriCreateDeviceFromVKDevice(const DeviceCreationVKDesc&
     deviceCreationDesc.allocationCallbacks = deviceCreationVKDesc.allocationCallbacks;
     deviceCreationDesc.enableNRIValidation = deviceCreationVKDesc.enableNRIValidation;
     deviceCreationDesc.enableMemoryZeroInitialization = deviceCreationVKDesc.enableMemoryZeroInitialization;
+    deviceCreationDesc.enableRedundantStateFiltering = deviceCreationVKDesc.enableRedundantStateFiltering;
+    deviceCreationDesc.enableBarrierBatching = deviceCreationVKDesc.enableBarrierBatching;
     deviceCreationDesc.vkBindingOffsets = deviceCreationVKDesc.vkBindingOffsets;
     deviceCreationDesc.vkExtensions = deviceCreationVKDesc.vkExtensions;
 
@@ -911,8 +1047,24 @@ NRI_API Result NRI_CALL nriCreateDeviceFromVKDevice(const DeviceCreationVKDesc&
 }
 
 NRI_API void NRI_CALL nriDestroyDevice(Device* device) {
-    if (device)
+    if (device) {
+#if NRI_ENABLE_STATISTICS_SUPPORT
+        DestroyDeviceStatistics(*(DeviceBase*)device);
+
+        // Layers and the device share the tracker, it outlives them
+        AllocationCallbacks allocationCallbacks = ((DeviceBase*)device)->GetAllocationCallbacks();
+#endif
+
         ((DeviceBase*)device)->Destruct();
+
+#if NRI_ENABLE_STATISTICS_SUPPORT
+        DestroyHostAllocationTracker(allocationCallbacks);
+#endif
+    }
+}
+
+NRI_API Result NRI_CALL nriGetEntryPointStats(const Device& device, EntryPointStats* entryPointStats, uint32_t& entryPointStatNum) {
+    return ((DeviceBase&)device).GetEntryPointStats(entryPointStats, entryPointStatNum);
 }
 
 NRI_API Format NRI_CALL nriConvertVKFormatToNRI(uint32_t vkFormat) {
@@ -24,6 +24,7 @@ struct CommandAllocatorD3D11 final : public DebugNameBase {
     }
 
     Result CreateCommandBuffer(CommandBuffer*& commandBuffer);
+    Result CreateReusableCommandBuffer(CommandBuffer*& commandBuffer);
 
 private:
     DeviceD3D11& m_Device;
@@ -31,3 +31,13 @@ Result nri::CreateCommandBuffer(DeviceD3D11& device, ID3D11DeviceContext* precre
 NRI_INLINE Result CommandAllocatorD3D11::CreateCommandBuffer(CommandBuffer*& commandBuffer) {
     return nri::CreateCommandBuffer(m_Device, nullptr, commandBuffer);
 }
+
+NRI_INLINE Result CommandAllocatorD3D11::CreateReusableCommandBuffer(CommandBuffer*& commandBuffer) {
+    Result result = nri::CreateCommandBuffer(m_Device, nullptr, commandBuffer);
+
+    // An emulated command buffer replays its own stream, i.e. it's reusable as is
+    if (result == Result::SUCCESS && !m_Device.IsDeferredContextEmulated())
+        ((CommandBufferD3D11*)commandBuffer)->SetReusable();
+
+    return result;
+}
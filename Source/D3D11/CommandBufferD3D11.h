@@ -41,6 +41,10 @@ struct CommandBufferD3D11 final : public CommandBufferBase {
     // CommandBufferBase
     //================================================================================================================
 
+    inline void SetReusable() {
+        m_IsReusable = true;
+    }
+
     inline ID3D11DeviceContextBest* GetNativeObject() const override {
         return m_DeferredContext;
     }
@@ -114,6 +118,7 @@ private:
     uint8_t m_StencilRef = 0;
     uint8_t m_Version = 0;
     bool m_IsShadingRateLookupTableSet = false;
+    bool m_IsReusable = false; // the command list is kept after submission
 };
 
 } // namespace nri
@@ -87,7 +87,9 @@ Result CommandBufferD3D11::Create(ID3D11DeviceContext* precreatedContext) {
 
 void CommandBufferD3D11::Submit() {
     m_Device.GetImmediateContext()->ExecuteCommandList(m_CommandList, FALSE);
-    m_CommandList = nullptr;
+
+    if (!m_IsReusable)
+        m_CommandList = nullptr;
 }
 
 NRI_INLINE Result CommandBufferD3D11::Begin(const DescriptorPool* descriptorPool) {
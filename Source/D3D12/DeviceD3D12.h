@@ -84,6 +84,8 @@ struct DeviceD3D12 final : public DeviceBase {
 
     template <typename Implementation, typename Interface, typename... Args>
     inline Result CreateImplementation(Interface*& entity, const Args&... args) {
+        NRI_ALLOCATION_SCOPE(GetAllocationTag<Interface>());
+
         Implementation* impl = Allocate<Implementation>(GetAllocationCallbacks(), *this);
         Result result = impl->Create(args...);
 
@@ -92,6 +92,28 @@ static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, C
     return ((CommandAllocatorD3D12&)commandAllocator).CreateCommandBuffer(commandBuffer);
 }
 
+static Result NRI_CALL CreateReusableCommandBuffer(CommandAllocator& commandAllocator, const ReusableCommandBufferDesc&, CommandBuffer*& commandBuffer) {
+    return ((CommandAllocatorD3D12&)commandAllocator).CreateCommandBuffer(commandBuffer); // command lists are reusable
+}
+
+static Result NRI_CALL CreateCommandBuffers(CommandAllocator& commandAllocator, CommandBuffer** commandBuffers, uint32_t commandBufferNum) {
+    for (uint32_t i = 0; i < commandBufferNum; i++) {
+        Result result = ((CommandAllocatorD3D12&)commandAllocator).CreateCommandBuffer(commandBuffers[i]);
+        if (result != Result::SUCCESS) {
+            for (uint32_t j = 0; j < i; j++)
+                Destroy((CommandBufferD3D12*)commandBuffers[j]);
+
+            return result;
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL CreateCommandBundle(CommandAllocator&, const CommandBundleDesc&, CommandBuffer*&) {
+    return Result::UNSUPPORTED;
+}
+
 static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
     return ((DeviceD3D12&)device).CreateImplementation<FenceD3D12>(fence, initialValue);
 }
@@ -105,10 +127,14 @@ static Result NRI_CALL CreatePipelineLayout(Device& device, const PipelineLayout
 }
 
 static Result NRI_CALL CreateGraphicsPipeline(Device& device, const GraphicsPipelineDesc& graphicsPipelineDesc, Pipeline*& pipeline) {
+    NRI_TRACE_SCOPE("CreateGraphicsPipeline");
+
     return ((DeviceD3D12&)device).CreateImplementation<PipelineD3D12>(pipeline, graphicsPipelineDesc);
 }
 
 static Result NRI_CALL CreateComputePipeline(Device& device, const ComputePipelineDesc& computePipelineDesc, Pipeline*& pipeline) {
+    NRI_TRACE_SCOPE("CreateComputePipeline");
+
     return ((DeviceD3D12&)device).CreateImplementation<PipelineD3D12>(pipeline, computePipelineDesc);
 }
 
@@ -398,6 +424,18 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferD3D12&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawDescNum) {
+    CommandBufferD3D12& commandBufferImpl = (CommandBufferD3D12&)commandBuffer;
+    for (uint32_t i = 0; i < drawDescNum; i++)
+        commandBufferImpl.Draw(drawDescs[i]);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawIndexedDescNum) {
+    CommandBufferD3D12& commandBufferImpl = (CommandBufferD3D12&)commandBuffer;
+    for (uint32_t i = 0; i < drawIndexedDescNum; i++)
+        commandBufferImpl.DrawIndexed(drawIndexedDescs[i]);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferD3D12&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -410,6 +448,9 @@ static void NRI_CALL CmdEndRendering(CommandBuffer& commandBuffer) {
     ((CommandBufferD3D12&)commandBuffer).EndRendering();
 }
 
+static void NRI_CALL CmdExecuteBundle(CommandBuffer&, const CommandBuffer&) {
+}
+
 static void NRI_CALL CmdDispatch(CommandBuffer& commandBuffer, const DispatchDesc& dispatchDesc) {
     ((CommandBufferD3D12&)commandBuffer).Dispatch(dispatchDesc);
 }
@@ -516,6 +557,8 @@ static uint32_t NRI_CALL GetQuerySize(const QueryPool& queryPool) {
 }
 
 static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSubmitDesc) {
+    NRI_TRACE_SCOPE("QueueSubmit");
+
     return ((QueueD3D12&)queue).Submit(queueSubmitDesc);
 }
 
@@ -617,6 +660,9 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateCommandBundle = ::CreateCommandBundle;
+    table.CreateReusableCommandBuffer = ::CreateReusableCommandBuffer;
+    table.CreateCommandBuffers = ::CreateCommandBuffers;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTextureView = ::CreateTextureView;
@@ -676,9 +722,12 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
+    table.CmdExecuteBundle = ::CmdExecuteBundle;
     table.CmdDispatch = ::CmdDispatch;
     table.CmdDispatchIndirect = ::CmdDispatchIndirect;
     table.CmdCopyBuffer = ::CmdCopyBuffer;
@@ -752,11 +801,48 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation
     return QueryVideoMemoryInfoDXGI(luid, memoryLocation, videoMemoryInfo);
 }
 
+static Result NRI_CALL CreateCommandRecorder(Queue& queue, const CommandRecorderDesc& commandRecorderDesc, CommandRecorder*& commandRecorder) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::COMMAND);
+
+    DeviceD3D12& deviceD3D12 = ((QueueD3D12&)queue).GetDevice();
+    CommandRecorderImpl* impl = Allocate<CommandRecorderImpl>(deviceD3D12.GetAllocationCallbacks(), (Device&)deviceD3D12, deviceD3D12.GetCoreInterface(), queue);
+    Result result = impl ? impl->Create(commandRecorderDesc) : Result::OUT_OF_MEMORY;
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        commandRecorder = nullptr;
+    } else
+        commandRecorder = (CommandRecorder*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyCommandRecorder(CommandRecorder* commandRecorder) {
+    Destroy((CommandRecorderImpl*)commandRecorder);
+}
+
+static void NRI_CALL BeginCommandRecorderFrame(CommandRecorder& commandRecorder) {
+    ((CommandRecorderImpl&)commandRecorder).BeginFrame();
+}
+
+static Result NRI_CALL AcquireCommandBuffer(CommandRecorder& commandRecorder, uint32_t threadIndex, uint32_t sortKey, CommandBuffer*& commandBuffer) {
+    return ((CommandRecorderImpl&)commandRecorder).AcquireCommandBuffer(threadIndex, sortKey, commandBuffer);
+}
+
+static Result NRI_CALL SubmitCommandRecorderFrame(CommandRecorder& commandRecorder, const QueueSubmitDesc& queueSubmitDesc) {
+    return ((CommandRecorderImpl&)commandRecorder).Submit(queueSubmitDesc);
+}
+
 Result DeviceD3D12::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.CreateCommandRecorder = ::CreateCommandRecorder;
+    table.DestroyCommandRecorder = ::DestroyCommandRecorder;
+    table.BeginCommandRecorderFrame = ::BeginCommandRecorderFrame;
+    table.AcquireCommandBuffer = ::AcquireCommandBuffer;
+    table.SubmitCommandRecorderFrame = ::SubmitCommandRecorderFrame;
 
     return Result::SUCCESS;
 }
@@ -769,6 +855,8 @@ Result DeviceD3D12::FillFunctionTable(HelperInterface& table) const {
 #if NRI_ENABLE_IMGUI_EXTENSION
 
 static Result NRI_CALL CreateImgui(Device& device, const ImguiDesc& imguiDesc, Imgui*& imgui) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::IMGUI);
+
     DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
     ImguiImpl* impl = Allocate<ImguiImpl>(deviceD3D12.GetAllocationCallbacks(), device, deviceD3D12.GetCoreInterface());
     Result result = impl->Create(imguiDesc);
@@ -871,6 +959,8 @@ Result DeviceD3D12::FillFunctionTable(MeshShaderInterface& table) const {
 #pragma region[  RayTracing  ]
 
 static Result NRI_CALL CreateRayTracingPipeline(Device& device, const RayTracingPipelineDesc& rayTracingPipelineDesc, Pipeline*& pipeline) {
+    NRI_TRACE_SCOPE("CreateRayTracingPipeline");
+
     return ((DeviceD3D12&)device).CreateImplementation<PipelineD3D12>(pipeline, rayTracingPipelineDesc);
 }
 
@@ -1124,6 +1214,8 @@ Result DeviceD3D12::FillFunctionTable(RayTracingInterface& table) const {
 #pragma region[  Streamer  ]
 
 static Result NRI_CALL CreateStreamer(Device& device, const StreamerDesc& streamerDesc, Streamer*& streamer) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::STREAMER);
+
     DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
     StreamerImpl* impl = Allocate<StreamerImpl>(deviceD3D12.GetAllocationCallbacks(), device, deviceD3D12.GetCoreInterface());
     Result result = impl->Create(streamerDesc);
@@ -1232,6 +1324,8 @@ Result DeviceD3D12::FillFunctionTable(SwapChainInterface& table) const {
 #pragma region[  Upscaler  ]
 
 static Result NRI_CALL CreateUpscaler(Device& device, const UpscalerDesc& upscalerDesc, Upscaler*& upscaler) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::UPSCALER);
+
     DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
     UpscalerImpl* impl = Allocate<UpscalerImpl>(deviceD3D12.GetAllocationCallbacks(), device, deviceD3D12.GetCoreInterface());
     Result result = impl->Create(upscalerDesc);
@@ -0,0 +1,40 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct MemoryNONE;
+
+struct BufferNONE final {
+    inline BufferNONE(DeviceNONE& device, const BufferDesc& bufferDesc)
+        : m_Device(device)
+        , m_Desc(bufferDesc) {
+    }
+
+    ~BufferNONE();
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline const BufferDesc& GetDesc() const {
+        return m_Desc;
+    }
+
+    inline uint8_t* GetData() const {
+        return m_Data;
+    }
+
+    void BindMemory(MemoryNONE* memory, uint64_t offset);
+
+    Result Create(); // committed
+
+private:
+    DeviceNONE& m_Device;
+    BufferDesc m_Desc = {};
+    uint8_t* m_Data = nullptr;
+    MemoryNONE* m_Memory = nullptr; // owned
+};
+
+} // namespace nri
@@ -0,0 +1,21 @@
+// © 2021 NVIDIA Corporation
+
+BufferNONE::~BufferNONE() {
+    Destroy(m_Memory);
+}
+
+Result BufferNONE::Create() {
+    m_Memory = Allocate<MemoryNONE>(m_Device.GetAllocationCallbacks(), m_Device);
+    if (!m_Memory)
+        return Result::OUT_OF_MEMORY;
+
+    Result result = m_Memory->Create(m_Desc.size);
+    if (result == Result::SUCCESS)
+        BindMemory(m_Memory, 0);
+
+    return result;
+}
+
+void BufferNONE::BindMemory(MemoryNONE* memory, uint64_t offset) {
+    m_Data = memory->GetData() + offset;
+}
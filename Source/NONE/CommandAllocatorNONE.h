@@ -0,0 +1,20 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct CommandAllocatorNONE final {
+    inline CommandAllocatorNONE(DeviceNONE& device)
+        : m_Device(device) {
+    }
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+private:
+    DeviceNONE& m_Device;
+};
+
+} // namespace nri
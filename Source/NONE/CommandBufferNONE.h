@@ -0,0 +1,90 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+// Transfer commands, which are executed on the CPU at "QueueSubmit" time
+enum class CommandTypeNONE : uint8_t {
+    COPY_BUFFER,
+    COPY_TEXTURE,
+    UPLOAD_BUFFER_TO_TEXTURE,
+    READBACK_TEXTURE_TO_BUFFER,
+    ZERO_BUFFER,
+    CLEAR_STORAGE
+};
+
+struct CommandNONE {
+    const void* dst; // "BufferNONE", "TextureNONE" or "DescriptorNONE"
+    const void* src; // "BufferNONE" or "TextureNONE"
+    uint64_t dstOffset;
+    uint64_t srcOffset;
+    uint64_t size;
+    TextureRegionDesc dstRegion;
+    TextureRegionDesc srcRegion;
+    TextureDataLayoutDesc dataLayout;
+    Color value;
+    CommandTypeNONE type;
+    bool isWholeResource;
+};
+
+struct CommandBufferNONE final {
+    CommandBufferNONE(DeviceNONE& device);
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline void Begin() {
+        m_Commands.clear();
+        m_DrawNum = 0;
+        m_DispatchNum = 0;
+        m_CopySize = 0;
+    }
+
+    inline void OnDraw(uint32_t drawNum) {
+        m_DrawNum += drawNum;
+    }
+
+    inline void OnDispatch(uint32_t dispatchNum) {
+        m_DispatchNum += dispatchNum;
+    }
+
+    // A bundle is "inlined" into the stream, i.e. it's executed on the CPU as a part of the primary command buffer
+    inline void ExecuteBundle(const CommandBufferNONE& commandBundle) {
+        m_Commands.insert(m_Commands.end(), commandBundle.m_Commands.begin(), commandBundle.m_Commands.end());
+        m_DrawNum += commandBundle.m_DrawNum;
+        m_DispatchNum += commandBundle.m_DispatchNum;
+        m_CopySize += commandBundle.m_CopySize;
+    }
+
+    inline uint64_t GetDuration(const NONETimingDesc& timingDesc) const {
+        uint64_t duration = m_DrawNum * timingDesc.drawCost + m_DispatchNum * timingDesc.dispatchCost;
+        if (timingDesc.copyThroughput > 0.0f)
+            duration += (uint64_t)(m_CopySize / timingDesc.copyThroughput); // GB/s = bytes/ns
+
+        return duration;
+    }
+
+    inline const Vector<CommandNONE>& GetCommands() const {
+        return m_Commands;
+    }
+
+    static void Execute(const CommandNONE* commands, size_t commandNum);
+
+    void CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size);
+    void CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
+    void UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout);
+    void ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion);
+    void ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size);
+    void ClearStorage(const ClearStorageDesc& clearStorageDesc);
+
+private:
+    DeviceNONE& m_Device;
+    Vector<CommandNONE> m_Commands;
+    uint64_t m_DrawNum = 0;
+    uint64_t m_DispatchNum = 0;
+    uint64_t m_CopySize = 0; // bytes
+};
+
+} // namespace nri
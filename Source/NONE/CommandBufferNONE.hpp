@@ -0,0 +1,313 @@
+// © 2021 NVIDIA Corporation
+
+struct SubresourceRegionNONE {
+    uint8_t* data; // points to the first block of the region
+    uint32_t rowPitch;
+    uint64_t slicePitch;
+    uint32_t rowSize; // in bytes
+    uint32_t rowNum;  // in blocks
+    uint32_t sliceNum;
+};
+
+static SubresourceRegionNONE GetSubresourceRegion(const TextureNONE& texture, const TextureRegionDesc& region, const TextureRegionDesc& sizeRegion) {
+    const TextureDesc& textureDesc = texture.GetDesc();
+    const FormatProps& formatProps = GetFormatProps(textureDesc.format);
+
+    // The size is taken from "sizeRegion", which is "src" for texture-to-texture copies
+    Dim_t w = sizeRegion.width == WHOLE_SIZE ? GetDimension(GraphicsAPI::NONE, textureDesc, 0, region.mipOffset) - region.x : sizeRegion.width;
+    Dim_t h = sizeRegion.height == WHOLE_SIZE ? GetDimension(GraphicsAPI::NONE, textureDesc, 1, region.mipOffset) - region.y : sizeRegion.height;
+    Dim_t d = sizeRegion.depth == WHOLE_SIZE ? GetDimension(GraphicsAPI::NONE, textureDesc, 2, region.mipOffset) - region.z : sizeRegion.depth;
+
+    SubresourceRegionNONE subresourceRegion = {};
+    subresourceRegion.rowPitch = GetTextureRowPitch(textureDesc, region.mipOffset);
+    subresourceRegion.slicePitch = GetTextureSlicePitch(textureDesc, region.mipOffset);
+    subresourceRegion.rowSize = ((w + formatProps.blockWidth - 1) / formatProps.blockWidth) * formatProps.stride;
+    subresourceRegion.rowNum = (h + formatProps.blockHeight - 1) / formatProps.blockHeight;
+    subresourceRegion.sliceNum = d;
+    subresourceRegion.data = texture.GetSubresourceData(region.mipOffset, region.layerOffset)
+        + region.z * subresourceRegion.slicePitch
+        + (region.y / formatProps.blockHeight) * subresourceRegion.rowPitch
+        + (region.x / formatProps.blockWidth) * formatProps.stride;
+
+    return subresourceRegion;
+}
+
+static inline uint64_t GetSubresourceRegionSize(const SubresourceRegionNONE& subresourceRegion) {
+    return (uint64_t)subresourceRegion.rowSize * subresourceRegion.rowNum * subresourceRegion.sliceNum;
+}
+
+// Rows are merged into a single "memcpy" if both sides are tightly packed
+static void CopyRows(uint8_t* dst, uint32_t dstRowPitch, uint64_t dstSlicePitch, const uint8_t* src, uint32_t srcRowPitch, uint64_t srcSlicePitch, uint32_t rowSize, uint32_t rowNum, uint32_t sliceNum) {
+    uint64_t sliceSize = (uint64_t)rowSize * rowNum;
+
+    if (rowSize == dstRowPitch && rowSize == srcRowPitch) {
+        if (sliceSize == dstSlicePitch && sliceSize == srcSlicePitch)
+            memcpy(dst, src, sliceSize * sliceNum);
+        else {
+            for (uint32_t z = 0; z < sliceNum; z++)
+                memcpy(dst + z * dstSlicePitch, src + z * srcSlicePitch, sliceSize);
+        }
+
+        return;
+    }
+
+    for (uint32_t z = 0; z < sliceNum; z++) {
+        uint8_t* dstSlice = dst + z * dstSlicePitch;
+        const uint8_t* srcSlice = src + z * srcSlicePitch;
+
+        for (uint32_t y = 0; y < rowNum; y++)
+            memcpy(dstSlice + y * dstRowPitch, srcSlice + y * srcRowPitch, rowSize);
+    }
+}
+
+static inline uint16_t FloatToHalf(float x) {
+    uint32_t bits = 0;
+    memcpy(&bits, &x, sizeof(bits));
+
+    uint32_t sign = (bits >> 16) & 0x8000;
+    int32_t exponent = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    if (((bits >> 23) & 0xFF) == 0xFF) // Inf or NaN
+        return (uint16_t)(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+    if (exponent >= 31) // overflow
+        return (uint16_t)(sign | 0x7C00);
+    if (exponent <= 0) { // denormal or zero
+        if (exponent < -10)
+            return (uint16_t)sign;
+
+        mantissa |= 0x800000;
+
+        return (uint16_t)(sign | ((mantissa >> (14 - exponent)) + ((mantissa >> (13 - exponent)) & 1)));
+    }
+
+    return (uint16_t)(sign | (exponent << 10) | ((mantissa >> 13) + ((mantissa >> 12) & 1)));
+}
+
+// See "ClearStorageDesc": integer formats get lower bits, others get a conversion from "FLOAT". Returns "false" for unsupported formats
+static bool PackClearValue(Format format, const Color& value, uint8_t* texel) {
+    const FormatProps& formatProps = GetFormatProps(format);
+    if (formatProps.isCompressed || formatProps.isExpShared || (formatProps.isFloat && formatProps.isPacked))
+        return false;
+
+    uint8_t bits[4] = {formatProps.redBits, formatProps.greenBits, formatProps.blueBits, formatProps.alphaBits};
+    uint32_t ui[4] = {value.ui.x, value.ui.y, value.ui.z, value.ui.w};
+    float f[4] = {value.f.x, value.f.y, value.f.z, value.f.w};
+
+    if (formatProps.isBgr) {
+        std::swap(ui[0], ui[2]);
+        std::swap(f[0], f[2]);
+    }
+
+    uint64_t packed[2] = {};
+    uint32_t bitOffset = 0;
+
+    for (uint32_t i = 0; i < 4 && bits[i]; i++) {
+        uint32_t n = bits[i];
+        uint64_t mask = n == 32 ? 0xFFFFFFFFull : (1ull << n) - 1;
+        uint64_t channel = 0;
+
+        if (formatProps.isInteger)
+            channel = ui[i];
+        else if (formatProps.isFloat && n == 32)
+            memcpy(&channel, &f[i], sizeof(float));
+        else if (formatProps.isFloat && n == 16)
+            channel = FloatToHalf(f[i]);
+        else if (formatProps.isSigned) {
+            float scale = float(mask >> 1);
+            channel = (uint64_t)(int64_t)std::lround(std::clamp(f[i], -1.0f, 1.0f) * scale);
+        } else
+            channel = (uint64_t)std::lround(std::clamp(f[i], 0.0f, 1.0f) * float(mask));
+
+        packed[bitOffset / 64] |= (channel & mask) << (bitOffset % 64);
+        bitOffset += n;
+    }
+
+    memcpy(texel, packed, formatProps.stride);
+
+    return true;
+}
+
+static void FillTexels(uint8_t* dst, uint64_t size, const uint8_t* texel, uint32_t stride) {
+    // Replicate the texel into a wide pattern and fill with "memcpy"s
+    uint8_t pattern[256];
+    uint32_t patternSize = (sizeof(pattern) / stride) * stride;
+
+    for (uint32_t i = 0; i < patternSize; i += stride)
+        memcpy(pattern + i, texel, stride);
+
+    while (size >= patternSize) {
+        memcpy(dst, pattern, patternSize);
+        dst += patternSize;
+        size -= patternSize;
+    }
+
+    memcpy(dst, pattern, (size_t)size);
+}
+
+static void ExecuteClearStorage(const DescriptorNONE& descriptor, const Color& value) {
+    const BufferViewDesc& bufferViewDesc = descriptor.GetBufferViewDesc();
+    const TextureViewDesc& textureViewDesc = descriptor.GetTextureViewDesc();
+
+    if (bufferViewDesc.buffer) {
+        const BufferNONE& buffer = *(BufferNONE*)bufferViewDesc.buffer;
+        uint64_t size = bufferViewDesc.size == WHOLE_SIZE ? buffer.GetDesc().size - bufferViewDesc.offset : bufferViewDesc.size;
+
+        Format format = bufferViewDesc.format == Format::UNKNOWN ? Format::R32_UINT : bufferViewDesc.format; // structured and raw views
+        uint8_t texel[16] = {};
+        if (PackClearValue(format, value, texel))
+            FillTexels(buffer.GetData() + bufferViewDesc.offset, size, texel, GetFormatProps(format).stride);
+    } else if (textureViewDesc.texture) {
+        const TextureNONE& texture = *(TextureNONE*)textureViewDesc.texture;
+        const TextureDesc& textureDesc = texture.GetDesc();
+
+        Format format = textureViewDesc.format == Format::UNKNOWN ? textureDesc.format : textureViewDesc.format;
+        uint8_t texel[16] = {};
+        if (!PackClearValue(format, value, texel))
+            return;
+
+        Dim_t mipNum = textureViewDesc.mipNum == REMAINING ? textureDesc.mipNum - textureViewDesc.mipOffset : textureViewDesc.mipNum;
+        Dim_t layerNum = textureViewDesc.layerNum == REMAINING ? textureDesc.layerNum - textureViewDesc.layerOffset : textureViewDesc.layerNum;
+
+        // Subresources are tightly packed, i.e. a whole mip can be filled at once
+        for (Dim_t layer = textureViewDesc.layerOffset; layer < textureViewDesc.layerOffset + layerNum; layer++) {
+            for (Dim_t mip = textureViewDesc.mipOffset; mip < textureViewDesc.mipOffset + mipNum; mip++)
+                FillTexels(texture.GetSubresourceData(mip, layer), GetTextureMipSize(textureDesc, mip), texel, GetFormatProps(format).stride);
+        }
+    }
+}
+
+CommandBufferNONE::CommandBufferNONE(DeviceNONE& device)
+    : m_Device(device)
+    , m_Commands(device.GetStdAllocator()) {
+}
+
+void CommandBufferNONE::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    CommandNONE& command = m_Commands.emplace_back();
+    command = {};
+    command.type = CommandTypeNONE::COPY_BUFFER;
+    command.dst = &dstBuffer;
+    command.src = &srcBuffer;
+    command.dstOffset = dstOffset;
+    command.srcOffset = srcOffset;
+    command.size = size == WHOLE_SIZE ? ((BufferNONE&)srcBuffer).GetDesc().size : size;
+
+    m_CopySize += command.size;
+}
+
+void CommandBufferNONE::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    CommandNONE& command = m_Commands.emplace_back();
+    command = {};
+    command.type = CommandTypeNONE::COPY_TEXTURE;
+    command.dst = &dstTexture;
+    command.src = &srcTexture;
+    command.isWholeResource = !dstRegion && !srcRegion;
+
+    if (dstRegion)
+        command.dstRegion = *dstRegion;
+    if (srcRegion)
+        command.srcRegion = *srcRegion;
+
+    const TextureNONE& src = (TextureNONE&)srcTexture;
+    if (command.isWholeResource)
+        m_CopySize += GetTextureSize(src.GetDesc());
+    else
+        m_CopySize += GetSubresourceRegionSize(GetSubresourceRegion(src, command.srcRegion, command.srcRegion));
+}
+
+void CommandBufferNONE::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    CommandNONE& command = m_Commands.emplace_back();
+    command = {};
+    command.type = CommandTypeNONE::UPLOAD_BUFFER_TO_TEXTURE;
+    command.dst = &dstTexture;
+    command.src = &srcBuffer;
+    command.dstRegion = dstRegion;
+    command.dataLayout = srcDataLayout;
+
+    m_CopySize += GetSubresourceRegionSize(GetSubresourceRegion((TextureNONE&)dstTexture, dstRegion, dstRegion));
+}
+
+void CommandBufferNONE::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    CommandNONE& command = m_Commands.emplace_back();
+    command = {};
+    command.type = CommandTypeNONE::READBACK_TEXTURE_TO_BUFFER;
+    command.dst = &dstBuffer;
+    command.src = &srcTexture;
+    command.srcRegion = srcRegion;
+    command.dataLayout = dstDataLayout;
+
+    m_CopySize += GetSubresourceRegionSize(GetSubresourceRegion((TextureNONE&)srcTexture, srcRegion, srcRegion));
+}
+
+void CommandBufferNONE::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    CommandNONE& command = m_Commands.emplace_back();
+    command = {};
+    command.type = CommandTypeNONE::ZERO_BUFFER;
+    command.dst = &buffer;
+    command.dstOffset = offset;
+    command.size = size == WHOLE_SIZE ? ((BufferNONE&)buffer).GetDesc().size - offset : size;
+
+    m_CopySize += command.size;
+}
+
+void CommandBufferNONE::ClearStorage(const ClearStorageDesc& clearStorageDesc) {
+    CommandNONE& command = m_Commands.emplace_back();
+    command = {};
+    command.type = CommandTypeNONE::CLEAR_STORAGE;
+    command.dst = clearStorageDesc.descriptor;
+    command.value = clearStorageDesc.value;
+}
+
+void CommandBufferNONE::Execute(const CommandNONE* commands, size_t commandNum) {
+    for (size_t i = 0; i < commandNum; i++) {
+        const CommandNONE& command = commands[i];
+
+        switch (command.type) {
+            case CommandTypeNONE::COPY_BUFFER: {
+                const BufferNONE& dst = *(BufferNONE*)command.dst;
+                const BufferNONE& src = *(BufferNONE*)command.src;
+
+                memmove(dst.GetData() + command.dstOffset, src.GetData() + command.srcOffset, (size_t)command.size);
+            } break;
+            case CommandTypeNONE::COPY_TEXTURE: {
+                const TextureNONE& dst = *(TextureNONE*)command.dst;
+                const TextureNONE& src = *(TextureNONE*)command.src;
+
+                if (command.isWholeResource)
+                    memcpy(dst.GetData(), src.GetData(), (size_t)std::min(GetTextureSize(dst.GetDesc()), GetTextureSize(src.GetDesc())));
+                else {
+                    SubresourceRegionNONE dstRegion = GetSubresourceRegion(dst, command.dstRegion, command.srcRegion);
+                    SubresourceRegionNONE srcRegion = GetSubresourceRegion(src, command.srcRegion, command.srcRegion);
+
+                    CopyRows(dstRegion.data, dstRegion.rowPitch, dstRegion.slicePitch, srcRegion.data, srcRegion.rowPitch, srcRegion.slicePitch, srcRegion.rowSize, srcRegion.rowNum, srcRegion.sliceNum);
+                }
+            } break;
+            case CommandTypeNONE::UPLOAD_BUFFER_TO_TEXTURE: {
+                const TextureNONE& dst = *(TextureNONE*)command.dst;
+                const BufferNONE& src = *(BufferNONE*)command.src;
+
+                SubresourceRegionNONE dstRegion = GetSubresourceRegion(dst, command.dstRegion, command.dstRegion);
+                const uint8_t* srcData = src.GetData() + command.dataLayout.offset;
+
+                CopyRows(dstRegion.data, dstRegion.rowPitch, dstRegion.slicePitch, srcData, command.dataLayout.rowPitch, command.dataLayout.slicePitch, dstRegion.rowSize, dstRegion.rowNum, dstRegion.sliceNum);
+            } break;
+            case CommandTypeNONE::READBACK_TEXTURE_TO_BUFFER: {
+                const BufferNONE& dst = *(BufferNONE*)command.dst;
+                const TextureNONE& src = *(TextureNONE*)command.src;
+
+                SubresourceRegionNONE srcRegion = GetSubresourceRegion(src, command.srcRegion, command.srcRegion);
+                uint8_t* dstData = dst.GetData() + command.dataLayout.offset;
+
+                CopyRows(dstData, command.dataLayout.rowPitch, command.dataLayout.slicePitch, srcRegion.data, srcRegion.rowPitch, srcRegion.slicePitch, srcRegion.rowSize, srcRegion.rowNum, srcRegion.sliceNum);
+            } break;
+            case CommandTypeNONE::ZERO_BUFFER: {
+                const BufferNONE& dst = *(BufferNONE*)command.dst;
+
+                memset(dst.GetData() + command.dstOffset, 0, (size_t)command.size);
+            } break;
+            case CommandTypeNONE::CLEAR_STORAGE:
+                ExecuteClearStorage(*(DescriptorNONE*)command.dst, command.value);
+                break;
+        }
+    }
+}
@@ -0,0 +1,40 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct DescriptorNONE final {
+    inline DescriptorNONE(DeviceNONE& device, const BufferViewDesc& bufferViewDesc)
+        : m_Device(device)
+        , m_BufferViewDesc(bufferViewDesc) {
+    }
+
+    inline DescriptorNONE(DeviceNONE& device, const TextureViewDesc& textureViewDesc)
+        : m_Device(device)
+        , m_TextureViewDesc(textureViewDesc) {
+    }
+
+    inline DescriptorNONE(DeviceNONE& device, const SamplerDesc&)
+        : m_Device(device) {
+    }
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline const BufferViewDesc& GetBufferViewDesc() const {
+        return m_BufferViewDesc;
+    }
+
+    inline const TextureViewDesc& GetTextureViewDesc() const {
+        return m_TextureViewDesc;
+    }
+
+private:
+    DeviceNONE& m_Device;
+    BufferViewDesc m_BufferViewDesc = {};   // buffer views only
+    TextureViewDesc m_TextureViewDesc = {}; // texture views only
+};
+
+} // namespace nri
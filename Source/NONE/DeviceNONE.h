@@ -0,0 +1,102 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct FenceNONE;
+struct QueueNONE;
+
+struct DeviceNONE final : public DeviceBase {
+    DeviceNONE(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, const DeviceCreationDesc& desc);
+    ~DeviceNONE();
+
+    inline bool IsHostEmulation() const {
+        return m_IsHostEmulation;
+    }
+
+    inline bool IsMemoryZeroInitializationEnabled() const {
+        return m_IsMemoryZeroInitializationEnabled;
+    }
+
+    inline bool IsTimingEnabled() const {
+        return m_IsHostEmulation && (m_Timing.submitLatency || m_Timing.drawCost || m_Timing.dispatchCost || m_Timing.copyThroughput > 0.0f);
+    }
+
+    inline const NONETimingDesc& GetTimingDesc() const {
+        return m_Timing;
+    }
+
+    inline std::mutex& GetTimingLock() {
+        return m_TimingLock;
+    }
+
+    inline void OnSubmit() {
+        m_SubmitEvent.notify_one();
+    }
+
+    inline const CoreInterface& GetCoreInterface() const {
+        return m_iCore;
+    }
+
+    inline QueueNONE* GetQueue(QueueType queueType, uint32_t queueIndex) const {
+        return m_Queues[(uint32_t)queueType][queueIndex];
+    }
+
+    inline void OnMemoryAllocated(int64_t size) {
+        m_AllocatedMemorySize.fetch_add((uint64_t)size, std::memory_order_relaxed);
+    }
+
+    inline uint64_t GetAllocatedMemorySize() const {
+        return m_AllocatedMemorySize.load(std::memory_order_relaxed);
+    }
+
+    Result Create();
+    void Wait(const FenceNONE& fence, uint64_t value);
+    void WaitIdle(const QueueNONE* queue); // all queues if "queue == nullptr"
+
+    //================================================================================================================
+    // DeviceBase
+    //================================================================================================================
+
+    inline const DeviceDesc& GetDesc() const override {
+        return m_Desc;
+    }
+
+    inline void Destruct() override {
+        Destroy(GetAllocationCallbacks(), this);
+    }
+
+    Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(DeviceGeneratedCommandsInterface& table) const override;
+    Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(LowLatencyInterface& table) const override;
+    Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(StreamerInterface& table) const override;
+    Result FillFunctionTable(SwapChainInterface& table) const override;
+    Result FillFunctionTable(UpscalerInterface& table) const override;
+
+#if NRI_ENABLE_IMGUI_EXTENSION
+    Result FillFunctionTable(ImguiInterface& table) const override;
+#endif
+
+private:
+    void SimulateGPU();
+
+private:
+    DeviceDesc m_Desc = {};
+    CoreInterface m_iCore = {};
+    NONETimingDesc m_Timing = {};
+    QueueNONE* m_Queues[(uint32_t)QueueType::MAX_NUM][QUEUE_NUM] = {};
+    std::atomic_uint64_t m_AllocatedMemorySize = 0;
+    std::thread m_TimingThread;
+    std::mutex m_TimingLock;
+    std::condition_variable m_SubmitEvent;
+    std::condition_variable m_CompleteEvent;
+    bool m_IsTimingThreadExiting = false;
+    bool m_IsHostEmulation = false;
+    bool m_IsMemoryZeroInitializationEnabled = false;
+};
+
+} // namespace nri
@@ -0,0 +1,261 @@
+// © 2021 NVIDIA Corporation
+
+DeviceNONE::DeviceNONE(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, const DeviceCreationDesc& desc)
+    : DeviceBase(callbacks, allocationCallbacks)
+    , m_Timing(desc.noneTiming)
+    , m_IsHostEmulation(desc.enableNONEHostEmulation)
+    , m_IsMemoryZeroInitializationEnabled(desc.enableMemoryZeroInitialization) {
+    if (desc.adapterDesc)
+        m_Desc.adapterDesc = *desc.adapterDesc;
+
+    for (uint32_t i = 0; i < (uint32_t)QueueType::MAX_NUM; i++)
+        m_Desc.adapterDesc.queueNum[i] = QUEUE_NUM;
+
+    m_Desc.graphicsAPI = GraphicsAPI::NONE;
+    m_Desc.nriVersion = NRI_VERSION;
+    m_Desc.shaderModel = 69;
+
+    m_Desc.viewport.maxNum = 16;
+    m_Desc.viewport.boundsMin = -32768;
+    m_Desc.viewport.boundsMax = 32767;
+
+    m_Desc.dimensions.attachmentMaxDim = 16384;
+    m_Desc.dimensions.attachmentLayerMaxNum = 2048;
+    m_Desc.dimensions.texture1DMaxDim = 16384;
+    m_Desc.dimensions.texture2DMaxDim = 16384;
+    m_Desc.dimensions.texture3DMaxDim = 16384;
+    m_Desc.dimensions.textureLayerMaxNum = 16384;
+    m_Desc.dimensions.typedBufferMaxDim = uint32_t(-1);
+
+    m_Desc.precision.viewportBits = 8;
+    m_Desc.precision.subPixelBits = 8;
+    m_Desc.precision.subTexelBits = 8;
+    m_Desc.precision.mipmapBits = 8;
+
+    m_Desc.memory.deviceUploadHeapSize = 256 * 1024 * 1024;
+    m_Desc.memory.allocationMaxNum = uint32_t(-1);
+    m_Desc.memory.samplerAllocationMaxNum = 4096;
+    m_Desc.memory.constantBufferMaxRange = 64 * 1024;
+    m_Desc.memory.storageBufferMaxRange = uint32_t(-1);
+    m_Desc.memory.bufferTextureGranularity = 1;
+    m_Desc.memory.bufferMaxSize = uint32_t(-1);
+
+    m_Desc.memoryAlignment.uploadBufferTextureRow = 1;
+    m_Desc.memoryAlignment.uploadBufferTextureSlice = 1;
+    m_Desc.memoryAlignment.bufferShaderResourceOffset = 1;
+    m_Desc.memoryAlignment.constantBufferOffset = 1;
+    m_Desc.memoryAlignment.scratchBufferOffset = 1;
+    m_Desc.memoryAlignment.shaderBindingTable = 1;
+    m_Desc.memoryAlignment.accelerationStructureOffset = 1;
+    m_Desc.memoryAlignment.micromapOffset = 1;
+
+    m_Desc.pipelineLayout.descriptorSetMaxNum = 64;
+    m_Desc.pipelineLayout.rootConstantMaxSize = 256;
+    m_Desc.pipelineLayout.rootDescriptorMaxNum = 64;
+
+    m_Desc.descriptorSet.samplerMaxNum = 1000000;
+    m_Desc.descriptorSet.constantBufferMaxNum = 1000000;
+    m_Desc.descriptorSet.storageBufferMaxNum = 1000000;
+    m_Desc.descriptorSet.textureMaxNum = 1000000;
+    m_Desc.descriptorSet.storageTextureMaxNum = 1000000;
+
+    m_Desc.descriptorSet.updateAfterSet.samplerMaxNum = m_Desc.descriptorSet.samplerMaxNum;
+    m_Desc.descriptorSet.updateAfterSet.constantBufferMaxNum = m_Desc.descriptorSet.constantBufferMaxNum;
+    m_Desc.descriptorSet.updateAfterSet.storageBufferMaxNum = m_Desc.descriptorSet.storageBufferMaxNum;
+    m_Desc.descriptorSet.updateAfterSet.textureMaxNum = m_Desc.descriptorSet.textureMaxNum;
+    m_Desc.descriptorSet.updateAfterSet.storageTextureMaxNum = m_Desc.descriptorSet.storageTextureMaxNum;
+
+    m_Desc.shaderStage.descriptorSamplerMaxNum = 1000000;
+    m_Desc.shaderStage.descriptorConstantBufferMaxNum = 1000000;
+    m_Desc.shaderStage.descriptorStorageBufferMaxNum = 1000000;
+    m_Desc.shaderStage.descriptorTextureMaxNum = 1000000;
+    m_Desc.shaderStage.descriptorStorageTextureMaxNum = 1000000;
+    m_Desc.shaderStage.resourceMaxNum = 1000000;
+
+    m_Desc.shaderStage.updateAfterSet.descriptorSamplerMaxNum = m_Desc.shaderStage.descriptorSamplerMaxNum;
+    m_Desc.shaderStage.updateAfterSet.descriptorConstantBufferMaxNum = m_Desc.shaderStage.descriptorConstantBufferMaxNum;
+    m_Desc.shaderStage.updateAfterSet.descriptorStorageBufferMaxNum = m_Desc.shaderStage.descriptorStorageBufferMaxNum;
+    m_Desc.shaderStage.updateAfterSet.descriptorTextureMaxNum = m_Desc.shaderStage.descriptorTextureMaxNum;
+    m_Desc.shaderStage.updateAfterSet.descriptorStorageTextureMaxNum = m_Desc.shaderStage.descriptorStorageTextureMaxNum;
+    m_Desc.shaderStage.updateAfterSet.resourceMaxNum = m_Desc.shaderStage.resourceMaxNum;
+
+    m_Desc.shaderStage.vertex.attributeMaxNum = 32;
+    m_Desc.shaderStage.vertex.streamMaxNum = 32;
+    m_Desc.shaderStage.vertex.outputComponentMaxNum = 128;
+
+    m_Desc.shaderStage.tesselationControl.generationMaxLevel = 64.0f;
+    m_Desc.shaderStage.tesselationControl.patchPointMaxNum = 32;
+    m_Desc.shaderStage.tesselationControl.perVertexInputComponentMaxNum = 128;
+    m_Desc.shaderStage.tesselationControl.perVertexOutputComponentMaxNum = 128;
+    m_Desc.shaderStage.tesselationControl.perPatchOutputComponentMaxNum = 128;
+    m_Desc.shaderStage.tesselationControl.totalOutputComponentMaxNum = 1000000;
+
+    m_Desc.shaderStage.tesselationEvaluation.inputComponentMaxNum = 128;
+    m_Desc.shaderStage.tesselationEvaluation.outputComponentMaxNum = 128;
+
+    m_Desc.shaderStage.geometry.invocationMaxNum = 32;
+    m_Desc.shaderStage.geometry.inputComponentMaxNum = 128;
+    m_Desc.shaderStage.geometry.outputComponentMaxNum = 128;
+    m_Desc.shaderStage.geometry.outputVertexMaxNum = 1024;
+    m_Desc.shaderStage.geometry.totalOutputComponentMaxNum = 1024;
+
+    m_Desc.shaderStage.fragment.inputComponentMaxNum = 128;
+    m_Desc.shaderStage.fragment.attachmentMaxNum = 8;
+    m_Desc.shaderStage.fragment.dualSourceAttachmentMaxNum = 1;
+
+    m_Desc.shaderStage.compute.dispatchMaxDim[0] = (uint32_t)(-1);
+    m_Desc.shaderStage.compute.dispatchMaxDim[1] = (uint32_t)(-1);
+    m_Desc.shaderStage.compute.dispatchMaxDim[2] = (uint32_t)(-1);
+    m_Desc.shaderStage.compute.workGroupInvocationMaxNum = (uint32_t)(-1);
+    m_Desc.shaderStage.compute.workGroupMaxDim[0] = (uint32_t)(-1);
+    m_Desc.shaderStage.compute.workGroupMaxDim[1] = (uint32_t)(-1);
+    m_Desc.shaderStage.compute.workGroupMaxDim[2] = (uint32_t)(-1);
+    m_Desc.shaderStage.compute.sharedMemoryMaxSize = (uint32_t)(-1);
+
+    m_Desc.shaderStage.task.dispatchWorkGroupMaxNum = (uint32_t)(-1);
+    m_Desc.shaderStage.task.dispatchMaxDim[0] = (uint32_t)(-1);
+    m_Desc.shaderStage.task.dispatchMaxDim[1] = (uint32_t)(-1);
+    m_Desc.shaderStage.task.dispatchMaxDim[2] = (uint32_t)(-1);
+    m_Desc.shaderStage.task.workGroupInvocationMaxNum = (uint32_t)(-1);
+    m_Desc.shaderStage.task.workGroupMaxDim[0] = (uint32_t)(-1);
+    m_Desc.shaderStage.task.workGroupMaxDim[1] = (uint32_t)(-1);
+    m_Desc.shaderStage.task.workGroupMaxDim[2] = (uint32_t)(-1);
+    m_Desc.shaderStage.task.sharedMemoryMaxSize = (uint32_t)(-1);
+    m_Desc.shaderStage.task.payloadMaxSize = (uint32_t)(-1);
+
+    m_Desc.shaderStage.mesh.dispatchWorkGroupMaxNum = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.dispatchMaxDim[0] = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.dispatchMaxDim[1] = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.dispatchMaxDim[2] = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.workGroupInvocationMaxNum = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.workGroupMaxDim[0] = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.workGroupMaxDim[1] = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.workGroupMaxDim[2] = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.sharedMemoryMaxSize = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.outputVerticesMaxNum = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.outputPrimitiveMaxNum = (uint32_t)(-1);
+    m_Desc.shaderStage.mesh.outputComponentMaxNum = (uint32_t)(-1);
+
+    m_Desc.shaderStage.rayTracing.shaderGroupIdentifierSize = 32;
+    m_Desc.shaderStage.rayTracing.shaderBindingTableMaxStride = (uint32_t)(-1);
+    m_Desc.shaderStage.rayTracing.recursionMaxDepth = 31;
+
+    m_Desc.accelerationStructure.primitiveMaxNum = (uint32_t)(-1);
+    m_Desc.accelerationStructure.geometryMaxNum = (uint32_t)(-1);
+    m_Desc.accelerationStructure.instanceMaxNum = (uint32_t)(-1);
+    m_Desc.accelerationStructure.micromapSubdivisionMaxLevel = 12;
+
+    m_Desc.wave.laneMinNum = 32;
+    m_Desc.wave.laneMaxNum = 32;
+    m_Desc.wave.waveOpsStages = StageBits::ALL_SHADERS;
+    m_Desc.wave.derivativeOpsStages = StageBits::ALL_SHADERS;
+    m_Desc.wave.quadOpsStages = StageBits::ALL_SHADERS;
+
+    m_Desc.other.timestampFrequencyHz = 1;
+    m_Desc.other.drawIndirectMaxNum = uint32_t(-1);
+    m_Desc.other.samplerLodBiasMax = 16.0f;
+    m_Desc.other.samplerAnisotropyMax = 16;
+    m_Desc.other.texelOffsetMin = -8;
+    m_Desc.other.texelOffsetMax = 7;
+    m_Desc.other.texelGatherOffsetMin = -8;
+    m_Desc.other.texelGatherOffsetMax = 7;
+    m_Desc.other.clipDistanceMaxNum = 8;
+    m_Desc.other.cullDistanceMaxNum = 8;
+    m_Desc.other.combinedClipAndCullDistanceMaxNum = 8;
+    m_Desc.other.viewMaxNum = 4;
+    m_Desc.other.shadingRateAttachmentTileSize = 16;
+
+    memset(&m_Desc.tiers, 0xFF, sizeof(m_Desc.tiers));
+    memset(&m_Desc.features, 0xFF, sizeof(m_Desc.features));
+    memset(&m_Desc.shaderFeatures, 0xFF, sizeof(m_Desc.shaderFeatures));
+}
+
+DeviceNONE::~DeviceNONE() {
+    if (m_TimingThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_TimingLock);
+            m_IsTimingThreadExiting = true;
+        }
+
+        m_SubmitEvent.notify_one();
+        m_TimingThread.join();
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)QueueType::MAX_NUM; i++) {
+        for (uint32_t j = 0; j < QUEUE_NUM; j++)
+            Destroy(m_Queues[i][j]);
+    }
+}
+
+Result DeviceNONE::Create() {
+    if (!m_IsHostEmulation)
+        return Result::SUCCESS;
+
+    for (uint32_t i = 0; i < (uint32_t)QueueType::MAX_NUM; i++) {
+        for (uint32_t j = 0; j < QUEUE_NUM; j++) {
+            m_Queues[i][j] = Allocate<QueueNONE>(GetAllocationCallbacks(), *this, (QueueType)i);
+            if (!m_Queues[i][j])
+                return Result::OUT_OF_MEMORY;
+        }
+    }
+
+    // Submissions complete in the background, if the timing model is in use
+    if (IsTimingEnabled())
+        m_TimingThread = std::thread(&DeviceNONE::SimulateGPU, this);
+
+    return FillFunctionTable(m_iCore);
+}
+
+void DeviceNONE::SimulateGPU() {
+    std::unique_lock<std::mutex> lock(m_TimingLock);
+
+    while (!m_IsTimingThreadExiting) {
+        uint64_t now = GetTimeNs();
+        uint64_t nextTime = uint64_t(-1);
+        bool isCompleted = false;
+
+        for (uint32_t i = 0; i < (uint32_t)QueueType::MAX_NUM; i++) {
+            for (uint32_t j = 0; j < QUEUE_NUM; j++)
+                isCompleted |= m_Queues[i][j]->Simulate(now, nextTime);
+        }
+
+        // Signaled fences can unblock submissions on other queues
+        if (isCompleted) {
+            m_CompleteEvent.notify_all();
+            continue;
+        }
+
+        if (nextTime == uint64_t(-1))
+            m_SubmitEvent.wait(lock);
+        else
+            m_SubmitEvent.wait_until(lock, std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(nextTime))));
+    }
+}
+
+void DeviceNONE::Wait(const FenceNONE& fence, uint64_t value) {
+    if (!IsTimingEnabled())
+        return;
+
+    std::unique_lock<std::mutex> lock(m_TimingLock);
+    m_CompleteEvent.wait(lock, [&]() { return fence.GetValue() >= value; });
+}
+
+void DeviceNONE::WaitIdle(const QueueNONE* queue) {
+    if (!IsTimingEnabled())
+        return;
+
+    std::unique_lock<std::mutex> lock(m_TimingLock);
+    m_CompleteEvent.wait(lock, [&]() {
+        if (queue)
+            return queue->IsIdle();
+
+        for (uint32_t i = 0; i < (uint32_t)QueueType::MAX_NUM; i++) {
+            for (uint32_t j = 0; j < QUEUE_NUM; j++) {
+                if (!m_Queues[i][j]->IsIdle())
+                    return false;
+            }
+        }
+
+        return true;
+    });
+}
@@ -0,0 +1,32 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct FenceNONE final {
+    inline FenceNONE(DeviceNONE& device, uint64_t initialValue)
+        : m_Device(device)
+        , m_Value(initialValue) {
+    }
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline uint64_t GetValue() const {
+        return m_Value.load(std::memory_order_acquire);
+    }
+
+    inline void Signal(uint64_t value) {
+        uint64_t prevValue = m_Value.load(std::memory_order_relaxed);
+        while (prevValue < value && !m_Value.compare_exchange_weak(prevValue, value, std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+
+private:
+    DeviceNONE& m_Device;
+    std::atomic_uint64_t m_Value;
+};
+
+} // namespace nri
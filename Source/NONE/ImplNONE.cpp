@@ -1,222 +1,51 @@
 // © 2021 NVIDIA Corporation
 
-#include "SharedExternal.h"
+#include "SharedNONE.h"
+
+#include "BufferNONE.h"
+#include "CommandAllocatorNONE.h"
+#include "CommandBufferNONE.h"
+#include "DescriptorNONE.h"
+#include "FenceNONE.h"
+#include "IndirectCommandLayoutNONE.h"
+#include "MemoryNONE.h"
+#include "QueueNONE.h"
+#include "SwapChainNONE.h"
+#include "TextureNONE.h"
+
+#include "HelperInterface.h"
+#include "ImguiInterface.h"
+#include "StreamerInterface.h"
 
 using namespace nri;
 
+#include "BufferNONE.hpp"
+#include "CommandBufferNONE.hpp"
+#include "DeviceNONE.hpp"
+#include "MemoryNONE.hpp"
+#include "QueueNONE.hpp"
+#include "SwapChainNONE.hpp"
+#include "TextureNONE.hpp"
+
 template <typename T>
 constexpr T* DummyObject() {
     return (T*)(size_t)(1);
 }
 
-struct DeviceNONE final : public DeviceBase {
-    inline DeviceNONE(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, const AdapterDesc* adapterDesc)
-        : DeviceBase(callbacks, allocationCallbacks) {
-        if (adapterDesc)
-            m_Desc.adapterDesc = *adapterDesc;
-
-        for (uint32_t i = 0; i < (uint32_t)QueueType::MAX_NUM; i++)
-            m_Desc.adapterDesc.queueNum[i] = 4;
-
-        m_Desc.graphicsAPI = GraphicsAPI::NONE;
-        m_Desc.nriVersion = NRI_VERSION;
-        m_Desc.shaderModel = 69;
-
-        m_Desc.viewport.maxNum = 16;
-        m_Desc.viewport.boundsMin = -32768;
-        m_Desc.viewport.boundsMax = 32767;
-
-        m_Desc.dimensions.attachmentMaxDim = 16384;
-        m_Desc.dimensions.attachmentLayerMaxNum = 2048;
-        m_Desc.dimensions.texture1DMaxDim = 16384;
-        m_Desc.dimensions.texture2DMaxDim = 16384;
-        m_Desc.dimensions.texture3DMaxDim = 16384;
-        m_Desc.dimensions.textureLayerMaxNum = 16384;
-        m_Desc.dimensions.typedBufferMaxDim = uint32_t(-1);
-
-        m_Desc.precision.viewportBits = 8;
-        m_Desc.precision.subPixelBits = 8;
-        m_Desc.precision.subTexelBits = 8;
-        m_Desc.precision.mipmapBits = 8;
-
-        m_Desc.memory.deviceUploadHeapSize = 256 * 1024 * 1024;
-        m_Desc.memory.allocationMaxNum = uint32_t(-1);
-        m_Desc.memory.samplerAllocationMaxNum = 4096;
-        m_Desc.memory.constantBufferMaxRange = 64 * 1024;
-        m_Desc.memory.storageBufferMaxRange = uint32_t(-1);
-        m_Desc.memory.bufferTextureGranularity = 1;
-        m_Desc.memory.bufferMaxSize = uint32_t(-1);
-
-        m_Desc.memoryAlignment.uploadBufferTextureRow = 1;
-        m_Desc.memoryAlignment.uploadBufferTextureSlice = 1;
-        m_Desc.memoryAlignment.bufferShaderResourceOffset = 1;
-        m_Desc.memoryAlignment.constantBufferOffset = 1;
-        m_Desc.memoryAlignment.scratchBufferOffset = 1;
-        m_Desc.memoryAlignment.shaderBindingTable = 1;
-        m_Desc.memoryAlignment.accelerationStructureOffset = 1;
-        m_Desc.memoryAlignment.micromapOffset = 1;
-
-        m_Desc.pipelineLayout.descriptorSetMaxNum = 64;
-        m_Desc.pipelineLayout.rootConstantMaxSize = 256;
-        m_Desc.pipelineLayout.rootDescriptorMaxNum = 64;
-
-        m_Desc.descriptorSet.samplerMaxNum = 1000000;
-        m_Desc.descriptorSet.constantBufferMaxNum = 1000000;
-        m_Desc.descriptorSet.storageBufferMaxNum = 1000000;
-        m_Desc.descriptorSet.textureMaxNum = 1000000;
-        m_Desc.descriptorSet.storageTextureMaxNum = 1000000;
-
-        m_Desc.descriptorSet.updateAfterSet.samplerMaxNum = m_Desc.descriptorSet.samplerMaxNum;
-        m_Desc.descriptorSet.updateAfterSet.constantBufferMaxNum = m_Desc.descriptorSet.constantBufferMaxNum;
-        m_Desc.descriptorSet.updateAfterSet.storageBufferMaxNum = m_Desc.descriptorSet.storageBufferMaxNum;
-        m_Desc.descriptorSet.updateAfterSet.textureMaxNum = m_Desc.descriptorSet.textureMaxNum;
-        m_Desc.descriptorSet.updateAfterSet.storageTextureMaxNum = m_Desc.descriptorSet.storageTextureMaxNum;
-
-        m_Desc.shaderStage.descriptorSamplerMaxNum = 1000000;
-        m_Desc.shaderStage.descriptorConstantBufferMaxNum = 1000000;
-        m_Desc.shaderStage.descriptorStorageBufferMaxNum = 1000000;
-        m_Desc.shaderStage.descriptorTextureMaxNum = 1000000;
-        m_Desc.shaderStage.descriptorStorageTextureMaxNum = 1000000;
-        m_Desc.shaderStage.resourceMaxNum = 1000000;
-
-        m_Desc.shaderStage.updateAfterSet.descriptorSamplerMaxNum = m_Desc.shaderStage.descriptorSamplerMaxNum;
-        m_Desc.shaderStage.updateAfterSet.descriptorConstantBufferMaxNum = m_Desc.shaderStage.descriptorConstantBufferMaxNum;
-        m_Desc.shaderStage.updateAfterSet.descriptorStorageBufferMaxNum = m_Desc.shaderStage.descriptorStorageBufferMaxNum;
-        m_Desc.shaderStage.updateAfterSet.descriptorTextureMaxNum = m_Desc.shaderStage.descriptorTextureMaxNum;
-        m_Desc.shaderStage.updateAfterSet.descriptorStorageTextureMaxNum = m_Desc.shaderStage.descriptorStorageTextureMaxNum;
-        m_Desc.shaderStage.updateAfterSet.resourceMaxNum = m_Desc.shaderStage.resourceMaxNum;
-
-        m_Desc.shaderStage.vertex.attributeMaxNum = 32;
-        m_Desc.shaderStage.vertex.streamMaxNum = 32;
-        m_Desc.shaderStage.vertex.outputComponentMaxNum = 128;
-
-        m_Desc.shaderStage.tesselationControl.generationMaxLevel = 64.0f;
-        m_Desc.shaderStage.tesselationControl.patchPointMaxNum = 32;
-        m_Desc.shaderStage.tesselationControl.perVertexInputComponentMaxNum = 128;
-        m_Desc.shaderStage.tesselationControl.perVertexOutputComponentMaxNum = 128;
-        m_Desc.shaderStage.tesselationControl.perPatchOutputComponentMaxNum = 128;
-        m_Desc.shaderStage.tesselationControl.totalOutputComponentMaxNum = 1000000;
-
-        m_Desc.shaderStage.tesselationEvaluation.inputComponentMaxNum = 128;
-        m_Desc.shaderStage.tesselationEvaluation.outputComponentMaxNum = 128;
-
-        m_Desc.shaderStage.geometry.invocationMaxNum = 32;
-        m_Desc.shaderStage.geometry.inputComponentMaxNum = 128;
-        m_Desc.shaderStage.geometry.outputComponentMaxNum = 128;
-        m_Desc.shaderStage.geometry.outputVertexMaxNum = 1024;
-        m_Desc.shaderStage.geometry.totalOutputComponentMaxNum = 1024;
-
-        m_Desc.shaderStage.fragment.inputComponentMaxNum = 128;
-        m_Desc.shaderStage.fragment.attachmentMaxNum = 8;
-        m_Desc.shaderStage.fragment.dualSourceAttachmentMaxNum = 1;
-
-        m_Desc.shaderStage.compute.dispatchMaxDim[0] = (uint32_t)(-1);
-        m_Desc.shaderStage.compute.dispatchMaxDim[1] = (uint32_t)(-1);
-        m_Desc.shaderStage.compute.dispatchMaxDim[2] = (uint32_t)(-1);
-        m_Desc.shaderStage.compute.workGroupInvocationMaxNum = (uint32_t)(-1);
-        m_Desc.shaderStage.compute.workGroupMaxDim[0] = (uint32_t)(-1);
-        m_Desc.shaderStage.compute.workGroupMaxDim[1] = (uint32_t)(-1);
-        m_Desc.shaderStage.compute.workGroupMaxDim[2] = (uint32_t)(-1);
-        m_Desc.shaderStage.compute.sharedMemoryMaxSize = (uint32_t)(-1);
-
-        m_Desc.shaderStage.task.dispatchWorkGroupMaxNum = (uint32_t)(-1);
-        m_Desc.shaderStage.task.dispatchMaxDim[0] = (uint32_t)(-1);
-        m_Desc.shaderStage.task.dispatchMaxDim[1] = (uint32_t)(-1);
-        m_Desc.shaderStage.task.dispatchMaxDim[2] = (uint32_t)(-1);
-        m_Desc.shaderStage.task.workGroupInvocationMaxNum = (uint32_t)(-1);
-        m_Desc.shaderStage.task.workGroupMaxDim[0] = (uint32_t)(-1);
-        m_Desc.shaderStage.task.workGroupMaxDim[1] = (uint32_t)(-1);
-        m_Desc.shaderStage.task.workGroupMaxDim[2] = (uint32_t)(-1);
-        m_Desc.shaderStage.task.sharedMemoryMaxSize = (uint32_t)(-1);
-        m_Desc.shaderStage.task.payloadMaxSize = (uint32_t)(-1);
-
-        m_Desc.shaderStage.mesh.dispatchWorkGroupMaxNum = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.dispatchMaxDim[0] = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.dispatchMaxDim[1] = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.dispatchMaxDim[2] = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.workGroupInvocationMaxNum = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.workGroupMaxDim[0] = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.workGroupMaxDim[1] = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.workGroupMaxDim[2] = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.sharedMemoryMaxSize = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.outputVerticesMaxNum = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.outputPrimitiveMaxNum = (uint32_t)(-1);
-        m_Desc.shaderStage.mesh.outputComponentMaxNum = (uint32_t)(-1);
-
-        m_Desc.shaderStage.rayTracing.shaderGroupIdentifierSize = 32;
-        m_Desc.shaderStage.rayTracing.shaderBindingTableMaxStride = (uint32_t)(-1);
-        m_Desc.shaderStage.rayTracing.recursionMaxDepth = 31;
-
-        m_Desc.accelerationStructure.primitiveMaxNum = (uint32_t)(-1);
-        m_Desc.accelerationStructure.geometryMaxNum = (uint32_t)(-1);
-        m_Desc.accelerationStructure.instanceMaxNum = (uint32_t)(-1);
-        m_Desc.accelerationStructure.micromapSubdivisionMaxLevel = 12;
-
-        m_Desc.wave.laneMinNum = 32;
-        m_Desc.wave.laneMaxNum = 32;
-        m_Desc.wave.waveOpsStages = StageBits::ALL_SHADERS;
-        m_Desc.wave.derivativeOpsStages = StageBits::ALL_SHADERS;
-        m_Desc.wave.quadOpsStages = StageBits::ALL_SHADERS;
-
-        m_Desc.other.timestampFrequencyHz = 1;
-        m_Desc.other.drawIndirectMaxNum = uint32_t(-1);
-        m_Desc.other.samplerLodBiasMax = 16.0f;
-        m_Desc.other.samplerAnisotropyMax = 16;
-        m_Desc.other.texelOffsetMin = -8;
-        m_Desc.other.texelOffsetMax = 7;
-        m_Desc.other.texelGatherOffsetMin = -8;
-        m_Desc.other.texelGatherOffsetMax = 7;
-        m_Desc.other.clipDistanceMaxNum = 8;
-        m_Desc.other.cullDistanceMaxNum = 8;
-        m_Desc.other.combinedClipAndCullDistanceMaxNum = 8;
-        m_Desc.other.viewMaxNum = 4;
-        m_Desc.other.shadingRateAttachmentTileSize = 16;
-
-        memset(&m_Desc.tiers, 0xFF, sizeof(m_Desc.tiers));
-        memset(&m_Desc.features, 0xFF, sizeof(m_Desc.features));
-        memset(&m_Desc.shaderFeatures, 0xFF, sizeof(m_Desc.shaderFeatures));
-    }
-
-    inline ~DeviceNONE() {
-    }
-
-    //================================================================================================================
-    // DeviceBase
-    //================================================================================================================
-
-    inline const DeviceDesc& GetDesc() const override {
-        return m_Desc;
-    }
-
-    inline void Destruct() override {
-        Destroy(GetAllocationCallbacks(), this);
-    }
-
-    Result FillFunctionTable(CoreInterface& table) const override;
-    Result FillFunctionTable(HelperInterface& table) const override;
-    Result FillFunctionTable(LowLatencyInterface& table) const override;
-    Result FillFunctionTable(MeshShaderInterface& table) const override;
-    Result FillFunctionTable(RayTracingInterface& table) const override;
-    Result FillFunctionTable(StreamerInterface& table) const override;
-    Result FillFunctionTable(SwapChainInterface& table) const override;
-    Result FillFunctionTable(UpscalerInterface& table) const override;
-
-#if NRI_ENABLE_IMGUI_EXTENSION
-    Result FillFunctionTable(ImguiInterface& table) const override;
-#endif
-
-private:
-    DeviceDesc m_Desc = {};
-};
+template <typename T>
+inline bool IsDummy(const T* object) {
+    return object == DummyObject<T>();
+}
 
 Result CreateDeviceNONE(const DeviceCreationDesc& desc, DeviceBase*& device) {
-    DeviceNONE* impl = Allocate<DeviceNONE>(desc.allocationCallbacks, desc.callbackInterface, desc.allocationCallbacks, desc.adapterDesc);
+    DeviceNONE* impl = Allocate<DeviceNONE>(desc.allocationCallbacks, desc.callbackInterface, desc.allocationCallbacks, desc);
+    Result result = impl ? impl->Create() : Result::OUT_OF_MEMORY;
 
-    if (!impl) {
+    if (result != Result::SUCCESS) {
         Destroy(desc.allocationCallbacks, impl);
         device = nullptr;
 
-        return Result::FAILURE;
+        return result;
     }
 
     device = (DeviceBase*)impl;
@@ -231,65 +60,134 @@ static const DeviceDesc& NRI_CALL GetDeviceDesc(const Device& device) {
     return ((DeviceNONE&)device).GetDesc();
 }
 
-static const BufferDesc& NRI_CALL GetBufferDesc(const Buffer&) {
+static const BufferDesc& NRI_CALL GetBufferDesc(const Buffer& buffer) {
     static const BufferDesc bufferDesc = {1};
 
-    return bufferDesc;
+    if (IsDummy(&buffer))
+        return bufferDesc;
+
+    return ((BufferNONE&)buffer).GetDesc();
 }
 
-static const TextureDesc& NRI_CALL GetTextureDesc(const Texture&) {
+static const TextureDesc& NRI_CALL GetTextureDesc(const Texture& texture) {
     static const TextureDesc textureDesc = {TextureType::TEXTURE_1D, TextureUsageBits::NONE, Format::R8_UNORM, 1, 1, 1, 1, 1, 1};
 
-    return textureDesc;
+    if (IsDummy(&texture))
+        return textureDesc;
+
+    return ((TextureNONE&)texture).GetDesc();
 }
 
 static FormatSupportBits NRI_CALL GetFormatSupport(const Device&, Format) {
     return (FormatSupportBits)(-1);
 }
 
-static Result NRI_CALL GetQueue(Device&, QueueType, uint32_t, Queue*& queue) {
-    queue = DummyObject<Queue>();
+static Result NRI_CALL GetQueue([[maybe_unused]] Device& device, [[maybe_unused]] QueueType queueType, [[maybe_unused]] uint32_t queueIndex, Queue*& queue) {
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, queueType < QueueType::MAX_NUM, Result::INVALID_ARGUMENT, "'queueType' is invalid");
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, queueIndex < ((DeviceNONE&)device).GetDesc().adapterDesc.queueNum[(uint32_t)queueType], Result::INVALID_ARGUMENT, "'queueIndex' is out of bounds");
+
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (deviceNONE.IsHostEmulation())
+        queue = (Queue*)deviceNONE.GetQueue(queueType, queueIndex);
+    else
+        queue = DummyObject<Queue>();
 
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL CreateCommandAllocator(Queue&, CommandAllocator*& commandAllocator) {
-    commandAllocator = DummyObject<CommandAllocator>();
+static Result NRI_CALL CreateCommandAllocator(Queue& queue, CommandAllocator*& commandAllocator) {
+    if (IsDummy(&queue)) {
+        commandAllocator = DummyObject<CommandAllocator>();
 
-    return Result::SUCCESS;
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::COMMAND);
+
+    DeviceNONE& deviceNONE = ((QueueNONE&)queue).GetDevice();
+    commandAllocator = (CommandAllocator*)Allocate<CommandAllocatorNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE);
+
+    return commandAllocator ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static Result NRI_CALL CreateCommandBuffer(CommandAllocator&, CommandBuffer*& commandBuffer) {
-    commandBuffer = DummyObject<CommandBuffer>();
+static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, CommandBuffer*& commandBuffer) {
+    if (IsDummy(&commandAllocator)) {
+        commandBuffer = DummyObject<CommandBuffer>();
 
-    return Result::SUCCESS;
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::COMMAND);
+
+    DeviceNONE& deviceNONE = ((CommandAllocatorNONE&)commandAllocator).GetDevice();
+    commandBuffer = (CommandBuffer*)Allocate<CommandBufferNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE);
+
+    return commandBuffer ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static Result NRI_CALL CreateFence(Device&, uint64_t, Fence*& fence) {
-    fence = DummyObject<Fence>();
+static Result NRI_CALL CreateReusableCommandBuffer(CommandAllocator& commandAllocator, const ReusableCommandBufferDesc&, CommandBuffer*& commandBuffer) {
+    return CreateCommandBuffer(commandAllocator, commandBuffer);
+}
+
+static Result NRI_CALL CreateCommandBuffers(CommandAllocator& commandAllocator, CommandBuffer** commandBuffers, uint32_t commandBufferNum) {
+    for (uint32_t i = 0; i < commandBufferNum; i++) {
+        Result result = CreateCommandBuffer(commandAllocator, commandBuffers[i]);
+        if (result != Result::SUCCESS) {
+            for (uint32_t j = 0; j < i; j++)
+                Destroy((CommandBufferNONE*)commandBuffers[j]);
+
+            return result;
+        }
+    }
 
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL CreateCommandBundle(CommandAllocator& commandAllocator, const CommandBundleDesc&, CommandBuffer*& commandBundle) {
+    return CreateCommandBuffer(commandAllocator, commandBundle);
+}
+
+static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (!deviceNONE.IsHostEmulation()) {
+        fence = DummyObject<Fence>();
+
+        return Result::SUCCESS;
+    }
+
+    fence = (Fence*)Allocate<FenceNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, initialValue);
+
+    return fence ? Result::SUCCESS : Result::OUT_OF_MEMORY;
+}
+
 static Result NRI_CALL CreateDescriptorPool(Device&, const DescriptorPoolDesc&, DescriptorPool*& descriptorPool) {
     descriptorPool = DummyObject<DescriptorPool>();
 
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL CreatePipelineLayout(Device&, const PipelineLayoutDesc&, PipelineLayout*& pipelineLayout) {
+static Result NRI_CALL CreatePipelineLayout([[maybe_unused]] Device& device, [[maybe_unused]] const PipelineLayoutDesc& pipelineLayoutDesc, PipelineLayout*& pipelineLayout) {
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, pipelineLayoutDesc.descriptorSetNum <= ((DeviceNONE&)device).GetDesc().pipelineLayout.descriptorSetMaxNum, Result::INVALID_ARGUMENT, "'descriptorSetNum' exceeds 'descriptorSetMaxNum'");
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, pipelineLayoutDesc.rootConstantNum == 0 || pipelineLayoutDesc.rootConstants, Result::INVALID_ARGUMENT, "'rootConstants' is NULL");
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, pipelineLayoutDesc.rootDescriptorNum == 0 || pipelineLayoutDesc.rootDescriptors, Result::INVALID_ARGUMENT, "'rootDescriptors' is NULL");
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, pipelineLayoutDesc.descriptorSetNum == 0 || pipelineLayoutDesc.descriptorSets, Result::INVALID_ARGUMENT, "'descriptorSets' is NULL");
+
     pipelineLayout = DummyObject<PipelineLayout>();
 
     return Result::SUCCESS;
 }
 
 static Result NRI_CALL CreateGraphicsPipeline(Device&, const GraphicsPipelineDesc&, Pipeline*& pipeline) {
+    NRI_TRACE_SCOPE("CreateGraphicsPipeline");
+
     pipeline = DummyObject<Pipeline>();
 
     return Result::SUCCESS;
 }
 
 static Result NRI_CALL CreateComputePipeline(Device&, const ComputePipelineDesc&, Pipeline*& pipeline) {
+    NRI_TRACE_SCOPE("CreateComputePipeline");
+
     pipeline = DummyObject<Pipeline>();
 
     return Result::SUCCESS;
@@ -301,40 +199,77 @@ static Result NRI_CALL CreateQueryPool(Device&, const QueryPoolDesc&, QueryPool*
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL CreateSampler(Device&, const SamplerDesc&, Descriptor*& sampler) {
-    sampler = DummyObject<Descriptor>();
+static Result NRI_CALL CreateSampler(Device& device, const SamplerDesc& samplerDesc, Descriptor*& sampler) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (!deviceNONE.IsHostEmulation()) {
+        sampler = DummyObject<Descriptor>();
 
-    return Result::SUCCESS;
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::DESCRIPTOR);
+
+    sampler = (Descriptor*)Allocate<DescriptorNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, samplerDesc);
+
+    return sampler ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static Result NRI_CALL CreateBufferView(const BufferViewDesc&, Descriptor*& bufferView) {
-    bufferView = DummyObject<Descriptor>();
+static Result NRI_CALL CreateBufferView(const BufferViewDesc& bufferViewDesc, Descriptor*& bufferView) {
+    if (IsDummy(bufferViewDesc.buffer)) {
+        bufferView = DummyObject<Descriptor>();
 
-    return Result::SUCCESS;
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::DESCRIPTOR);
+
+    DeviceNONE& deviceNONE = ((BufferNONE*)bufferViewDesc.buffer)->GetDevice();
+    bufferView = (Descriptor*)Allocate<DescriptorNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, bufferViewDesc);
+
+    return bufferView ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static Result NRI_CALL CreateTextureView(const TextureViewDesc&, Descriptor*& textureView) {
-    textureView = DummyObject<Descriptor>();
+static Result NRI_CALL CreateTextureView(const TextureViewDesc& textureViewDesc, Descriptor*& textureView) {
+    if (IsDummy(textureViewDesc.texture)) {
+        textureView = DummyObject<Descriptor>();
 
-    return Result::SUCCESS;
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::DESCRIPTOR);
+
+    DeviceNONE& deviceNONE = ((TextureNONE*)textureViewDesc.texture)->GetDevice();
+    textureView = (Descriptor*)Allocate<DescriptorNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, textureViewDesc);
+
+    return textureView ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static void NRI_CALL DestroyCommandAllocator(CommandAllocator*) {
+static void NRI_CALL DestroyCommandAllocator(CommandAllocator* commandAllocator) {
+    if (!IsDummy(commandAllocator))
+        Destroy((CommandAllocatorNONE*)commandAllocator);
 }
 
-static void NRI_CALL DestroyCommandBuffer(CommandBuffer*) {
+static void NRI_CALL DestroyCommandBuffer(CommandBuffer* commandBuffer) {
+    if (!IsDummy(commandBuffer))
+        Destroy((CommandBufferNONE*)commandBuffer);
 }
 
 static void NRI_CALL DestroyDescriptorPool(DescriptorPool*) {
 }
 
-static void NRI_CALL DestroyBuffer(Buffer*) {
+static void NRI_CALL DestroyBuffer(Buffer* buffer) {
+    if (!IsDummy(buffer))
+        Destroy((BufferNONE*)buffer);
 }
 
-static void NRI_CALL DestroyTexture(Texture*) {
+static void NRI_CALL DestroyTexture(Texture* texture) {
+    if (!IsDummy(texture))
+        Destroy((TextureNONE*)texture);
 }
 
-static void NRI_CALL DestroyDescriptor(Descriptor*) {
+static void NRI_CALL DestroyDescriptor(Descriptor* descriptor) {
+    if (!IsDummy(descriptor))
+        Destroy((DescriptorNONE*)descriptor);
 }
 
 static void NRI_CALL DestroyPipelineLayout(PipelineLayout*) {
@@ -346,79 +281,170 @@ static void NRI_CALL DestroyPipeline(Pipeline*) {
 static void NRI_CALL DestroyQueryPool(QueryPool*) {
 }
 
-static void NRI_CALL DestroyFence(Fence*) {
+static void NRI_CALL DestroyFence(Fence* fence) {
+    if (!IsDummy(fence))
+        Destroy((FenceNONE*)fence);
 }
 
-static Result NRI_CALL AllocateMemory(Device&, const AllocateMemoryDesc&, Memory*& memory) {
-    memory = DummyObject<Memory>();
+static Result NRI_CALL AllocateMemory(Device& device, [[maybe_unused]] const AllocateMemoryDesc& allocateMemoryDesc, Memory*& memory) {
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, allocateMemoryDesc.size != 0, Result::INVALID_ARGUMENT, "'size' is 0");
 
-    return Result::SUCCESS;
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (!deviceNONE.IsHostEmulation()) {
+        memory = DummyObject<Memory>();
+
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::RESOURCE);
+
+    MemoryNONE* impl = Allocate<MemoryNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE);
+    Result result = impl ? impl->Create(allocateMemoryDesc.size) : Result::OUT_OF_MEMORY;
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        memory = nullptr;
+    } else
+        memory = (Memory*)impl;
+
+    return result;
 }
 
-static void NRI_CALL FreeMemory(Memory*) {
+static void NRI_CALL FreeMemory(Memory* memory) {
+    if (!IsDummy(memory))
+        Destroy((MemoryNONE*)memory);
 }
 
-static Result NRI_CALL CreateBuffer(Device&, const BufferDesc&, Buffer*& buffer) {
-    buffer = DummyObject<Buffer>();
+template <typename Implementation, typename Interface, typename Desc>
+static Result CreateHostObject(DeviceNONE& device, const Desc& desc, bool isCommitted, Interface*& entity) {
+    if (!device.IsHostEmulation()) {
+        entity = DummyObject<Interface>();
 
-    return Result::SUCCESS;
-}
+        return Result::SUCCESS;
+    }
 
-static Result NRI_CALL CreateTexture(Device&, const TextureDesc&, Texture*& texture) {
-    texture = DummyObject<Texture>();
+    NRI_ALLOCATION_SCOPE(GetAllocationTag<Interface>());
 
-    return Result::SUCCESS;
+    Implementation* impl = Allocate<Implementation>(device.GetAllocationCallbacks(), device, desc);
+    Result result = impl ? Result::SUCCESS : Result::OUT_OF_MEMORY;
+
+    if (impl && isCommitted)
+        result = impl->Create();
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        entity = nullptr;
+    } else
+        entity = (Interface*)impl;
+
+    return result;
 }
 
-static void NRI_CALL GetBufferMemoryDesc(const Buffer&, MemoryLocation, MemoryDesc& memoryDesc) {
-    memoryDesc = {1};
+static Result NRI_CALL CreateBuffer(Device& device, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, bufferDesc.size != 0, Result::INVALID_ARGUMENT, "'size' is 0");
+
+    return CreateHostObject<BufferNONE>((DeviceNONE&)device, bufferDesc, false, buffer);
 }
 
-static void NRI_CALL GetTextureMemoryDesc(const Texture&, MemoryLocation, MemoryDesc& memoryDesc) {
-    memoryDesc = {1};
+static Result NRI_CALL CreateTexture(Device& device, const TextureDesc& textureDesc, Texture*& texture) {
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, textureDesc.width != 0, Result::INVALID_ARGUMENT, "'width' is 0");
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, textureDesc.format > Format::UNKNOWN && textureDesc.format < Format::MAX_NUM, Result::INVALID_ARGUMENT, "'format' is invalid");
+
+    return CreateHostObject<TextureNONE>((DeviceNONE&)device, textureDesc, false, texture);
 }
 
-static Result NRI_CALL BindBufferMemory(const BindBufferMemoryDesc*, uint32_t) {
-    return Result::SUCCESS;
+static void NRI_CALL GetBufferMemoryDesc2(const Device&, const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    memoryDesc = {};
+    memoryDesc.size = std::max(bufferDesc.size, (uint64_t)1);
+    memoryDesc.alignment = HOST_MEMORY_ALIGNMENT;
+    memoryDesc.type = (MemoryType)memoryLocation;
 }
 
-static Result NRI_CALL BindTextureMemory(const BindTextureMemoryDesc*, uint32_t) {
-    return Result::SUCCESS;
+static void NRI_CALL GetTextureMemoryDesc2(const Device&, const TextureDesc& textureDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    memoryDesc = {};
+    memoryDesc.size = std::max(GetTextureSize(FixTextureDesc(textureDesc)), (uint64_t)1);
+    memoryDesc.alignment = HOST_MEMORY_ALIGNMENT;
+    memoryDesc.type = (MemoryType)memoryLocation;
 }
 
-static void NRI_CALL GetBufferMemoryDesc2(const Device&, const BufferDesc&, MemoryLocation, MemoryDesc& memoryDesc) {
-    memoryDesc = {1};
+static void NRI_CALL GetBufferMemoryDesc(const Buffer& buffer, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    if (IsDummy(&buffer))
+        memoryDesc = {1};
+    else
+        GetBufferMemoryDesc2((Device&)((BufferNONE&)buffer).GetDevice(), ((BufferNONE&)buffer).GetDesc(), memoryLocation, memoryDesc);
 }
 
-static void NRI_CALL GetTextureMemoryDesc2(const Device&, const TextureDesc&, MemoryLocation, MemoryDesc& memoryDesc) {
-    memoryDesc = {1};
+static void NRI_CALL GetTextureMemoryDesc(const Texture& texture, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    if (IsDummy(&texture))
+        memoryDesc = {1};
+    else
+        GetTextureMemoryDesc2((Device&)((TextureNONE&)texture).GetDevice(), ((TextureNONE&)texture).GetDesc(), memoryLocation, memoryDesc);
 }
 
-static Result NRI_CALL CreateCommittedBuffer(Device&, MemoryLocation, float, const BufferDesc&, Buffer*& buffer) {
-    buffer = DummyObject<Buffer>();
+static Result NRI_CALL BindBufferMemory(const BindBufferMemoryDesc* bindBufferMemoryDescs, uint32_t bindBufferMemoryDescNum) {
+    for (uint32_t i = 0; i < bindBufferMemoryDescNum; i++) {
+        const BindBufferMemoryDesc& bindBufferMemoryDesc = bindBufferMemoryDescs[i];
+        if (!IsDummy(bindBufferMemoryDesc.buffer))
+            ((BufferNONE*)bindBufferMemoryDesc.buffer)->BindMemory((MemoryNONE*)bindBufferMemoryDesc.memory, bindBufferMemoryDesc.offset);
+    }
 
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL CreateCommittedTexture(Device&, MemoryLocation, float, const TextureDesc&, Texture*& texture) {
-    texture = DummyObject<Texture>();
+static Result NRI_CALL BindTextureMemory(const BindTextureMemoryDesc* bindTextureMemoryDescs, uint32_t bindTextureMemoryDescNum) {
+    for (uint32_t i = 0; i < bindTextureMemoryDescNum; i++) {
+        const BindTextureMemoryDesc& bindTextureMemoryDesc = bindTextureMemoryDescs[i];
+        if (!IsDummy(bindTextureMemoryDesc.texture))
+            ((TextureNONE*)bindTextureMemoryDesc.texture)->BindMemory((MemoryNONE*)bindTextureMemoryDesc.memory, bindTextureMemoryDesc.offset);
+    }
 
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL CreatePlacedBuffer(Device&, Memory*, uint64_t, const BufferDesc&, Buffer*& buffer) {
-    buffer = DummyObject<Buffer>();
+static Result NRI_CALL CreateCommittedBuffer(Device& device, MemoryLocation, float, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, bufferDesc.size != 0, Result::INVALID_ARGUMENT, "'size' is 0");
 
-    return Result::SUCCESS;
+    return CreateHostObject<BufferNONE>((DeviceNONE&)device, bufferDesc, true, buffer);
 }
 
-static Result NRI_CALL CreatePlacedTexture(Device&, Memory*, uint64_t, const TextureDesc&, Texture*& texture) {
-    texture = DummyObject<Texture>();
+static Result NRI_CALL CreateCommittedTexture(Device& device, MemoryLocation, float, const TextureDesc& textureDesc, Texture*& texture) {
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, textureDesc.width != 0, Result::INVALID_ARGUMENT, "'width' is 0");
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, textureDesc.format > Format::UNKNOWN && textureDesc.format < Format::MAX_NUM, Result::INVALID_ARGUMENT, "'format' is invalid");
 
-    return Result::SUCCESS;
+    return CreateHostObject<TextureNONE>((DeviceNONE&)device, textureDesc, true, texture);
 }
 
-static Result NRI_CALL AllocateDescriptorSets(DescriptorPool&, const PipelineLayout&, uint32_t, DescriptorSet**, uint32_t, uint32_t) {
+static Result NRI_CALL CreatePlacedBuffer(Device& device, Memory* memory, uint64_t offset, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    if (!memory) // "Nri[Device/DeviceUpload/HostUpload/HostReadback]Heap"
+        return CreateCommittedBuffer(device, (MemoryLocation)offset, 0.0f, bufferDesc, buffer);
+
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, bufferDesc.size != 0, Result::INVALID_ARGUMENT, "'size' is 0");
+
+    Result result = CreateHostObject<BufferNONE>((DeviceNONE&)device, bufferDesc, false, buffer);
+    if (result == Result::SUCCESS && !IsDummy(buffer))
+        ((BufferNONE*)buffer)->BindMemory((MemoryNONE*)memory, offset);
+
+    return result;
+}
+
+static Result NRI_CALL CreatePlacedTexture(Device& device, Memory* memory, uint64_t offset, const TextureDesc& textureDesc, Texture*& texture) {
+    if (!memory) // "Nri[Device/DeviceUpload/HostUpload/HostReadback]Heap"
+        return CreateCommittedTexture(device, (MemoryLocation)offset, 0.0f, textureDesc, texture);
+
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, textureDesc.width != 0, Result::INVALID_ARGUMENT, "'width' is 0");
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, textureDesc.format > Format::UNKNOWN && textureDesc.format < Format::MAX_NUM, Result::INVALID_ARGUMENT, "'format' is invalid");
+
+    Result result = CreateHostObject<TextureNONE>((DeviceNONE&)device, textureDesc, false, texture);
+    if (result == Result::SUCCESS && !IsDummy(texture))
+        ((TextureNONE*)texture)->BindMemory((MemoryNONE*)memory, offset);
+
+    return result;
+}
+
+static Result NRI_CALL AllocateDescriptorSets(DescriptorPool&, const PipelineLayout&, uint32_t, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t) {
+    for (uint32_t i = 0; i < instanceNum; i++)
+        descriptorSets[i] = DummyObject<DescriptorSet>();
+
     return Result::SUCCESS;
 }
 
@@ -436,7 +462,10 @@ static void NRI_CALL GetDescriptorSetOffsets(const DescriptorSet&, uint32_t& res
     samplerHeapOffset = 0;
 }
 
-static Result NRI_CALL BeginCommandBuffer(CommandBuffer&, const DescriptorPool*) {
+static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool*) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).Begin();
+
     return Result::SUCCESS;
 }
 
@@ -497,46 +526,85 @@ static void NRI_CALL CmdBeginRendering(CommandBuffer&, const RenderingDesc&) {
 static void NRI_CALL CmdClearAttachments(CommandBuffer&, const ClearAttachmentDesc*, uint32_t, const Rect*, uint32_t) {
 }
 
-static void NRI_CALL CmdDraw(CommandBuffer&, const DrawDesc&) {
+static void NRI_CALL CmdDraw(CommandBuffer& commandBuffer, const DrawDesc&) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDraw(1);
+}
+
+static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawIndexedDesc&) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDraw(1);
+}
+
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc*, uint32_t drawDescNum) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDraw(drawDescNum);
 }
 
-static void NRI_CALL CmdDrawIndexed(CommandBuffer&, const DrawIndexedDesc&) {
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc*, uint32_t drawIndexedDescNum) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDraw(drawIndexedDescNum);
 }
 
-static void NRI_CALL CmdDrawIndirect(CommandBuffer&, const Buffer&, uint64_t, uint32_t, uint32_t, const Buffer*, uint64_t) {
+static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer&, uint64_t, uint32_t drawNum, uint32_t, const Buffer*, uint64_t) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDraw(drawNum);
 }
 
-static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer&, const Buffer&, uint64_t, uint32_t, uint32_t, const Buffer*, uint64_t) {
+static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const Buffer&, uint64_t, uint32_t drawNum, uint32_t, const Buffer*, uint64_t) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDraw(drawNum);
 }
 
 static void NRI_CALL CmdEndRendering(CommandBuffer&) {
 }
 
-static void NRI_CALL CmdDispatch(CommandBuffer&, const DispatchDesc&) {
+static void NRI_CALL CmdExecuteBundle(CommandBuffer& commandBuffer, const CommandBuffer& commandBundle) {
+    if (!IsDummy(&commandBuffer) && !IsDummy(&commandBundle))
+        ((CommandBufferNONE&)commandBuffer).ExecuteBundle((const CommandBufferNONE&)commandBundle);
 }
 
-static void NRI_CALL CmdDispatchIndirect(CommandBuffer&, const Buffer&, uint64_t) {
+static void NRI_CALL CmdDispatch(CommandBuffer& commandBuffer, const DispatchDesc&) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDispatch(1);
 }
 
-static void NRI_CALL CmdCopyBuffer(CommandBuffer&, Buffer&, uint64_t, const Buffer&, uint64_t, uint64_t) {
+static void NRI_CALL CmdDispatchIndirect(CommandBuffer& commandBuffer, const Buffer&, uint64_t) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDispatch(1);
 }
 
-static void NRI_CALL CmdCopyTexture(CommandBuffer&, Texture&, const TextureRegionDesc*, const Texture&, const TextureRegionDesc*) {
+static void NRI_CALL CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
 }
 
-static void NRI_CALL CmdUploadBufferToTexture(CommandBuffer&, Texture&, const TextureRegionDesc&, const Buffer&, const TextureDataLayoutDesc&) {
+static void NRI_CALL CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).CopyTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
 
-static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer&, Buffer&, const TextureDataLayoutDesc&, const Texture&, const TextureRegionDesc&) {
+static void NRI_CALL CmdUploadBufferToTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).UploadBufferToTexture(dstTexture, dstRegion, srcBuffer, srcDataLayout);
 }
 
-static void NRI_CALL CmdZeroBuffer(CommandBuffer&, Buffer&, uint64_t, uint64_t) {
+static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
+}
+
+static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
 
 static void NRI_CALL CmdResolveTexture(CommandBuffer&, Texture&, const TextureRegionDesc*, const Texture&, const TextureRegionDesc*, ResolveOp) {
 }
 
-static void NRI_CALL CmdClearStorage(CommandBuffer&, const ClearStorageDesc&) {
+static void NRI_CALL CmdClearStorage(CommandBuffer& commandBuffer, const ClearStorageDesc& clearStorageDesc) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).ClearStorage(clearStorageDesc);
 }
 
 static void NRI_CALL CmdResetQueries(CommandBuffer&, QueryPool&, uint32_t, uint32_t) {
@@ -580,37 +648,65 @@ static uint32_t NRI_CALL GetQuerySize(const QueryPool&) {
     return 0;
 }
 
-static Result NRI_CALL QueueSubmit(Queue&, const QueueSubmitDesc&) {
-    return Result::SUCCESS;
+static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSubmitDesc) {
+    NRI_TRACE_SCOPE("QueueSubmit");
+
+    if (IsDummy(&queue))
+        return Result::SUCCESS;
+
+    return ((QueueNONE&)queue).Submit(queueSubmitDesc);
 }
 
-static Result NRI_CALL DeviceWaitIdle(Device*) {
+static Result NRI_CALL DeviceWaitIdle(Device* device) {
+    if (device)
+        ((DeviceNONE*)device)->WaitIdle(nullptr);
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL QueueWaitIdle(Queue*) {
+static Result NRI_CALL QueueWaitIdle(Queue* queue) {
+    if (queue && !IsDummy(queue)) {
+        QueueNONE& queueNONE = *(QueueNONE*)queue;
+        queueNONE.GetDevice().WaitIdle(&queueNONE);
+    }
+
     return Result::SUCCESS;
 }
 
-static void NRI_CALL Wait(Fence&, uint64_t) {
+static void NRI_CALL Wait(Fence& fence, uint64_t value) {
+    if (!IsDummy(&fence)) {
+        FenceNONE& fenceNONE = (FenceNONE&)fence;
+        fenceNONE.GetDevice().Wait(fenceNONE, value);
+    }
 }
 
-static uint64_t NRI_CALL GetFenceValue(Fence&) {
-    return 0;
+static uint64_t NRI_CALL GetFenceValue(Fence& fence) {
+    if (IsDummy(&fence))
+        return 0;
+
+    return ((FenceNONE&)fence).GetValue();
 }
 
 static void NRI_CALL ResetCommandAllocator(CommandAllocator&) {
 }
 
-static void* NRI_CALL MapBuffer(Buffer&, uint64_t, uint64_t) {
-    return nullptr;
+static void* NRI_CALL MapBuffer(Buffer& buffer, uint64_t offset, uint64_t) {
+    if (IsDummy(&buffer))
+        return nullptr;
+
+    uint8_t* data = ((BufferNONE&)buffer).GetData();
+
+    return data ? data + offset : nullptr;
 }
 
 static void NRI_CALL UnmapBuffer(Buffer&) {
 }
 
-static uint64_t NRI_CALL GetBufferDeviceAddress(const Buffer&) {
-    return 0;
+static uint64_t NRI_CALL GetBufferDeviceAddress(const Buffer& buffer) {
+    if (IsDummy(&buffer))
+        return 0;
+
+    return (uint64_t)((BufferNONE&)buffer).GetData();
 }
 
 static void NRI_CALL SetDebugName(Object*, const char*) {
@@ -651,6 +747,9 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateCommandBundle = ::CreateCommandBundle;
+    table.CreateReusableCommandBuffer = ::CreateReusableCommandBuffer;
+    table.CreateCommandBuffers = ::CreateCommandBuffers;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTextureView = ::CreateTextureView;
@@ -710,9 +809,12 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
+    table.CmdExecuteBundle = ::CmdExecuteBundle;
     table.CmdDispatch = ::CmdDispatch;
     table.CmdDispatchIndirect = ::CmdDispatchIndirect;
     table.CmdCopyBuffer = ::CmdCopyBuffer;
@@ -756,31 +858,174 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
 #pragma endregion
 
 //============================================================================================================================================================================================
-#pragma region[  Helper  ]
+#pragma region[  Device generated commands  ]
 
-static uint32_t NRI_CALL CalculateAllocationNumber(const Device&, const ResourceGroupDesc&) {
-    return 0;
+static Result NRI_CALL CreateIndirectCommandLayout(Device& device, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    NRI_VALIDATE_ARGUMENT((DeviceNONE*)&device, indirectCommandLayoutDesc.commands && indirectCommandLayoutDesc.commandNum, Result::INVALID_ARGUMENT, "'commands' is empty");
+
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (!deviceNONE.IsHostEmulation()) {
+        indirectCommandLayout = DummyObject<IndirectCommandLayout>();
+
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::PIPELINE);
+
+    IndirectCommandLayoutNONE* impl = Allocate<IndirectCommandLayoutNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, indirectCommandLayoutDesc);
+    indirectCommandLayout = (IndirectCommandLayout*)impl;
+
+    return impl ? Result::SUCCESS : Result::OUT_OF_MEMORY;
 }
 
-static Result NRI_CALL AllocateAndBindMemory(Device&, const ResourceGroupDesc&, Memory**) {
+static Result NRI_CALL CreateIndirectExecutionSet(Device&, const IndirectExecutionSetDesc&, IndirectExecutionSet*& indirectExecutionSet) {
+    indirectExecutionSet = DummyObject<IndirectExecutionSet>();
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL UploadData(Queue&, const TextureUploadDesc*, uint32_t, const BufferUploadDesc*, uint32_t) {
+static uint64_t NRI_CALL GetIndirectCommandsPreprocessBufferSize(const Device&, const IndirectCommandsPreprocessDesc&) {
+    return 1;
+}
+
+static void NRI_CALL UpdateIndirectExecutionSet(IndirectExecutionSet&, uint32_t, const Pipeline* const*, uint32_t) {
+}
+
+static void NRI_CALL DestroyIndirectCommandLayout(IndirectCommandLayout* indirectCommandLayout) {
+    if (!IsDummy(indirectCommandLayout))
+        Destroy((IndirectCommandLayoutNONE*)indirectCommandLayout);
+}
+
+static void NRI_CALL DestroyIndirectExecutionSet(IndirectExecutionSet*) {
+}
+
+static void NRI_CALL CmdExecuteIndirectCommands(CommandBuffer& commandBuffer, const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    if (IsDummy(&commandBuffer) || IsDummy(executeIndirectCommandsDesc.indirectCommandLayout))
+        return;
+
+    // "sequenceMaxNum" is an upper bound, as for "CmdDrawIndirect"
+    const IndirectCommandLayoutNONE& indirectCommandLayoutNONE = *(const IndirectCommandLayoutNONE*)executeIndirectCommandsDesc.indirectCommandLayout;
+    CommandBufferNONE& commandBufferNONE = (CommandBufferNONE&)commandBuffer;
+
+    if (indirectCommandLayoutNONE.GetActionType() == IndirectCommandType::DISPATCH)
+        commandBufferNONE.OnDispatch(executeIndirectCommandsDesc.sequenceMaxNum);
+    else
+        commandBufferNONE.OnDraw(executeIndirectCommandsDesc.sequenceMaxNum);
+}
+
+Result DeviceNONE::FillFunctionTable(DeviceGeneratedCommandsInterface& table) const {
+    table.CreateIndirectCommandLayout = ::CreateIndirectCommandLayout;
+    table.CreateIndirectExecutionSet = ::CreateIndirectExecutionSet;
+    table.GetIndirectCommandsPreprocessBufferSize = ::GetIndirectCommandsPreprocessBufferSize;
+    table.UpdateIndirectExecutionSet = ::UpdateIndirectExecutionSet;
+    table.DestroyIndirectCommandLayout = ::DestroyIndirectCommandLayout;
+    table.DestroyIndirectExecutionSet = ::DestroyIndirectExecutionSet;
+    table.CmdExecuteIndirectCommands = ::CmdExecuteIndirectCommands;
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL QueryVideoMemoryInfo(const Device&, MemoryLocation, VideoMemoryInfo& videoMemoryInfo) {
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Helper  ]
+
+static uint32_t NRI_CALL CalculateAllocationNumber(const Device& device, const ResourceGroupDesc& resourceGroupDesc) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (!deviceNONE.IsHostEmulation())
+        return 0;
+
+    HelperDeviceMemoryAllocator allocator(deviceNONE.GetCoreInterface(), (Device&)device);
+
+    return allocator.CalculateAllocationNumber(resourceGroupDesc);
+}
+
+static Result NRI_CALL AllocateAndBindMemory(Device& device, const ResourceGroupDesc& resourceGroupDesc, Memory** allocations) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (!deviceNONE.IsHostEmulation())
+        return Result::SUCCESS;
+
+    HelperDeviceMemoryAllocator allocator(deviceNONE.GetCoreInterface(), device);
+
+    return allocator.AllocateAndBindMemory(resourceGroupDesc, allocations);
+}
+
+static Result NRI_CALL UploadData(Queue& queue, const TextureUploadDesc* textureUploadDescs, uint32_t textureUploadDescNum, const BufferUploadDesc* bufferUploadDescs, uint32_t bufferUploadDescNum) {
+    if (IsDummy(&queue))
+        return Result::SUCCESS;
+
+    DeviceNONE& deviceNONE = ((QueueNONE&)queue).GetDevice();
+    HelperDataUpload helperDataUpload(deviceNONE.GetCoreInterface(), (Device&)deviceNONE, queue);
+
+    return helperDataUpload.UploadData(textureUploadDescs, textureUploadDescNum, bufferUploadDescs, bufferUploadDescNum);
+}
+
+static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation, VideoMemoryInfo& videoMemoryInfo) {
     videoMemoryInfo = {};
+    videoMemoryInfo.usageSize = ((DeviceNONE&)device).GetAllocatedMemorySize();
 
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL CreateCommandRecorder(Queue& queue, const CommandRecorderDesc& commandRecorderDesc, CommandRecorder*& commandRecorder) {
+    if (IsDummy(&queue)) {
+        commandRecorder = DummyObject<CommandRecorder>();
+
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::COMMAND);
+
+    DeviceNONE& deviceNONE = ((QueueNONE&)queue).GetDevice();
+    CommandRecorderImpl* impl = Allocate<CommandRecorderImpl>(deviceNONE.GetAllocationCallbacks(), (Device&)deviceNONE, deviceNONE.GetCoreInterface(), queue);
+    Result result = impl ? impl->Create(commandRecorderDesc) : Result::OUT_OF_MEMORY;
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        commandRecorder = nullptr;
+    } else
+        commandRecorder = (CommandRecorder*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyCommandRecorder(CommandRecorder* commandRecorder) {
+    if (!IsDummy(commandRecorder))
+        Destroy((CommandRecorderImpl*)commandRecorder);
+}
+
+static void NRI_CALL BeginCommandRecorderFrame(CommandRecorder& commandRecorder) {
+    if (!IsDummy(&commandRecorder))
+        ((CommandRecorderImpl&)commandRecorder).BeginFrame();
+}
+
+static Result NRI_CALL AcquireCommandBuffer(CommandRecorder& commandRecorder, uint32_t threadIndex, uint32_t sortKey, CommandBuffer*& commandBuffer) {
+    if (IsDummy(&commandRecorder)) {
+        commandBuffer = DummyObject<CommandBuffer>();
+
+        return Result::SUCCESS;
+    }
+
+    return ((CommandRecorderImpl&)commandRecorder).AcquireCommandBuffer(threadIndex, sortKey, commandBuffer);
+}
+
+static Result NRI_CALL SubmitCommandRecorderFrame(CommandRecorder& commandRecorder, const QueueSubmitDesc& queueSubmitDesc) {
+    if (IsDummy(&commandRecorder))
+        return Result::SUCCESS;
+
+    return ((CommandRecorderImpl&)commandRecorder).Submit(queueSubmitDesc);
+}
+
 Result DeviceNONE::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.CreateCommandRecorder = ::CreateCommandRecorder;
+    table.DestroyCommandRecorder = ::DestroyCommandRecorder;
+    table.BeginCommandRecorderFrame = ::BeginCommandRecorderFrame;
+    table.AcquireCommandBuffer = ::AcquireCommandBuffer;
+    table.SubmitCommandRecorderFrame = ::SubmitCommandRecorderFrame;
 
     return Result::SUCCESS;
 }
@@ -792,19 +1037,41 @@ Result DeviceNONE::FillFunctionTable(HelperInterface& table) const {
 
 #if NRI_ENABLE_IMGUI_EXTENSION
 
-static Result NRI_CALL CreateImgui(Device&, const ImguiDesc&, Imgui*& imgui) {
-    imgui = DummyObject<Imgui>();
+static Result NRI_CALL CreateImgui(Device& device, const ImguiDesc& imguiDesc, Imgui*& imgui) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (!deviceNONE.IsHostEmulation()) {
+        imgui = DummyObject<Imgui>();
 
-    return Result::SUCCESS;
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::IMGUI);
+
+    ImguiImpl* impl = Allocate<ImguiImpl>(deviceNONE.GetAllocationCallbacks(), device, deviceNONE.GetCoreInterface());
+    Result result = impl->Create(imguiDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        imgui = nullptr;
+    } else
+        imgui = (Imgui*)impl;
+
+    return result;
 }
 
-static void NRI_CALL DestroyImgui(Imgui*) {
+static void NRI_CALL DestroyImgui(Imgui* imgui) {
+    if (!IsDummy(imgui))
+        Destroy((ImguiImpl*)imgui);
 }
 
-static void NRI_CALL CmdCopyImguiData(CommandBuffer&, Streamer&, Imgui&, const CopyImguiDataDesc&) {
+static void NRI_CALL CmdCopyImguiData(CommandBuffer& commandBuffer, Streamer& streamer, Imgui& imgui, const CopyImguiDataDesc& copyImguiDataDesc) {
+    if (!IsDummy(&imgui))
+        ((ImguiImpl&)imgui).CmdCopyData(commandBuffer, streamer, copyImguiDataDesc);
 }
 
-static void NRI_CALL CmdDrawImgui(CommandBuffer&, Imgui&, const DrawImguiDesc&) {
+static void NRI_CALL CmdDrawImgui(CommandBuffer& commandBuffer, Imgui& imgui, const DrawImguiDesc& drawImguiDesc) {
+    if (!IsDummy(&imgui))
+        ((ImguiImpl&)imgui).CmdDraw(commandBuffer, drawImguiDesc);
 }
 
 Result DeviceNONE::FillFunctionTable(ImguiInterface& table) const {
@@ -853,10 +1120,14 @@ Result DeviceNONE::FillFunctionTable(LowLatencyInterface& table) const {
 //============================================================================================================================================================================================
 #pragma region[  MeshShader  ]
 
-static void NRI_CALL CmdDrawMeshTasks(CommandBuffer&, const DrawMeshTasksDesc&) {
+static void NRI_CALL CmdDrawMeshTasks(CommandBuffer& commandBuffer, const DrawMeshTasksDesc&) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDraw(1);
 }
 
-static void NRI_CALL CmdDrawMeshTasksIndirect(CommandBuffer&, const Buffer&, uint64_t, uint32_t, uint32_t, const Buffer*, uint64_t) {
+static void NRI_CALL CmdDrawMeshTasksIndirect(CommandBuffer& commandBuffer, const Buffer&, uint64_t, uint32_t drawNum, uint32_t, const Buffer*, uint64_t) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDraw(drawNum);
 }
 
 Result DeviceNONE::FillFunctionTable(MeshShaderInterface& table) const {
@@ -872,6 +1143,8 @@ Result DeviceNONE::FillFunctionTable(MeshShaderInterface& table) const {
 #pragma region[  RayTracing  ]
 
 static Result NRI_CALL CreateRayTracingPipeline(Device&, const RayTracingPipelineDesc&, Pipeline*& pipeline) {
+    NRI_TRACE_SCOPE("CreateRayTracingPipeline");
+
     pipeline = DummyObject<Pipeline>();
 
     return Result::SUCCESS;
@@ -986,10 +1259,14 @@ static void NRI_CALL CmdBuildBottomLevelAccelerationStructures(CommandBuffer&, c
 static void NRI_CALL CmdBuildMicromaps(CommandBuffer&, const BuildMicromapDesc*, uint32_t) {
 }
 
-static void NRI_CALL CmdDispatchRays(CommandBuffer&, const DispatchRaysDesc&) {
+static void NRI_CALL CmdDispatchRays(CommandBuffer& commandBuffer, const DispatchRaysDesc&) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDispatch(1);
 }
 
-static void NRI_CALL CmdDispatchRaysIndirect(CommandBuffer&, const Buffer&, uint64_t) {
+static void NRI_CALL CmdDispatchRaysIndirect(CommandBuffer& commandBuffer, const Buffer&, uint64_t) {
+    if (!IsDummy(&commandBuffer))
+        ((CommandBufferNONE&)commandBuffer).OnDispatch(1);
 }
 
 static void NRI_CALL CmdWriteAccelerationStructuresSizes(CommandBuffer&, const AccelerationStructure* const*, uint32_t, QueryPool&, uint32_t) {
@@ -1056,35 +1333,69 @@ Result DeviceNONE::FillFunctionTable(RayTracingInterface& table) const {
 //============================================================================================================================================================================================
 #pragma region[  Streamer  ]
 
-static Result NRI_CALL CreateStreamer(Device&, const StreamerDesc&, Streamer*& streamer) {
-    streamer = DummyObject<Streamer>();
+static Result NRI_CALL CreateStreamer(Device& device, const StreamerDesc& streamerDesc, Streamer*& streamer) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (!deviceNONE.IsHostEmulation()) {
+        streamer = DummyObject<Streamer>();
 
-    return Result::SUCCESS;
+        return Result::SUCCESS;
+    }
+
+    NRI_ALLOCATION_SCOPE(AllocationTag::STREAMER);
+
+    StreamerImpl* impl = Allocate<StreamerImpl>(deviceNONE.GetAllocationCallbacks(), device, deviceNONE.GetCoreInterface());
+    Result result = impl->Create(streamerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        streamer = nullptr;
+    } else
+        streamer = (Streamer*)impl;
+
+    return result;
 }
 
-static void NRI_CALL DestroyStreamer(Streamer*) {
+static void NRI_CALL DestroyStreamer(Streamer* streamer) {
+    if (!IsDummy(streamer))
+        Destroy((StreamerImpl*)streamer);
 }
 
-static Buffer* NRI_CALL GetStreamerConstantBuffer(Streamer&) {
-    return nullptr;
+static Buffer* NRI_CALL GetStreamerConstantBuffer(Streamer& streamer) {
+    if (IsDummy(&streamer))
+        return nullptr;
+
+    return ((StreamerImpl&)streamer).GetConstantBuffer();
 }
 
-static uint32_t NRI_CALL StreamConstantData(Streamer&, const void*, uint32_t) {
-    return 0;
+static uint32_t NRI_CALL StreamConstantData(Streamer& streamer, const void* data, uint32_t dataSize) {
+    if (IsDummy(&streamer))
+        return 0;
+
+    return ((StreamerImpl&)streamer).StreamConstantData(data, dataSize);
 }
 
-static BufferOffset NRI_CALL StreamBufferData(Streamer&, const StreamBufferDataDesc&) {
-    return {};
+static BufferOffset NRI_CALL StreamBufferData(Streamer& streamer, const StreamBufferDataDesc& streamBufferDataDesc) {
+    if (IsDummy(&streamer))
+        return {};
+
+    return ((StreamerImpl&)streamer).StreamBufferData(streamBufferDataDesc);
 }
 
-static BufferOffset NRI_CALL StreamTextureData(Streamer&, const StreamTextureDataDesc&) {
-    return {};
+static BufferOffset NRI_CALL StreamTextureData(Streamer& streamer, const StreamTextureDataDesc& streamTextureDataDesc) {
+    if (IsDummy(&streamer))
+        return {};
+
+    return ((StreamerImpl&)streamer).StreamTextureData(streamTextureDataDesc);
 }
 
-static void NRI_CALL EndStreamerFrame(Streamer&) {
+static void NRI_CALL EndStreamerFrame(Streamer& streamer) {
+    if (!IsDummy(&streamer))
+        ((StreamerImpl&)streamer).EndFrame();
 }
 
-static void NRI_CALL CmdCopyStreamedData(CommandBuffer&, Streamer&) {
+static void NRI_CALL CmdCopyStreamedData(CommandBuffer& commandBuffer, Streamer& streamer) {
+    if (!IsDummy(&streamer))
+        ((StreamerImpl&)streamer).CmdCopyStreamedData(commandBuffer);
 }
 
 Result DeviceNONE::FillFunctionTable(StreamerInterface& table) const {
@@ -1105,16 +1416,35 @@ Result DeviceNONE::FillFunctionTable(StreamerInterface& table) const {
 //============================================================================================================================================================================================
 #pragma region[  SwapChain  ]
 
-static Result NRI_CALL CreateSwapChain(Device&, const SwapChainDesc&, SwapChain*& swapChain) {
-    swapChain = DummyObject<SwapChain>();
+static Result NRI_CALL CreateSwapChain(Device& device, const SwapChainDesc& swapChainDesc, SwapChain*& swapChain) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    if (!deviceNONE.IsHostEmulation()) {
+        swapChain = DummyObject<SwapChain>();
 
-    return Result::SUCCESS;
+        return Result::SUCCESS;
+    }
+
+    SwapChainNONE* impl = Allocate<SwapChainNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE);
+    Result result = impl ? impl->Create(swapChainDesc) : Result::OUT_OF_MEMORY;
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        swapChain = nullptr;
+    } else
+        swapChain = (SwapChain*)impl;
+
+    return result;
 }
 
-static void NRI_CALL DestroySwapChain(SwapChain*) {
+static void NRI_CALL DestroySwapChain(SwapChain* swapChain) {
+    if (!IsDummy(swapChain))
+        Destroy((SwapChainNONE*)swapChain);
 }
 
-static Texture* const* NRI_CALL GetSwapChainTextures(const SwapChain&, uint32_t& textureNum) {
+static Texture* const* NRI_CALL GetSwapChainTextures(const SwapChain& swapChain, uint32_t& textureNum) {
+    if (!IsDummy(&swapChain))
+        return ((SwapChainNONE&)swapChain).GetTextures(textureNum);
+
     static const void* textures[1] = {};
     textureNum = 1;
 
@@ -1127,8 +1457,8 @@ static Result NRI_CALL GetDisplayDesc(SwapChain&, DisplayDesc& displayDesc) {
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL AcquireNextTexture(SwapChain&, Fence&, uint32_t& textureIndex) {
-    textureIndex = 0;
+static Result NRI_CALL AcquireNextTexture(SwapChain& swapChain, Fence&, uint32_t& textureIndex) {
+    textureIndex = IsDummy(&swapChain) ? 0 : ((SwapChainNONE&)swapChain).AcquireNextTexture();
 
     return Result::SUCCESS;
 }
@@ -0,0 +1,27 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+// Only the action type is needed to account work, since indirect arguments are not decoded on the CPU
+struct IndirectCommandLayoutNONE final {
+    inline IndirectCommandLayoutNONE(DeviceNONE& device, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc)
+        : m_Device(device)
+        , m_ActionType(indirectCommandLayoutDesc.commands[indirectCommandLayoutDesc.commandNum - 1].type) {
+    }
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline IndirectCommandType GetActionType() const {
+        return m_ActionType;
+    }
+
+private:
+    DeviceNONE& m_Device;
+    IndirectCommandType m_ActionType = IndirectCommandType::MAX_NUM;
+};
+
+} // namespace nri
@@ -0,0 +1,34 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct MemoryNONE final {
+    inline MemoryNONE(DeviceNONE& device)
+        : m_Device(device) {
+    }
+
+    ~MemoryNONE();
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline uint8_t* GetData() const {
+        return m_Data;
+    }
+
+    inline uint64_t GetSize() const {
+        return m_Size;
+    }
+
+    Result Create(uint64_t size);
+
+private:
+    DeviceNONE& m_Device;
+    uint8_t* m_Data = nullptr;
+    uint64_t m_Size = 0;
+};
+
+} // namespace nri
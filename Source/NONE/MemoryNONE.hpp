@@ -0,0 +1,25 @@
+// © 2021 NVIDIA Corporation
+
+MemoryNONE::~MemoryNONE() {
+    if (m_Data) {
+        const AllocationCallbacks& allocationCallbacks = m_Device.GetAllocationCallbacks();
+        allocationCallbacks.Free(allocationCallbacks.userArg, m_Data);
+
+        m_Device.OnMemoryAllocated(-(int64_t)m_Size);
+    }
+}
+
+Result MemoryNONE::Create(uint64_t size) {
+    const AllocationCallbacks& allocationCallbacks = m_Device.GetAllocationCallbacks();
+    m_Data = (uint8_t*)allocationCallbacks.Allocate(allocationCallbacks.userArg, (size_t)size, HOST_MEMORY_ALIGNMENT);
+    if (!m_Data)
+        return Result::OUT_OF_MEMORY;
+
+    m_Size = size;
+    m_Device.OnMemoryAllocated((int64_t)size);
+
+    if (m_Device.IsMemoryZeroInitializationEnabled())
+        memset(m_Data, 0, (size_t)size);
+
+    return Result::SUCCESS;
+}
@@ -0,0 +1,50 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct CommandNONE;
+
+// A submission in flight, if "DeviceCreationDesc::noneTiming" is used
+struct SubmissionNONE {
+    inline SubmissionNONE(const StdAllocator<uint8_t>& allocator)
+        : waitFences(allocator)
+        , signalFences(allocator)
+        , commands(allocator) {
+    }
+
+    Vector<FenceSubmitDesc> waitFences;
+    Vector<FenceSubmitDesc> signalFences;
+    Vector<CommandNONE> commands; // a copy, since command buffers can be reset and re-recorded while the submission is in flight
+    uint64_t duration = 0; // ns
+    uint64_t endTime = 0;  // ns, 0 if not started yet
+};
+
+struct QueueNONE final {
+    QueueNONE(DeviceNONE& device, QueueType queueType);
+    ~QueueNONE();
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline QueueType GetType() const {
+        return m_Type;
+    }
+
+    inline bool IsIdle() const {
+        return m_Submissions.empty();
+    }
+
+    Result Submit(const QueueSubmitDesc& queueSubmitDesc);
+    bool Simulate(uint64_t now, uint64_t& nextTime); // called under "DeviceNONE" timing lock, returns "true" if something has completed
+
+private:
+    DeviceNONE& m_Device;
+    Vector<SubmissionNONE*> m_Submissions; // in submission order
+    uint64_t m_BusyUntil = 0;             // ns
+    QueueType m_Type = QueueType::GRAPHICS;
+};
+
+} // namespace nri
@@ -0,0 +1,90 @@
+// © 2021 NVIDIA Corporation
+
+QueueNONE::QueueNONE(DeviceNONE& device, QueueType queueType)
+    : m_Device(device)
+    , m_Submissions(device.GetStdAllocator())
+    , m_Type(queueType) {
+}
+
+QueueNONE::~QueueNONE() {
+    for (SubmissionNONE* submission : m_Submissions)
+        Destroy(m_Device.GetAllocationCallbacks(), submission);
+}
+
+Result QueueNONE::Submit(const QueueSubmitDesc& queueSubmitDesc) {
+    // Without the timing model work completes immediately
+    if (!m_Device.IsTimingEnabled()) {
+        for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+            const Vector<CommandNONE>& commands = ((CommandBufferNONE*)queueSubmitDesc.commandBuffers[i])->GetCommands();
+            CommandBufferNONE::Execute(commands.data(), commands.size());
+        }
+
+        for (uint32_t i = 0; i < queueSubmitDesc.signalFenceNum; i++) {
+            const FenceSubmitDesc& fenceSubmitDesc = queueSubmitDesc.signalFences[i];
+            ((FenceNONE*)fenceSubmitDesc.fence)->Signal(fenceSubmitDesc.value);
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // The command stream is copied outside of the lock, since it's executed later on the timing thread
+    SubmissionNONE* submission = Allocate<SubmissionNONE>(m_Device.GetAllocationCallbacks(), m_Device.GetStdAllocator());
+    if (!submission)
+        return Result::OUT_OF_MEMORY;
+
+    submission->waitFences.assign(queueSubmitDesc.waitFences, queueSubmitDesc.waitFences + queueSubmitDesc.waitFenceNum);
+    submission->signalFences.assign(queueSubmitDesc.signalFences, queueSubmitDesc.signalFences + queueSubmitDesc.signalFenceNum);
+    submission->duration = m_Device.GetTimingDesc().submitLatency;
+
+    for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+        const CommandBufferNONE* commandBuffer = (CommandBufferNONE*)queueSubmitDesc.commandBuffers[i];
+        const Vector<CommandNONE>& commands = commandBuffer->GetCommands();
+
+        submission->commands.insert(submission->commands.end(), commands.begin(), commands.end());
+        submission->duration += commandBuffer->GetDuration(m_Device.GetTimingDesc());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Device.GetTimingLock());
+        m_Submissions.push_back(submission);
+    }
+
+    m_Device.OnSubmit();
+
+    return Result::SUCCESS;
+}
+
+bool QueueNONE::Simulate(uint64_t now, uint64_t& nextTime) {
+    bool isCompleted = false;
+
+    // Submissions on a queue are serialized, i.e. a submission starts when waits are satisfied and the previous one is done
+    while (!m_Submissions.empty()) {
+        SubmissionNONE& submission = *m_Submissions.front();
+
+        if (!submission.endTime) {
+            for (const FenceSubmitDesc& fenceSubmitDesc : submission.waitFences) {
+                if (((FenceNONE*)fenceSubmitDesc.fence)->GetValue() < fenceSubmitDesc.value)
+                    return isCompleted;
+            }
+
+            submission.endTime = std::max(now, m_BusyUntil) + submission.duration;
+            m_BusyUntil = submission.endTime;
+        }
+
+        if (submission.endTime > now) {
+            nextTime = std::min(nextTime, submission.endTime);
+            return isCompleted;
+        }
+
+        CommandBufferNONE::Execute(submission.commands.data(), submission.commands.size());
+
+        for (const FenceSubmitDesc& fenceSubmitDesc : submission.signalFences)
+            ((FenceNONE*)fenceSubmitDesc.fence)->Signal(fenceSubmitDesc.value);
+
+        Destroy(m_Device.GetAllocationCallbacks(), &submission);
+        m_Submissions.erase(m_Submissions.begin());
+        isCompleted = true;
+    }
+
+    return isCompleted;
+}
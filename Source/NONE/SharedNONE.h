@@ -0,0 +1,66 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+#include "SharedExternal.h"
+
+#include <algorithm> // clamp
+#include <chrono>
+#include <cmath> // lround
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Host objects are used if "DeviceCreationDesc::enableNONEHostEmulation" is set (otherwise all objects are dummies)
+
+namespace nri {
+
+constexpr uint32_t QUEUE_NUM = 4;
+constexpr uint32_t HOST_MEMORY_ALIGNMENT = 64;
+
+// Texture layout in host memory: layers go one after another, each layer is a tightly packed mip chain
+inline uint32_t GetTextureRowPitch(const TextureDesc& textureDesc, Dim_t mip) {
+    const FormatProps& formatProps = GetFormatProps(textureDesc.format);
+    Dim_t w = GetDimension(GraphicsAPI::NONE, textureDesc, 0, mip);
+
+    return ((w + formatProps.blockWidth - 1) / formatProps.blockWidth) * formatProps.stride;
+}
+
+inline uint32_t GetTextureSlicePitch(const TextureDesc& textureDesc, Dim_t mip) {
+    const FormatProps& formatProps = GetFormatProps(textureDesc.format);
+    Dim_t h = GetDimension(GraphicsAPI::NONE, textureDesc, 1, mip);
+
+    return ((h + formatProps.blockHeight - 1) / formatProps.blockHeight) * GetTextureRowPitch(textureDesc, mip);
+}
+
+inline uint64_t GetTextureMipSize(const TextureDesc& textureDesc, Dim_t mip) {
+    Dim_t d = GetDimension(GraphicsAPI::NONE, textureDesc, 2, mip);
+
+    return (uint64_t)GetTextureSlicePitch(textureDesc, mip) * d * textureDesc.sampleNum;
+}
+
+inline uint64_t GetTextureSubresourceOffset(const TextureDesc& textureDesc, Dim_t mip, Dim_t layer) {
+    uint64_t layerSize = 0;
+    uint64_t offset = 0;
+
+    for (Dim_t i = 0; i < textureDesc.mipNum; i++) {
+        if (i == mip)
+            offset = layerSize;
+
+        layerSize += GetTextureMipSize(textureDesc, i);
+    }
+
+    return layer * layerSize + offset;
+}
+
+inline uint64_t GetTextureSize(const TextureDesc& textureDesc) {
+    return GetTextureSubresourceOffset(textureDesc, 0, textureDesc.layerNum);
+}
+
+inline uint64_t GetTimeNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace nri
+
+#include "DeviceNONE.h"
@@ -0,0 +1,35 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct SwapChainNONE final {
+    SwapChainNONE(DeviceNONE& device);
+    ~SwapChainNONE();
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline Texture* const* GetTextures(uint32_t& textureNum) const {
+        textureNum = (uint32_t)m_Textures.size();
+
+        return m_Textures.data();
+    }
+
+    inline uint32_t AcquireNextTexture() {
+        m_TextureIndex = (m_TextureIndex + 1) % (uint32_t)m_Textures.size();
+
+        return m_TextureIndex;
+    }
+
+    Result Create(const SwapChainDesc& swapChainDesc);
+
+private:
+    DeviceNONE& m_Device;
+    Vector<Texture*> m_Textures;
+    uint32_t m_TextureIndex = 0;
+};
+
+} // namespace nri
@@ -0,0 +1,43 @@
+// © 2021 NVIDIA Corporation
+
+SwapChainNONE::SwapChainNONE(DeviceNONE& device)
+    : m_Device(device)
+    , m_Textures(device.GetStdAllocator()) {
+}
+
+SwapChainNONE::~SwapChainNONE() {
+    for (Texture* texture : m_Textures)
+        Destroy((TextureNONE*)texture);
+}
+
+Result SwapChainNONE::Create(const SwapChainDesc& swapChainDesc) {
+    Format format = Format::BGRA8_UNORM;
+    if (swapChainDesc.format == SwapChainFormat::BT709_G10_16BIT)
+        format = Format::RGBA16_SFLOAT;
+    else if (swapChainDesc.format == SwapChainFormat::BT709_G22_10BIT || swapChainDesc.format == SwapChainFormat::BT2020_G2084_10BIT)
+        format = Format::R10_G10_B10_A2_UNORM;
+
+    TextureDesc textureDesc = {};
+    textureDesc.type = TextureType::TEXTURE_2D;
+    textureDesc.usage = TextureUsageBits::COLOR_ATTACHMENT;
+    textureDesc.format = format;
+    textureDesc.width = swapChainDesc.width;
+    textureDesc.height = swapChainDesc.height;
+
+    uint32_t textureNum = std::max(swapChainDesc.textureNum, (uint8_t)2);
+    for (uint32_t i = 0; i < textureNum; i++) {
+        TextureNONE* texture = Allocate<TextureNONE>(m_Device.GetAllocationCallbacks(), m_Device, textureDesc);
+        if (!texture)
+            return Result::OUT_OF_MEMORY;
+
+        m_Textures.push_back((Texture*)texture);
+
+        Result result = texture->Create();
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    m_TextureIndex = textureNum - 1;
+
+    return Result::SUCCESS;
+}
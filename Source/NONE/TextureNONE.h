@@ -0,0 +1,44 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct MemoryNONE;
+
+struct TextureNONE final {
+    inline TextureNONE(DeviceNONE& device, const TextureDesc& textureDesc)
+        : m_Device(device)
+        , m_Desc(FixTextureDesc(textureDesc)) {
+    }
+
+    ~TextureNONE();
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline const TextureDesc& GetDesc() const {
+        return m_Desc;
+    }
+
+    inline uint8_t* GetData() const {
+        return m_Data;
+    }
+
+    inline uint8_t* GetSubresourceData(Dim_t mip, Dim_t layer) const {
+        return m_Data + GetTextureSubresourceOffset(m_Desc, mip, layer);
+    }
+
+    void BindMemory(MemoryNONE* memory, uint64_t offset);
+
+    Result Create(); // committed
+
+private:
+    DeviceNONE& m_Device;
+    TextureDesc m_Desc = {};
+    uint8_t* m_Data = nullptr;
+    MemoryNONE* m_Memory = nullptr; // owned
+};
+
+} // namespace nri
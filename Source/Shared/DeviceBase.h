@@ -69,10 +69,18 @@ struct DeviceBase : public DebugNameBaseVal {
     virtual ~DeviceBase() {
     }
 
+    virtual Result GetEntryPointStats(EntryPointStats*, uint32_t&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(CoreInterface&) const {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(DeviceGeneratedCommandsInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(HelperInterface&) const {
         return Result::UNSUPPORTED;
     }
@@ -0,0 +1,36 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+// Frame arena ("nriSetFrameArena"):
+// - scratch exceeding "MAX_STACK_ALLOC_SIZE" is carved from a per-thread linear arena (scratch lifetimes are scoped, i.e. LIFO)
+// - an overflow falls back to the heap, the arena grows to the high-water mark at the next frame boundary ("nriResetFrameArena")
+// - when disabled, the scratch heap path costs one relaxed atomic load
+// - after warm-up heap allocations are reported: scratch overflows and, if "Statistics" tracks host allocations, any allocation made
+//   between "BeginCommandBuffer" and "EndCommandBuffer"
+
+namespace nri {
+
+extern std::atomic_bool g_IsFrameArenaEnabled;
+
+void SetFrameArena(const FrameArenaDesc* frameArenaDesc);
+void ResetFrameArena();
+void* AllocateScratchFromFrameArena(const AllocationCallbacks& allocationCallbacks, size_t size, size_t alignment);
+bool FreeScratchFromFrameArena(void* memory); // "false" if "memory" doesn't belong to the arena of the calling thread
+void BeginFrameArenaRecording();
+void EndFrameArenaRecording();
+void OnFrameArenaHostAllocation(size_t size); // reports if the calling thread is recording after warm-up
+
+inline void* AllocateScratch(const AllocationCallbacks& allocationCallbacks, size_t size, size_t alignment) {
+    if (g_IsFrameArenaEnabled.load(std::memory_order_relaxed))
+        return AllocateScratchFromFrameArena(allocationCallbacks, size, alignment);
+
+    return allocationCallbacks.Allocate(allocationCallbacks.userArg, size, alignment);
+}
+
+inline void FreeScratch(const AllocationCallbacks& allocationCallbacks, void* memory) {
+    if (!FreeScratchFromFrameArena(memory)) // the arena can be disabled in the meantime
+        allocationCallbacks.Free(allocationCallbacks.userArg, memory);
+}
+
+} // namespace nri
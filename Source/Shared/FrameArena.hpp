@@ -0,0 +1,127 @@
+// © 2021 NVIDIA Corporation
+
+constexpr size_t FRAME_ARENA_DEFAULT_SIZE = 1024 * 1024;
+constexpr size_t FRAME_ARENA_GRANULARITY = 64 * 1024;
+
+// Owned by a thread, the memory is released on thread exit
+struct FrameArena {
+    ~FrameArena() {
+        free(base);
+    }
+
+    uint8_t* base = nullptr;
+    size_t capacity = 0;
+    size_t offset = 0;
+    size_t highWater = 0;    // including overflows, since the arena creation
+    size_t overflowSize = 0; // heap fallbacks since the last frame boundary
+    uint32_t frame = 0;
+    uint32_t recordingDepth = 0;
+    bool isScratchOverflow = false; // to not report the same allocation twice
+};
+
+std::atomic_bool nri::g_IsFrameArenaEnabled = false;
+
+static FrameArenaDesc g_FrameArenaDesc = {}; // changed only if no recording is in flight
+static std::atomic_uint32_t g_FrameArenaFrame = 0;
+static std::atomic_uint32_t g_FrameArenaSteadyFrame = 0; // heap allocations are reported starting from this frame
+static thread_local FrameArena t_FrameArena;
+
+static void ReportHeapAllocation(size_t size, bool isScratch) {
+    if (g_FrameArenaFrame.load(std::memory_order_relaxed) < g_FrameArenaSteadyFrame.load(std::memory_order_relaxed))
+        return;
+
+    if (g_FrameArenaDesc.HeapAllocationCallback)
+        g_FrameArenaDesc.HeapAllocationCallback(size, isScratch, g_FrameArenaDesc.userArg);
+    else
+        NRI_CHECK(false, "Heap allocation after warm-up");
+}
+
+void nri::SetFrameArena(const FrameArenaDesc* frameArenaDesc) {
+    g_IsFrameArenaEnabled.store(false, std::memory_order_relaxed);
+
+    if (frameArenaDesc) {
+        g_FrameArenaDesc = *frameArenaDesc;
+        if (!g_FrameArenaDesc.arenaSize)
+            g_FrameArenaDesc.arenaSize = FRAME_ARENA_DEFAULT_SIZE;
+
+        g_FrameArenaSteadyFrame.store(g_FrameArenaFrame.load(std::memory_order_relaxed) + frameArenaDesc->warmUpFrameNum, std::memory_order_relaxed);
+        g_IsFrameArenaEnabled.store(true, std::memory_order_release);
+    }
+}
+
+void nri::ResetFrameArena() {
+    g_FrameArenaFrame.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* nri::AllocateScratchFromFrameArena(const AllocationCallbacks& allocationCallbacks, size_t size, size_t alignment) {
+    FrameArena& arena = t_FrameArena;
+
+    // Frame boundary: grow to the high-water mark (possible only if there is no alive scratch)
+    uint32_t frame = g_FrameArenaFrame.load(std::memory_order_relaxed);
+    if (!arena.offset && (arena.frame != frame || !arena.base)) {
+        size_t capacity = Align(std::max(arena.highWater, (size_t)g_FrameArenaDesc.arenaSize), FRAME_ARENA_GRANULARITY);
+        if (capacity > arena.capacity) {
+            free(arena.base);
+
+            arena.base = (uint8_t*)malloc(capacity);
+            arena.capacity = arena.base ? capacity : 0;
+        }
+
+        arena.frame = frame;
+        arena.overflowSize = 0;
+    }
+
+    // Linear allocation
+    size_t begin = arena.base ? Align((size_t)arena.base + arena.offset, alignment) - (size_t)arena.base : arena.offset;
+    size_t end = begin + size;
+    arena.highWater = std::max(arena.highWater, end + arena.overflowSize);
+
+    if (end <= arena.capacity) {
+        arena.offset = end;
+
+        return arena.base + begin;
+    }
+
+    // Overflow
+    arena.overflowSize += size + alignment;
+    arena.highWater = std::max(arena.highWater, arena.offset + arena.overflowSize);
+
+    ReportHeapAllocation(size, true);
+
+    arena.isScratchOverflow = true;
+    void* memory = allocationCallbacks.Allocate(allocationCallbacks.userArg, size, alignment);
+    arena.isScratchOverflow = false;
+
+    return memory;
+}
+
+bool nri::FreeScratchFromFrameArena(void* memory) {
+    FrameArena& arena = t_FrameArena;
+
+    uint8_t* bytes = (uint8_t*)memory;
+    if (bytes < arena.base || bytes >= arena.base + arena.capacity)
+        return false;
+
+    arena.offset = bytes - arena.base; // scratch is freed in the reverse order
+
+    return true;
+}
+
+void nri::BeginFrameArenaRecording() {
+    t_FrameArena.recordingDepth++;
+}
+
+void nri::EndFrameArenaRecording() {
+    FrameArena& arena = t_FrameArena;
+    if (arena.recordingDepth)
+        arena.recordingDepth--;
+}
+
+void nri::OnFrameArenaHostAllocation(size_t size) {
+    if (!g_IsFrameArenaEnabled.load(std::memory_order_relaxed))
+        return;
+
+    const FrameArena& arena = t_FrameArena;
+    if (arena.recordingDepth && !arena.isScratchOverflow)
+        ReportHeapAllocation(size, false);
+}
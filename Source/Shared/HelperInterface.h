@@ -69,4 +69,68 @@ private:
     Vector<BindTextureMemoryDesc> m_TextureBindingDescs;
 };
 
+struct AcquiredCommandBuffer {
+    CommandBuffer* commandBuffer;
+    uint32_t sortKey;
+    uint32_t order; // tie breaker, makes sorting deterministic
+};
+
+// Touched only by the owning thread between "BeginCommandRecorderFrame" and "SubmitCommandRecorderFrame", aligned to avoid false sharing
+struct alignas(64) CommandRecorderSlot {
+    inline CommandRecorderSlot(const StdAllocator<uint8_t>& stdAllocator)
+        : commandBuffers(stdAllocator) {
+    }
+
+    Vector<AcquiredCommandBuffer> commandBuffers; // a pool, reused after "ResetCommandAllocator"
+    CommandAllocator* commandAllocator = nullptr;
+    uint32_t acquiredNum = 0;
+    uint32_t submittedNum = 0; // [0; submittedNum) have been submitted in this frame
+};
+
+struct CommandRecorderImpl final : public DebugNameBase {
+    inline CommandRecorderImpl(Device& device, const CoreInterface& NRI, Queue& queue)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_Queue(queue)
+        , m_Slots(((DeviceBase&)device).GetStdAllocator())
+        , m_Submission(((DeviceBase&)device).GetStdAllocator())
+        , m_CommandBuffers(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    inline const CommandRecorderDesc& GetDesc() const {
+        return m_Desc;
+    }
+
+    ~CommandRecorderImpl();
+
+    Result Create(const CommandRecorderDesc& desc);
+    void BeginFrame();
+    Result AcquireCommandBuffer(uint32_t threadIndex, uint32_t sortKey, CommandBuffer*& commandBuffer);
+    Result Submit(const QueueSubmitDesc& queueSubmitDesc);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) NRI_DEBUG_NAME_OVERRIDE {
+        for (const CommandRecorderSlot& slot : m_Slots)
+            m_iCore.SetDebugName(slot.commandAllocator, name);
+    }
+
+private:
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    Queue& m_Queue;
+    CommandRecorderDesc m_Desc = {};
+    Vector<CommandRecorderSlot> m_Slots; // "queuedFrameNum" x "threadNum"
+    Vector<AcquiredCommandBuffer> m_Submission;
+    Vector<CommandBuffer*> m_CommandBuffers;
+    uint32_t m_FrameIndex = 0;
+    uint32_t m_FrameNum = 0;
+};
+
 } // namespace nri
\ No newline at end of file
@@ -83,6 +83,9 @@ static void DoTransition(const CoreInterface& m_iCore, CommandBuffer* commandBuf
 }
 
 Result HelperDataUpload::UploadData(const TextureUploadDesc* textureUploadDescs, uint32_t textureUploadDescNum, const BufferUploadDesc* bufferUploadDescs, uint32_t bufferUploadDescNum) {
+    NRI_TRACE_SCOPE("UploadData");
+    NRI_ALLOCATION_SCOPE(AllocationTag::HELPER);
+
     Result result = Create(textureUploadDescs, textureUploadDescNum, bufferUploadDescs, bufferUploadDescNum);
 
     if (result == Result::SUCCESS)
@@ -405,6 +408,9 @@ uint32_t HelperDeviceMemoryAllocator::CalculateAllocationNumber(const ResourceGr
 }
 
 Result HelperDeviceMemoryAllocator::AllocateAndBindMemory(const ResourceGroupDesc& resourceGroupDesc, Memory** allocations) {
+    NRI_TRACE_SCOPE("AllocateAndBindMemory");
+    NRI_ALLOCATION_SCOPE(AllocationTag::HELPER);
+
     size_t allocationNum = 0;
     Result result = TryToAllocateAndBindMemory(resourceGroupDesc, allocations, allocationNum);
 
@@ -636,3 +642,110 @@ void HelperDeviceMemoryAllocator::FillMemoryBindingDescs(Texture* const* texture
         m_TextureBindingDescs.push_back(desc);
     }
 }
+
+// Command recorder
+CommandRecorderImpl::~CommandRecorderImpl() {
+    for (CommandRecorderSlot& slot : m_Slots) {
+        for (const AcquiredCommandBuffer& acquiredCommandBuffer : slot.commandBuffers)
+            m_iCore.DestroyCommandBuffer(acquiredCommandBuffer.commandBuffer);
+
+        m_iCore.DestroyCommandAllocator(slot.commandAllocator);
+    }
+}
+
+Result CommandRecorderImpl::Create(const CommandRecorderDesc& desc) {
+    // "BeginFrame" divides by "queuedFrameNum"
+    if (!desc.threadNum || !desc.queuedFrameNum)
+        return Result::INVALID_ARGUMENT;
+
+    m_Desc = desc;
+
+    // Allocators are created upfront, since "CreateCommandAllocator" may lock
+    uint32_t slotNum = desc.threadNum * desc.queuedFrameNum;
+    m_Slots.reserve(slotNum);
+
+    for (uint32_t i = 0; i < slotNum; i++) {
+        CommandRecorderSlot& slot = m_Slots.emplace_back(((DeviceBase&)m_Device).GetStdAllocator());
+
+        Result result = m_iCore.CreateCommandAllocator(m_Queue, slot.commandAllocator);
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    return Result::SUCCESS;
+}
+
+void CommandRecorderImpl::BeginFrame() {
+    m_FrameIndex = m_FrameNum++ % m_Desc.queuedFrameNum;
+
+    for (uint32_t i = 0; i < m_Desc.threadNum; i++) {
+        CommandRecorderSlot& slot = m_Slots[m_FrameIndex * m_Desc.threadNum + i];
+        if (slot.acquiredNum) {
+            m_iCore.ResetCommandAllocator(*slot.commandAllocator);
+            slot.acquiredNum = 0;
+            slot.submittedNum = 0;
+        }
+    }
+}
+
+Result CommandRecorderImpl::AcquireCommandBuffer(uint32_t threadIndex, uint32_t sortKey, CommandBuffer*& commandBuffer) {
+    commandBuffer = nullptr;
+    if (threadIndex >= m_Desc.threadNum)
+        return Result::INVALID_ARGUMENT;
+
+    // Lock-free: only the calling thread touches its slot. "CreateCommandBuffer" is only called until the pool warms up
+    CommandRecorderSlot& slot = m_Slots[m_FrameIndex * m_Desc.threadNum + threadIndex];
+    if (slot.acquiredNum == slot.commandBuffers.size()) {
+        CommandBuffer* newCommandBuffer = nullptr;
+        Result result = m_iCore.CreateCommandBuffer(*slot.commandAllocator, newCommandBuffer);
+        if (result != Result::SUCCESS)
+            return result;
+
+        slot.commandBuffers.push_back({newCommandBuffer, 0, 0});
+    }
+
+    AcquiredCommandBuffer& acquiredCommandBuffer = slot.commandBuffers[slot.acquiredNum++];
+    acquiredCommandBuffer.sortKey = sortKey;
+    commandBuffer = acquiredCommandBuffer.commandBuffer;
+
+    return Result::SUCCESS;
+}
+
+Result CommandRecorderImpl::Submit(const QueueSubmitDesc& queueSubmitDesc) {
+    // Gather in "thread, acquisition" order, which is a deterministic tie breaker for equal sort keys. Command buffers
+    // submitted by a previous call in this frame are skipped (they may be in-flight and can't be submitted again)
+    m_Submission.clear();
+    for (uint32_t i = 0; i < m_Desc.threadNum; i++) {
+        const CommandRecorderSlot& slot = m_Slots[m_FrameIndex * m_Desc.threadNum + i];
+
+        for (uint32_t j = slot.submittedNum; j < slot.acquiredNum; j++) {
+            AcquiredCommandBuffer acquiredCommandBuffer = slot.commandBuffers[j];
+            acquiredCommandBuffer.order = (uint32_t)m_Submission.size();
+
+            m_Submission.push_back(acquiredCommandBuffer);
+        }
+    }
+
+    std::sort(m_Submission.begin(), m_Submission.end(), [](const AcquiredCommandBuffer& a, const AcquiredCommandBuffer& b) {
+        return a.sortKey != b.sortKey ? a.sortKey < b.sortKey : a.order < b.order;
+    });
+
+    m_CommandBuffers.clear();
+    for (const AcquiredCommandBuffer& acquiredCommandBuffer : m_Submission)
+        m_CommandBuffers.push_back(acquiredCommandBuffer.commandBuffer);
+
+    // A single submission
+    QueueSubmitDesc queueSubmitDescCopy = queueSubmitDesc;
+    queueSubmitDescCopy.commandBuffers = m_CommandBuffers.data();
+    queueSubmitDescCopy.commandBufferNum = (uint32_t)m_CommandBuffers.size();
+
+    Result result = m_iCore.QueueSubmit(m_Queue, queueSubmitDescCopy);
+    if (result == Result::SUCCESS) {
+        for (uint32_t i = 0; i < m_Desc.threadNum; i++) {
+            CommandRecorderSlot& slot = m_Slots[m_FrameIndex * m_Desc.threadNum + i];
+            slot.submittedNum = slot.acquiredNum;
+        }
+    }
+
+    return result;
+}
@@ -445,6 +445,8 @@ Result ImguiImpl::Create(const ImguiDesc& imguiDesc) {
 }
 
 void ImguiImpl::CmdCopyData(CommandBuffer& commandBuffer, Streamer& streamer, const CopyImguiDataDesc& copyImguiDataDesc) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::IMGUI);
+
     ExclusiveScope lock(m_Lock);
 
     if (!copyImguiDataDesc.drawListNum)
@@ -643,6 +645,8 @@ void ImguiImpl::CmdCopyData(CommandBuffer& commandBuffer, Streamer& streamer, co
 }
 
 void ImguiImpl::CmdDraw(CommandBuffer& commandBuffer, const DrawImguiDesc& drawImguiDesc) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::IMGUI);
+
     ExclusiveScope lock(m_Lock);
 
     if (!drawImguiDesc.drawListNum)
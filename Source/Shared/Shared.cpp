@@ -14,5 +14,7 @@ using namespace nri;
 #include "StreamerInterface.hpp"
 #include "UpscalerInterface.hpp"
 
+#include "FrameArena.hpp"
 #include "SharedExternal.hpp"
 #include "SharedLibrary.hpp"
+#include "Tracer.hpp"
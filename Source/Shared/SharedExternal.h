@@ -28,11 +28,13 @@ typedef uint32_t DXGI_FORMAT;
 #include "NRI.hlsl"
 
 #include "Extensions/NRIDeviceCreation.h"
+#include "Extensions/NRIDeviceGeneratedCommands.h"
 #include "Extensions/NRIHelper.h"
 #include "Extensions/NRIImgui.h"
 #include "Extensions/NRILowLatency.h"
 #include "Extensions/NRIMeshShader.h"
 #include "Extensions/NRIRayTracing.h"
+#include "Extensions/NRIStatistics.h"
 #include "Extensions/NRIStreamer.h"
 #include "Extensions/NRISwapChain.h"
 #include "Extensions/NRIUpscaler.h"
@@ -42,6 +44,8 @@ typedef uint32_t DXGI_FORMAT;
 #include "Extensions/NRIWrapperWebGPU.h"
 
 #include "Lock.h"
+#include "FrameArena.h"
+#include "Tracer.h"
 
 // ComPtr
 #if (NRI_ENABLE_D3D11_SUPPORT || NRI_ENABLE_D3D12_SUPPORT)
@@ -174,7 +178,7 @@ public:
 
     ~Scratch() {
         if (m_IsHeap)
-            m_Allocator.Free(m_Allocator.userArg, m_Mem);
+            FreeScratch(m_Allocator, m_Mem);
     }
 
     inline operator T*() const {
@@ -243,6 +247,49 @@ inline void Destroy(const AllocationCallbacks& allocationCallbacks, T* object) {
     }
 }
 
+// Host allocation tagging ("NRIStatistics"): the innermost scope wins, "MAX_NUM" means "not in a scope"
+#if NRI_ENABLE_STATISTICS_SUPPORT
+
+extern thread_local AllocationTag t_AllocationTag;
+
+struct AllocationScope {
+    inline AllocationScope(AllocationTag tag)
+        : m_PrevTag(t_AllocationTag) {
+        t_AllocationTag = tag;
+    }
+
+    inline ~AllocationScope() {
+        t_AllocationTag = m_PrevTag;
+    }
+
+private:
+    AllocationTag m_PrevTag;
+};
+
+#    define NRI_ALLOCATION_SCOPE(tag) AllocationScope _allocationScope(tag)
+
+#else
+
+#    define NRI_ALLOCATION_SCOPE(tag)
+
+#endif
+
+template <typename Interface>
+constexpr AllocationTag GetAllocationTag() {
+    if constexpr (std::is_same_v<Interface, CommandAllocator> || std::is_same_v<Interface, CommandBuffer>)
+        return AllocationTag::COMMAND;
+    else if constexpr (std::is_same_v<Interface, DescriptorPool> || std::is_same_v<Interface, DescriptorSet> || std::is_same_v<Interface, Descriptor>)
+        return AllocationTag::DESCRIPTOR;
+    else if constexpr (std::is_same_v<Interface, PipelineLayout> || std::is_same_v<Interface, Pipeline> || std::is_same_v<Interface, IndirectCommandLayout> || std::is_same_v<Interface, IndirectExecutionSet>)
+        return AllocationTag::PIPELINE;
+    else if constexpr (std::is_same_v<Interface, Buffer> || std::is_same_v<Interface, Texture> || std::is_same_v<Interface, Memory> || std::is_same_v<Interface, AccelerationStructure> || std::is_same_v<Interface, Micromap>)
+        return AllocationTag::RESOURCE;
+    else if constexpr (std::is_same_v<Interface, SwapChain>)
+        return AllocationTag::SWAP_CHAIN;
+    else
+        return AllocationTag::DEVICE;
+}
+
 constexpr uint64_t MsToUs(uint32_t x) {
     return x * 1000000ull;
 }
@@ -507,6 +554,13 @@ struct DisplayDescHelper {
         return returnCode; \
     }
 
+// Lightweight argument checks compiled directly into backends: no wrapper objects, no allocations
+#if NRI_ENABLE_INLINE_VALIDATION
+#    define NRI_VALIDATE_ARGUMENT(deviceBase, condition, returnCode, format, ...) NRI_RETURN_ON_FAILURE(deviceBase, condition, returnCode, format, ##__VA_ARGS__)
+#else
+#    define NRI_VALIDATE_ARGUMENT(deviceBase, condition, returnCode, format, ...)
+#endif
+
 #define NRI_REPORT_INFO(deviceBase, format, ...)    (deviceBase)->ReportMessage(Message::INFO, Result::SUCCESS, __FILE__, __LINE__, format, ##__VA_ARGS__)
 #define NRI_REPORT_WARNING(deviceBase, format, ...) (deviceBase)->ReportMessage(Message::WARNING, Result::SUCCESS, __FILE__, __LINE__, "%s(): " format, __FUNCTION__, ##__VA_ARGS__)
 #define NRI_REPORT_ERROR(deviceBase, format, ...)   (deviceBase)->ReportMessage(Message::ERROR, Result::FAILURE, __FILE__, __LINE__, "%s(): " format, __FUNCTION__, ##__VA_ARGS__)
@@ -534,7 +588,7 @@ struct DisplayDescHelper {
         (device).GetAllocationCallbacks(), \
         !(elementNum) ? nullptr : ( \
             ((elementNum) * sizeof(T) + alignof(T)) > MAX_STACK_ALLOC_SIZE \
-                ? (T*)(device).GetAllocationCallbacks().Allocate((device).GetAllocationCallbacks().userArg, (elementNum) * sizeof(T), alignof(T)) \
+                ? (T*)AllocateScratch((device).GetAllocationCallbacks(), (elementNum) * sizeof(T), alignof(T)) \
                 : (T*)Align((T*)alloca((elementNum) * sizeof(T) + alignof(T)), alignof(T)) \
         ), \
         (elementNum) \
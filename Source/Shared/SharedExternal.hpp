@@ -819,6 +819,10 @@ Format nri::VKFormatToNRIFormat(uint32_t format) {
     return Format::UNKNOWN;
 }
 
+#if NRI_ENABLE_STATISTICS_SUPPORT
+thread_local AllocationTag nri::t_AllocationTag = AllocationTag::MAX_NUM; // not in a scope
+#endif
+
 void DeviceBase::ReportMessage(Message messageType, Result result, const char* file, uint32_t line, const char* format, ...) const {
     // Report message
     if (m_CallbackInterface.MessageCallback) { // TODO: "MessageCallback" actually can't be "NULL"
@@ -48,6 +48,8 @@ Result StreamerImpl::Create(const StreamerDesc& desc) {
 }
 
 uint32_t StreamerImpl::StreamConstantData(const void* data, uint32_t dataSize) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::STREAMER);
+
 #if NRI_STREAMER_THREAD_SAFE
     ExclusiveScope lock(m_Lock);
 #endif
@@ -77,6 +79,8 @@ uint32_t StreamerImpl::StreamConstantData(const void* data, uint32_t dataSize) {
 }
 
 BufferOffset StreamerImpl::StreamBufferData(const StreamBufferDataDesc& streamBufferDataDesc) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::STREAMER);
+
 #if NRI_STREAMER_THREAD_SAFE
     ExclusiveScope lock(m_Lock);
 #endif
@@ -125,6 +129,8 @@ BufferOffset StreamerImpl::StreamBufferData(const StreamBufferDataDesc& streamBu
 }
 
 BufferOffset StreamerImpl::StreamTextureData(const StreamTextureDataDesc& streamTextureDataDesc) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::STREAMER);
+
 #if NRI_STREAMER_THREAD_SAFE
     ExclusiveScope lock(m_Lock);
 #endif
@@ -188,6 +194,9 @@ BufferOffset StreamerImpl::StreamTextureData(const StreamTextureDataDesc& stream
 }
 
 void StreamerImpl::CmdCopyStreamedData(CommandBuffer& commandBuffer) {
+    NRI_TRACE_SCOPE("CmdCopyStreamedData");
+    NRI_ALLOCATION_SCOPE(AllocationTag::STREAMER);
+
 #if NRI_STREAMER_THREAD_SAFE
     ExclusiveScope lock(m_Lock);
 #endif
@@ -208,6 +217,8 @@ void StreamerImpl::CmdCopyStreamedData(CommandBuffer& commandBuffer) {
 }
 
 void StreamerImpl::EndFrame() {
+    NRI_ALLOCATION_SCOPE(AllocationTag::STREAMER);
+
     // Process garbage
     for (size_t i = 0; i < m_GarbageInFlight.size(); i++) {
         GarbageInFlight& garbageInFlight = m_GarbageInFlight[i];
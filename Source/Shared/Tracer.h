@@ -0,0 +1,50 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+// Built-in host tracer ("NRI_ENABLE_TRACE_SUPPORT"):
+// - events are appended to per-thread chunked buffers without locks (a thread registers itself once, on the first event)
+// - when the tracer is compiled in but not started, a zone costs one relaxed atomic load
+// - "nriStopTrace" exports buffers as Chrome trace JSON ("chrome://tracing", "ui.perfetto.dev")
+
+#if NRI_ENABLE_TRACE_SUPPORT
+
+namespace nri {
+
+extern std::atomic_bool g_IsTracing;
+
+uint64_t TraceTimestamp();
+void TraceBegin(const char* name);
+void TraceEnd();
+void TraceInstant(const char* name);
+void TraceComplete(const char* name, uint64_t beginTimestamp);
+void TraceThreadName(const char* name);
+void TraceStart();
+bool TraceStop(const char* fileName);
+
+struct TraceScope {
+    inline TraceScope(const char* name)
+        : m_Name(name) {
+        if (g_IsTracing.load(std::memory_order_relaxed))
+            m_Begin = TraceTimestamp();
+    }
+
+    inline ~TraceScope() {
+        if (m_Begin)
+            TraceComplete(m_Name, m_Begin);
+    }
+
+private:
+    const char* m_Name;
+    uint64_t m_Begin = 0;
+};
+
+} // namespace nri
+
+#    define NRI_TRACE_SCOPE(name) nri::TraceScope _traceScope(name)
+
+#else
+
+#    define NRI_TRACE_SCOPE(name)
+
+#endif
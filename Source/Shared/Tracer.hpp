@@ -0,0 +1,281 @@
+// © 2021 NVIDIA Corporation
+
+#if NRI_ENABLE_TRACE_SUPPORT
+
+#    include <chrono>
+
+constexpr uint32_t TRACE_CHUNK_EVENT_NUM = 4096;
+constexpr size_t TRACE_EVENT_NAME_SIZE = 46; // including '\0', an event is 64 bytes
+constexpr size_t TRACE_THREAD_NAME_SIZE = 64;
+
+struct TraceEvent {
+    uint64_t timestamp; // ns
+    uint64_t duration;  // ns, "X" only
+    char phase;         // "B", "E", "X" or "i"
+    char name[TRACE_EVENT_NAME_SIZE];
+};
+
+// The tracer is process-wide ("nriStartTrace" and "nriStopTrace" don't take a device), i.e. there are no "AllocationCallbacks" to use
+// and the global heap is used instead. Extra chunks are freed when a new session starts (by the owner) or after the export (for finished threads)
+struct TraceChunk {
+    TraceEvent events[TRACE_CHUNK_EVENT_NUM];
+    std::atomic_uint32_t eventNum = 0; // published to "TraceStop"
+    std::atomic<TraceChunk*> next = nullptr;
+};
+
+// Written only by the owning thread, records of finished threads are adopted by new threads (i.e. their number is bounded by the peak number of tracing threads)
+struct TraceThread {
+    TraceChunk head;
+    TraceChunk* tail = &head;
+    std::atomic<TraceThread*> next = nullptr; // immutable after registration
+    std::atomic_uint32_t session = 0;
+    std::atomic_bool isOwned = true;
+    uint32_t tid = 0;
+    Lock nameLock;
+    char name[TRACE_THREAD_NAME_SIZE] = {};
+};
+
+struct TraceThreadSlot {
+    ~TraceThreadSlot() {
+        if (thread)
+            thread->isOwned.store(false, std::memory_order_release);
+    }
+
+    TraceThread* thread = nullptr;
+};
+
+std::atomic_bool nri::g_IsTracing = false;
+
+static std::atomic<TraceThread*> g_TraceThreads = nullptr;
+static std::atomic_uint32_t g_TraceThreadNum = 0;
+static std::atomic_uint32_t g_TraceSession = 0;
+static std::atomic_uint64_t g_TraceStartTimestamp = 0;
+static thread_local TraceThreadSlot t_TraceThreadSlot;
+
+static void CopyTraceName(char* dst, size_t dstSize, const char* src) {
+    size_t i = 0;
+    if (src) {
+        for (; i < dstSize - 1 && src[i]; i++)
+            dst[i] = src[i];
+    }
+
+    dst[i] = '\0';
+}
+
+// Must be called by the owner
+static void ResetTraceThread(TraceThread& thread) {
+    TraceChunk* chunk = thread.head.next.load(std::memory_order_relaxed);
+    while (chunk) {
+        TraceChunk* next = chunk->next.load(std::memory_order_relaxed);
+        delete chunk;
+        chunk = next;
+    }
+
+    thread.head.next.store(nullptr, std::memory_order_relaxed);
+    thread.head.eventNum.store(0, std::memory_order_relaxed);
+    thread.tail = &thread.head;
+}
+
+// Records of running threads are reset by their owners in the next session
+static void ResetFinishedTraceThreads() {
+    for (TraceThread* thread = g_TraceThreads.load(std::memory_order_acquire); thread; thread = thread->next.load(std::memory_order_relaxed)) {
+        bool isOwned = false;
+        if (thread->isOwned.compare_exchange_strong(isOwned, true, std::memory_order_acquire)) {
+            ResetTraceThread(*thread);
+            thread->isOwned.store(false, std::memory_order_release);
+        }
+    }
+}
+
+static TraceThread* AcquireTraceThread() {
+    // Adopt a buffer of a finished thread
+    for (TraceThread* thread = g_TraceThreads.load(std::memory_order_acquire); thread; thread = thread->next.load(std::memory_order_relaxed)) {
+        bool isOwned = false;
+        if (thread->isOwned.compare_exchange_strong(isOwned, true, std::memory_order_acquire)) {
+            ExclusiveScope lock(thread->nameLock);
+            thread->name[0] = '\0';
+
+            return thread;
+        }
+    }
+
+    // Or register a new one
+    TraceThread* thread = new TraceThread;
+    thread->tid = g_TraceThreadNum.fetch_add(1, std::memory_order_relaxed) + 1;
+    thread->session.store(g_TraceSession.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    TraceThread* head = g_TraceThreads.load(std::memory_order_relaxed);
+    do
+        thread->next.store(head, std::memory_order_relaxed);
+    while (!g_TraceThreads.compare_exchange_weak(head, thread, std::memory_order_release, std::memory_order_relaxed));
+
+    return thread;
+}
+
+static TraceThread& GetTraceThread() {
+    TraceThreadSlot& slot = t_TraceThreadSlot;
+    if (!slot.thread)
+        slot.thread = AcquireTraceThread();
+
+    // Events from a previous session are dropped lazily by the owner ("TraceStop" skips the buffer until the session is updated)
+    TraceThread& thread = *slot.thread;
+    uint32_t session = g_TraceSession.load(std::memory_order_acquire);
+    if (thread.session.load(std::memory_order_relaxed) != session) {
+        ResetTraceThread(thread);
+        thread.session.store(session, std::memory_order_release);
+    }
+
+    return thread;
+}
+
+static void TraceEmit(char phase, const char* name, uint64_t timestamp, uint64_t duration) {
+    TraceThread& thread = GetTraceThread();
+
+    TraceChunk* chunk = thread.tail;
+    uint32_t eventNum = chunk->eventNum.load(std::memory_order_relaxed);
+    if (eventNum == TRACE_CHUNK_EVENT_NUM) {
+        TraceChunk* next = chunk->next.load(std::memory_order_relaxed);
+        if (!next) {
+            next = new TraceChunk;
+            chunk->next.store(next, std::memory_order_release);
+        }
+
+        thread.tail = chunk = next;
+        eventNum = 0;
+    }
+
+    TraceEvent& event = chunk->events[eventNum];
+    event.timestamp = timestamp;
+    event.duration = duration;
+    event.phase = phase;
+    CopyTraceName(event.name, sizeof(event.name), name);
+
+    chunk->eventNum.store(eventNum + 1, std::memory_order_release);
+}
+
+static void WriteTraceString(FILE* file, const char* s) {
+    fputc('"', file);
+
+    for (; *s; s++) {
+        char c = *s;
+        if (c == '"' || c == '\\')
+            fprintf(file, "\\%c", c);
+        else if ((uint8_t)c < 0x20)
+            fprintf(file, "\\u%04x", c);
+        else
+            fputc(c, file);
+    }
+
+    fputc('"', file);
+}
+
+uint64_t nri::TraceTimestamp() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void nri::TraceBegin(const char* name) {
+    if (g_IsTracing.load(std::memory_order_relaxed))
+        TraceEmit('B', name, TraceTimestamp(), 0);
+}
+
+void nri::TraceEnd() {
+    if (g_IsTracing.load(std::memory_order_relaxed))
+        TraceEmit('E', nullptr, TraceTimestamp(), 0);
+}
+
+void nri::TraceInstant(const char* name) {
+    if (g_IsTracing.load(std::memory_order_relaxed))
+        TraceEmit('i', name, TraceTimestamp(), 0);
+}
+
+void nri::TraceComplete(const char* name, uint64_t beginTimestamp) {
+    TraceEmit('X', name, beginTimestamp, TraceTimestamp() - beginTimestamp);
+}
+
+void nri::TraceThreadName(const char* name) {
+    TraceThreadSlot& slot = t_TraceThreadSlot;
+    if (!slot.thread)
+        slot.thread = AcquireTraceThread();
+
+    ExclusiveScope lock(slot.thread->nameLock);
+    CopyTraceName(slot.thread->name, sizeof(slot.thread->name), name);
+}
+
+void nri::TraceStart() {
+    g_TraceStartTimestamp.store(TraceTimestamp(), std::memory_order_relaxed);
+    g_TraceSession.fetch_add(1, std::memory_order_release);
+    g_IsTracing.store(true, std::memory_order_release);
+}
+
+bool nri::TraceStop(const char* fileName) {
+    g_IsTracing.store(false, std::memory_order_relaxed);
+
+    if (!fileName) {
+        ResetFinishedTraceThreads();
+        return true;
+    }
+
+    FILE* file = fopen(fileName, "w");
+    if (!file) {
+        ResetFinishedTraceThreads();
+        return false;
+    }
+
+    uint32_t session = g_TraceSession.load(std::memory_order_acquire);
+    uint64_t startTimestamp = g_TraceStartTimestamp.load(std::memory_order_relaxed);
+    const char* separator = "\n";
+
+    fprintf(file, "{\"traceEvents\":[");
+
+    for (TraceThread* thread = g_TraceThreads.load(std::memory_order_acquire); thread; thread = thread->next.load(std::memory_order_relaxed)) {
+        if (thread->session.load(std::memory_order_acquire) != session)
+            continue;
+
+        { // Thread name
+            ExclusiveScope lock(thread->nameLock);
+
+            if (thread->name[0]) {
+                fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", separator, thread->tid);
+                WriteTraceString(file, thread->name);
+                fprintf(file, "}}");
+                separator = ",\n";
+            }
+        }
+
+        // Events (a writer may keep appending, only published events are exported)
+        for (TraceChunk* chunk = &thread->head; chunk; chunk = chunk->next.load(std::memory_order_acquire)) {
+            uint32_t eventNum = chunk->eventNum.load(std::memory_order_acquire);
+
+            for (uint32_t i = 0; i < eventNum; i++) {
+                const TraceEvent& event = chunk->events[i];
+                double ts = event.timestamp > startTimestamp ? (event.timestamp - startTimestamp) * 0.001 : 0.0;
+
+                fprintf(file, "%s{\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u", separator, event.phase, ts, thread->tid);
+                separator = ",\n";
+
+                if (event.phase != 'E') {
+                    fprintf(file, ",\"name\":");
+                    WriteTraceString(file, event.name);
+                }
+
+                if (event.phase == 'X')
+                    fprintf(file, ",\"dur\":%.3f", event.duration * 0.001);
+                else if (event.phase == 'i')
+                    fprintf(file, ",\"s\":\"t\"");
+
+                fputc('}', file);
+            }
+        }
+    }
+
+    fprintf(file, "\n],\"displayTimeUnit\":\"ns\"}\n");
+
+    bool isWritten = !ferror(file);
+    fclose(file);
+
+    ResetFinishedTraceThreads();
+
+    return isWritten;
+}
+
+#endif
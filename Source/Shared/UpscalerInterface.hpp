@@ -1194,6 +1194,8 @@ void UpscalerImpl::GetUpscalerProps(UpscalerProps& upscalerProps) const {
 }
 
 void UpscalerImpl::CmdDispatchUpscale(CommandBuffer& commandBuffer, const DispatchUpscaleDesc& dispatchUpscaleDesc) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::UPSCALER);
+
     const UpscalerResource& output = dispatchUpscaleDesc.output;
     const UpscalerResource& input = dispatchUpscaleDesc.input;
 
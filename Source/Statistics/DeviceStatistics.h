@@ -0,0 +1,113 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct HostAllocationTracker;
+
+struct HostAllocationCounters {
+    std::atomic_uint64_t liveBytes = 0;
+    std::atomic_uint64_t peakBytes = 0;
+    std::atomic_uint64_t allocationNum = 0;
+    std::atomic_uint32_t liveAllocationNum = 0;
+    std::atomic_uint32_t frameAllocationNum = 0;     // current frame
+    std::atomic_uint32_t lastFrameAllocationNum = 0; // previous frame
+};
+
+// "userArg" of tracked "AllocationCallbacks": "AllocationScope" wins, otherwise the tag of the layer owning the callbacks ("MAX_NUM" for the device)
+struct HostAllocationView {
+    HostAllocationTracker* tracker;
+    AllocationTag tag;
+};
+
+// Replaces "AllocationCallbacks" of a device before its creation, the original callbacks are called underneath
+struct HostAllocationTracker {
+    HostAllocationTracker(const AllocationCallbacks& allocationCallbacks);
+
+    inline const AllocationCallbacks& GetAllocationCallbacks() const {
+        return m_AllocationCallbacks;
+    }
+
+    inline void* GetView(AllocationTag tag) {
+        return &m_Views[(size_t)tag];
+    }
+
+    void* Allocate(size_t size, size_t alignment, AllocationTag tag);
+    void* Reallocate(void* memory, size_t size, size_t alignment, AllocationTag tag);
+    void Free(void* memory);
+    void GetStats(HostMemoryStats& hostMemoryStats) const;
+    void EndFrame();
+
+private:
+    AllocationCallbacks m_AllocationCallbacks = {};
+    std::array<HostAllocationView, (size_t)AllocationTag::MAX_NUM + 1> m_Views = {};
+    std::array<HostAllocationCounters, (size_t)AllocationTag::MAX_NUM + 1> m_Counters; // the last one is "total"
+};
+
+struct LiveObject {
+    String name;
+    uint64_t hostBytes;
+    uint64_t deviceBytes;
+    ObjectType type;
+};
+
+struct CommandBufferStats {
+    CommandStats stats;
+    const Pipeline* pipeline; // currently bound, to detect switches
+};
+
+// Not a device wrapper: it's attached to a device and instruments function tables returned by "nriGetInterface",
+// i.e. without "enableStatistics" entry points stay untouched and cost nothing
+struct DeviceStatistics {
+    DeviceStatistics(const DeviceCreationDesc& desc, DeviceBase& device);
+    ~DeviceStatistics();
+
+    inline DeviceBase& GetDevice() const {
+        return m_Device;
+    }
+
+    inline const CoreInterface& GetCoreImpl() const {
+        return m_CoreImpl;
+    }
+
+    inline const MeshShaderInterface& GetMeshShaderImpl() const {
+        return m_MeshShaderImpl;
+    }
+
+    inline const RayTracingInterface& GetRayTracingImpl() const {
+        return m_RayTracingImpl;
+    }
+
+    bool Create();
+    CommandBufferStats& GetCommandBufferStats(const CommandBuffer& commandBuffer);
+    void OnDestroyCommandBuffer(const CommandBuffer& commandBuffer);
+    void OnQueueSubmit(const Queue& queue, const QueueSubmitDesc& queueSubmitDesc);
+    void GetQueueSubmitStats(const Queue& queue, CommandStats& commandStats);
+    void EndFrame(CommandStats& frameStats);
+    void GetHostMemoryStats(HostMemoryStats& hostMemoryStats) const;
+    void OnCreateObject(ObjectType type, const void* object, uint64_t hostBytes, uint64_t deviceBytes);
+    void OnDestroyObject(const void* object);
+    void OnSetDebugName(const void* object, const char* name);
+    void GetObjectCensus(ObjectCensus& objectCensus);
+    void GetLiveObjects(LiveObjectDesc* liveObjectDescs, uint32_t& liveObjectDescNum);
+
+    uint64_t GetTextureRegionSize(const Texture& texture, const TextureRegionDesc* region) const;
+    uint64_t GetBufferRangeSize(const Buffer& buffer, uint64_t offset, uint64_t size) const;
+
+private:
+    DeviceBase& m_Device;
+    CoreInterface m_CoreImpl = {};
+    MeshShaderInterface m_MeshShaderImpl = {};
+    RayTracingInterface m_RayTracingImpl = {};
+    UnorderedMap<const CommandBuffer*, CommandBufferStats*> m_CommandBuffers;
+    UnorderedMap<const Queue*, CommandStats> m_QueueSubmits;
+    UnorderedMap<const void*, LiveObject> m_LiveObjects;
+    HostAllocationTracker* m_HostAllocationTracker = nullptr;
+    CommandStats m_FrameStats = {};
+    ObjectCensus m_ObjectCensus = {};
+    Lock m_Lock;
+    bool m_IsHostAllocationReportEnabled = false;
+};
+
+} // namespace nri
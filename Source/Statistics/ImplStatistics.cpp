@@ -0,0 +1,1317 @@
+// © 2021 NVIDIA Corporation
+
+#include "SharedExternal.h"
+
+#include "DeviceStatistics.h"
+
+using namespace nri;
+
+// Command buffers are not wrapped, entry points find the device here
+static DeviceStatistics* g_DeviceStatistics = nullptr;
+
+// Command buffers are recorded in bursts, the last used one is cached per thread. The cache is invalidated by
+// bumping the epoch on command buffer destruction (the global counter is never reset, stale caches can't match)
+struct StatisticsCache {
+    const CommandBuffer* commandBuffer;
+    CommandBufferStats* commandBufferStats;
+    uint64_t epoch;
+};
+
+static std::atomic_uint64_t g_Epoch = 1;
+static thread_local StatisticsCache t_Cache = {};
+
+// Net tracked host bytes allocated by the calling thread, the difference around a "Create" call is attributed to the created object
+static thread_local int64_t t_HostBytes = 0;
+
+// Precedes every tracked allocation
+struct HostAllocationHeader {
+    uint64_t size;
+    uint32_t offset; // from the original allocation
+    AllocationTag tag;
+};
+
+constexpr size_t HOST_ALLOCATION_HEADER_SIZE = 16;
+static_assert(sizeof(HostAllocationHeader) <= HOST_ALLOCATION_HEADER_SIZE, "Unexpected");
+
+constexpr std::array<const char*, (size_t)AllocationTag::MAX_NUM> g_AllocationTagNames = {
+    "DEVICE",     // DEVICE
+    "COMMAND",    // COMMAND
+    "DESCRIPTOR", // DESCRIPTOR
+    "PIPELINE",   // PIPELINE
+    "RESOURCE",   // RESOURCE
+    "SWAP_CHAIN", // SWAP_CHAIN
+    "VALIDATION", // VALIDATION
+    "CAPTURE",    // CAPTURE
+    "HELPER",     // HELPER
+    "STREAMER",   // STREAMER
+    "IMGUI",      // IMGUI
+    "UPSCALER",   // UPSCALER
+};
+NRI_VALIDATE_ARRAY_BY_PTR(g_AllocationTagNames);
+
+constexpr std::array<const char*, (size_t)ObjectType::MAX_NUM> g_ObjectTypeNames = {
+    "COMMAND_ALLOCATOR",      // COMMAND_ALLOCATOR
+    "COMMAND_BUFFER",         // COMMAND_BUFFER
+    "FENCE",                  // FENCE
+    "QUERY_POOL",             // QUERY_POOL
+    "DESCRIPTOR_POOL",        // DESCRIPTOR_POOL
+    "DESCRIPTOR",             // DESCRIPTOR
+    "PIPELINE_LAYOUT",        // PIPELINE_LAYOUT
+    "PIPELINE",               // PIPELINE
+    "MEMORY",                 // MEMORY
+    "BUFFER",                 // BUFFER
+    "TEXTURE",                // TEXTURE
+    "ACCELERATION_STRUCTURE", // ACCELERATION_STRUCTURE
+    "MICROMAP",               // MICROMAP
+};
+NRI_VALIDATE_ARRAY_BY_PTR(g_ObjectTypeNames);
+
+static void Accumulate(CommandStats& dst, const CommandStats& src) {
+    dst.copyBytes += src.copyBytes;
+    dst.drawNum += src.drawNum;
+    dst.drawIndirectNum += src.drawIndirectNum;
+    dst.dispatchNum += src.dispatchNum;
+    dst.dispatchIndirectNum += src.dispatchIndirectNum;
+    dst.barrierNum += src.barrierNum;
+    dst.globalBarrierNum += src.globalBarrierNum;
+    dst.bufferBarrierNum += src.bufferBarrierNum;
+    dst.textureBarrierNum += src.textureBarrierNum;
+    dst.descriptorSetBindNum += src.descriptorSetBindNum;
+    dst.rootBindNum += src.rootBindNum;
+    dst.pipelineLayoutBindNum += src.pipelineLayoutBindNum;
+    dst.pipelineBindNum += src.pipelineBindNum;
+    dst.pipelineSwitchNum += src.pipelineSwitchNum;
+    dst.renderingNum += src.renderingNum;
+    dst.copyNum += src.copyNum;
+    dst.clearNum += src.clearNum;
+    dst.commandBufferNum += src.commandBufferNum;
+    dst.submitNum += src.submitNum;
+}
+
+static inline CommandBufferStats& Get(const CommandBuffer& commandBuffer) {
+    return g_DeviceStatistics->GetCommandBufferStats(commandBuffer);
+}
+
+static inline const CoreInterface& Core() {
+    return g_DeviceStatistics->GetCoreImpl();
+}
+
+static inline const RayTracingInterface& RayTracing() {
+    return g_DeviceStatistics->GetRayTracingImpl();
+}
+
+static inline void OnCreateObject(ObjectType type, const void* object, int64_t hostBytesBefore, uint64_t deviceBytes) {
+    int64_t hostBytes = t_HostBytes - hostBytesBefore;
+    g_DeviceStatistics->OnCreateObject(type, object, hostBytes > 0 ? (uint64_t)hostBytes : 0, deviceBytes);
+}
+
+// "memory = NULL" means a VMA-backed heap, the memory location is encoded in "offset" (see "NriDeviceHeap")
+static inline bool IsHeapPlacement(const Memory* memory) {
+    return memory == nullptr;
+}
+
+//============================================================================================================================================================================================
+#pragma region[  Core  ]
+
+static void NRI_CALL SetDebugName(Object* object, const char* name) {
+    g_DeviceStatistics->OnSetDebugName(object, name);
+
+    Core().SetDebugName(object, name);
+}
+
+static Result NRI_CALL CreateCommandAllocator(Queue& queue, CommandAllocator*& commandAllocator) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateCommandAllocator(queue, commandAllocator);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::COMMAND_ALLOCATOR, commandAllocator, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, CommandBuffer*& commandBuffer) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateCommandBuffer(commandAllocator, commandBuffer);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::COMMAND_BUFFER, commandBuffer, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateReusableCommandBuffer(CommandAllocator& commandAllocator, const ReusableCommandBufferDesc& reusableCommandBufferDesc, CommandBuffer*& commandBuffer) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateReusableCommandBuffer(commandAllocator, reusableCommandBufferDesc, commandBuffer);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::COMMAND_BUFFER, commandBuffer, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommandBuffers(CommandAllocator& commandAllocator, CommandBuffer** commandBuffers, uint32_t commandBufferNum) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateCommandBuffers(commandAllocator, commandBuffers, commandBufferNum);
+    if (result == Result::SUCCESS) {
+        // Host memory is shared evenly (wrappers are allocated at once)
+        int64_t hostBytesPerObject = (t_HostBytes - hostBytes) / (int64_t)commandBufferNum;
+        for (uint32_t i = 0; i < commandBufferNum; i++)
+            g_DeviceStatistics->OnCreateObject(ObjectType::COMMAND_BUFFER, commandBuffers[i], hostBytesPerObject > 0 ? (uint64_t)hostBytesPerObject : 0, 0);
+    }
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommandBundle(CommandAllocator& commandAllocator, const CommandBundleDesc& commandBundleDesc, CommandBuffer*& commandBundle) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateCommandBundle(commandAllocator, commandBundleDesc, commandBundle);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::COMMAND_BUFFER, commandBundle, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateFence(device, initialValue, fence);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::FENCE, fence, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateDescriptorPool(Device& device, const DescriptorPoolDesc& descriptorPoolDesc, DescriptorPool*& descriptorPool) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateDescriptorPool(device, descriptorPoolDesc, descriptorPool);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::DESCRIPTOR_POOL, descriptorPool, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreatePipelineLayout(Device& device, const PipelineLayoutDesc& pipelineLayoutDesc, PipelineLayout*& pipelineLayout) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreatePipelineLayout(device, pipelineLayoutDesc, pipelineLayout);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::PIPELINE_LAYOUT, pipelineLayout, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateGraphicsPipeline(Device& device, const GraphicsPipelineDesc& graphicsPipelineDesc, Pipeline*& pipeline) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateGraphicsPipeline(device, graphicsPipelineDesc, pipeline);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::PIPELINE, pipeline, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateComputePipeline(Device& device, const ComputePipelineDesc& computePipelineDesc, Pipeline*& pipeline) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateComputePipeline(device, computePipelineDesc, pipeline);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::PIPELINE, pipeline, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateQueryPool(Device& device, const QueryPoolDesc& queryPoolDesc, QueryPool*& queryPool) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateQueryPool(device, queryPoolDesc, queryPool);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::QUERY_POOL, queryPool, hostBytes, (uint64_t)queryPoolDesc.capacity * Core().GetQuerySize(*queryPool));
+
+    return result;
+}
+
+static Result NRI_CALL CreateSampler(Device& device, const SamplerDesc& samplerDesc, Descriptor*& sampler) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateSampler(device, samplerDesc, sampler);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::DESCRIPTOR, sampler, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateBufferView(const BufferViewDesc& bufferViewDesc, Descriptor*& bufferView) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateBufferView(bufferViewDesc, bufferView);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::DESCRIPTOR, bufferView, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateTextureView(const TextureViewDesc& textureViewDesc, Descriptor*& textureView) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateTextureView(textureViewDesc, textureView);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::DESCRIPTOR, textureView, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL AllocateMemory(Device& device, const AllocateMemoryDesc& allocateMemoryDesc, Memory*& memory) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().AllocateMemory(device, allocateMemoryDesc, memory);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::MEMORY, memory, hostBytes, allocateMemoryDesc.size);
+
+    return result;
+}
+
+static Result NRI_CALL CreateBuffer(Device& device, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateBuffer(device, bufferDesc, buffer);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::BUFFER, buffer, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateTexture(Device& device, const TextureDesc& textureDesc, Texture*& texture) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateTexture(device, textureDesc, texture);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::TEXTURE, texture, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommittedBuffer(Device& device, MemoryLocation memoryLocation, float priority, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateCommittedBuffer(device, memoryLocation, priority, bufferDesc, buffer);
+    if (result == Result::SUCCESS) {
+        MemoryDesc memoryDesc = {};
+        Core().GetBufferMemoryDesc(*buffer, memoryLocation, memoryDesc);
+
+        OnCreateObject(ObjectType::BUFFER, buffer, hostBytes, memoryDesc.size);
+    }
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommittedTexture(Device& device, MemoryLocation memoryLocation, float priority, const TextureDesc& textureDesc, Texture*& texture) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreateCommittedTexture(device, memoryLocation, priority, textureDesc, texture);
+    if (result == Result::SUCCESS) {
+        MemoryDesc memoryDesc = {};
+        Core().GetTextureMemoryDesc(*texture, memoryLocation, memoryDesc);
+
+        OnCreateObject(ObjectType::TEXTURE, texture, hostBytes, memoryDesc.size);
+    }
+
+    return result;
+}
+
+static Result NRI_CALL CreatePlacedBuffer(Device& device, Memory* memory, uint64_t offset, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreatePlacedBuffer(device, memory, offset, bufferDesc, buffer);
+    if (result == Result::SUCCESS) {
+        MemoryDesc memoryDesc = {};
+        if (IsHeapPlacement(memory))
+            Core().GetBufferMemoryDesc(*buffer, (MemoryLocation)offset, memoryDesc);
+
+        OnCreateObject(ObjectType::BUFFER, buffer, hostBytes, memoryDesc.size);
+    }
+
+    return result;
+}
+
+static Result NRI_CALL CreatePlacedTexture(Device& device, Memory* memory, uint64_t offset, const TextureDesc& textureDesc, Texture*& texture) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = Core().CreatePlacedTexture(device, memory, offset, textureDesc, texture);
+    if (result == Result::SUCCESS) {
+        MemoryDesc memoryDesc = {};
+        if (IsHeapPlacement(memory))
+            Core().GetTextureMemoryDesc(*texture, (MemoryLocation)offset, memoryDesc);
+
+        OnCreateObject(ObjectType::TEXTURE, texture, hostBytes, memoryDesc.size);
+    }
+
+    return result;
+}
+
+static void NRI_CALL DestroyCommandAllocator(CommandAllocator* commandAllocator) {
+    g_DeviceStatistics->OnDestroyObject(commandAllocator);
+
+    Core().DestroyCommandAllocator(commandAllocator);
+}
+
+static void NRI_CALL DestroyCommandBuffer(CommandBuffer* commandBuffer) {
+    if (commandBuffer)
+        g_DeviceStatistics->OnDestroyCommandBuffer(*commandBuffer);
+
+    g_DeviceStatistics->OnDestroyObject(commandBuffer);
+
+    Core().DestroyCommandBuffer(commandBuffer);
+}
+
+static void NRI_CALL DestroyDescriptorPool(DescriptorPool* descriptorPool) {
+    g_DeviceStatistics->OnDestroyObject(descriptorPool);
+
+    Core().DestroyDescriptorPool(descriptorPool);
+}
+
+static void NRI_CALL DestroyBuffer(Buffer* buffer) {
+    g_DeviceStatistics->OnDestroyObject(buffer);
+
+    Core().DestroyBuffer(buffer);
+}
+
+static void NRI_CALL DestroyTexture(Texture* texture) {
+    g_DeviceStatistics->OnDestroyObject(texture);
+
+    Core().DestroyTexture(texture);
+}
+
+static void NRI_CALL DestroyDescriptor(Descriptor* descriptor) {
+    g_DeviceStatistics->OnDestroyObject(descriptor);
+
+    Core().DestroyDescriptor(descriptor);
+}
+
+static void NRI_CALL DestroyPipelineLayout(PipelineLayout* pipelineLayout) {
+    g_DeviceStatistics->OnDestroyObject(pipelineLayout);
+
+    Core().DestroyPipelineLayout(pipelineLayout);
+}
+
+static void NRI_CALL DestroyPipeline(Pipeline* pipeline) {
+    g_DeviceStatistics->OnDestroyObject(pipeline);
+
+    Core().DestroyPipeline(pipeline);
+}
+
+static void NRI_CALL DestroyQueryPool(QueryPool* queryPool) {
+    g_DeviceStatistics->OnDestroyObject(queryPool);
+
+    Core().DestroyQueryPool(queryPool);
+}
+
+static void NRI_CALL DestroyFence(Fence* fence) {
+    g_DeviceStatistics->OnDestroyObject(fence);
+
+    Core().DestroyFence(fence);
+}
+
+static void NRI_CALL FreeMemory(Memory* memory) {
+    g_DeviceStatistics->OnDestroyObject(memory);
+
+    Core().FreeMemory(memory);
+}
+
+static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    CommandBufferStats& commandBufferStats = Get(commandBuffer);
+    commandBufferStats = {};
+
+    Result result = Core().BeginCommandBuffer(commandBuffer, descriptorPool);
+    if (result == Result::SUCCESS)
+        BeginFrameArenaRecording();
+
+    return result;
+}
+
+static Result NRI_CALL EndCommandBuffer(CommandBuffer& commandBuffer) {
+    EndFrameArenaRecording();
+
+    return Core().EndCommandBuffer(commandBuffer);
+}
+
+static void NRI_CALL CmdSetPipelineLayout(CommandBuffer& commandBuffer, BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
+    Get(commandBuffer).stats.pipelineLayoutBindNum++;
+
+    Core().CmdSetPipelineLayout(commandBuffer, bindPoint, pipelineLayout);
+}
+
+static void NRI_CALL CmdSetDescriptorSet(CommandBuffer& commandBuffer, const SetDescriptorSetDesc& setDescriptorSetDesc) {
+    Get(commandBuffer).stats.descriptorSetBindNum++;
+
+    Core().CmdSetDescriptorSet(commandBuffer, setDescriptorSetDesc);
+}
+
+static void NRI_CALL CmdSetRootConstants(CommandBuffer& commandBuffer, const SetRootConstantsDesc& setRootConstantsDesc) {
+    Get(commandBuffer).stats.rootBindNum++;
+
+    Core().CmdSetRootConstants(commandBuffer, setRootConstantsDesc);
+}
+
+static void NRI_CALL CmdSetRootDescriptor(CommandBuffer& commandBuffer, const SetRootDescriptorDesc& setRootDescriptorDesc) {
+    Get(commandBuffer).stats.rootBindNum++;
+
+    Core().CmdSetRootDescriptor(commandBuffer, setRootDescriptorDesc);
+}
+
+static void NRI_CALL CmdSetPipeline(CommandBuffer& commandBuffer, const Pipeline& pipeline) {
+    CommandBufferStats& commandBufferStats = Get(commandBuffer);
+    commandBufferStats.stats.pipelineBindNum++;
+
+    if (commandBufferStats.pipeline != &pipeline) {
+        commandBufferStats.stats.pipelineSwitchNum++;
+        commandBufferStats.pipeline = &pipeline;
+    }
+
+    Core().CmdSetPipeline(commandBuffer, pipeline);
+}
+
+static void NRI_CALL CmdBarrier(CommandBuffer& commandBuffer, const BarrierDesc& barrierDesc) {
+    CommandStats& stats = Get(commandBuffer).stats;
+    stats.barrierNum++;
+    stats.globalBarrierNum += barrierDesc.globalNum;
+    stats.bufferBarrierNum += barrierDesc.bufferNum;
+    stats.textureBarrierNum += barrierDesc.textureNum;
+
+    Core().CmdBarrier(commandBuffer, barrierDesc);
+}
+
+static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const RenderingDesc& renderingDesc) {
+    Get(commandBuffer).stats.renderingNum++;
+
+    Core().CmdBeginRendering(commandBuffer, renderingDesc);
+}
+
+static void NRI_CALL CmdClearAttachments(CommandBuffer& commandBuffer, const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum) {
+    Get(commandBuffer).stats.clearNum++;
+
+    Core().CmdClearAttachments(commandBuffer, clearAttachmentDescs, clearAttachmentDescNum, rects, rectNum);
+}
+
+static void NRI_CALL CmdDraw(CommandBuffer& commandBuffer, const DrawDesc& drawDesc) {
+    Get(commandBuffer).stats.drawNum++;
+
+    Core().CmdDraw(commandBuffer, drawDesc);
+}
+
+static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawIndexedDesc& drawIndexedDesc) {
+    Get(commandBuffer).stats.drawNum++;
+
+    Core().CmdDrawIndexed(commandBuffer, drawIndexedDesc);
+}
+
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawDescNum) {
+    Get(commandBuffer).stats.drawNum += drawDescNum;
+
+    Core().CmdDrawMulti(commandBuffer, drawDescs, drawDescNum);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawIndexedDescNum) {
+    Get(commandBuffer).stats.drawNum += drawIndexedDescNum;
+
+    Core().CmdDrawIndexedMulti(commandBuffer, drawIndexedDescs, drawIndexedDescNum);
+}
+
+static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    Get(commandBuffer).stats.drawIndirectNum++;
+
+    Core().CmdDrawIndirect(commandBuffer, buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+}
+
+static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    Get(commandBuffer).stats.drawIndirectNum++;
+
+    Core().CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+}
+
+static void NRI_CALL CmdExecuteBundle(CommandBuffer& commandBuffer, const CommandBuffer& commandBundle) {
+    CommandBufferStats& commandBufferStats = Get(commandBuffer);
+    Accumulate(commandBufferStats.stats, Get(commandBundle).stats);
+    commandBufferStats.pipeline = nullptr; // bound state is undefined after execution
+
+    Core().CmdExecuteBundle(commandBuffer, commandBundle);
+}
+
+static void NRI_CALL CmdDispatch(CommandBuffer& commandBuffer, const DispatchDesc& dispatchDesc) {
+    Get(commandBuffer).stats.dispatchNum++;
+
+    Core().CmdDispatch(commandBuffer, dispatchDesc);
+}
+
+static void NRI_CALL CmdDispatchIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset) {
+    Get(commandBuffer).stats.dispatchIndirectNum++;
+
+    Core().CmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+
+static void NRI_CALL CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    CommandStats& stats = Get(commandBuffer).stats;
+    stats.copyNum++;
+    stats.copyBytes += g_DeviceStatistics->GetBufferRangeSize(srcBuffer, srcOffset, size);
+
+    Core().CmdCopyBuffer(commandBuffer, dstBuffer, dstOffset, srcBuffer, srcOffset, size);
+}
+
+static void NRI_CALL CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    CommandStats& stats = Get(commandBuffer).stats;
+    stats.copyNum++;
+    stats.copyBytes += srcRegion || !dstRegion ? g_DeviceStatistics->GetTextureRegionSize(srcTexture, srcRegion) : g_DeviceStatistics->GetTextureRegionSize(dstTexture, dstRegion);
+
+    Core().CmdCopyTexture(commandBuffer, dstTexture, dstRegion, srcTexture, srcRegion);
+}
+
+static void NRI_CALL CmdUploadBufferToTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    CommandStats& stats = Get(commandBuffer).stats;
+    stats.copyNum++;
+    stats.copyBytes += g_DeviceStatistics->GetTextureRegionSize(dstTexture, &dstRegion);
+
+    Core().CmdUploadBufferToTexture(commandBuffer, dstTexture, dstRegion, srcBuffer, srcDataLayout);
+}
+
+static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    CommandStats& stats = Get(commandBuffer).stats;
+    stats.copyNum++;
+    stats.copyBytes += g_DeviceStatistics->GetTextureRegionSize(srcTexture, &srcRegion);
+
+    Core().CmdReadbackTextureToBuffer(commandBuffer, dstBuffer, dstDataLayout, srcTexture, srcRegion);
+}
+
+static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
+    CommandStats& stats = Get(commandBuffer).stats;
+    stats.copyNum++;
+    stats.copyBytes += g_DeviceStatistics->GetBufferRangeSize(buffer, offset, size);
+
+    Core().CmdZeroBuffer(commandBuffer, buffer, offset, size);
+}
+
+static void NRI_CALL CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion, ResolveOp resolveOp) {
+    Get(commandBuffer).stats.copyNum++;
+
+    Core().CmdResolveTexture(commandBuffer, dstTexture, dstRegion, srcTexture, srcRegion, resolveOp);
+}
+
+static void NRI_CALL CmdClearStorage(CommandBuffer& commandBuffer, const ClearStorageDesc& clearStorageDesc) {
+    Get(commandBuffer).stats.clearNum++;
+
+    Core().CmdClearStorage(commandBuffer, clearStorageDesc);
+}
+
+static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSubmitDesc) {
+    Result result = Core().QueueSubmit(queue, queueSubmitDesc);
+    if (result == Result::SUCCESS)
+        g_DeviceStatistics->OnQueueSubmit(queue, queueSubmitDesc);
+
+    return result;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  MeshShader  ]
+
+static void NRI_CALL CmdDrawMeshTasks(CommandBuffer& commandBuffer, const DrawMeshTasksDesc& drawMeshTasksDesc) {
+    Get(commandBuffer).stats.drawNum++;
+
+    g_DeviceStatistics->GetMeshShaderImpl().CmdDrawMeshTasks(commandBuffer, drawMeshTasksDesc);
+}
+
+static void NRI_CALL CmdDrawMeshTasksIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    Get(commandBuffer).stats.drawIndirectNum++;
+
+    g_DeviceStatistics->GetMeshShaderImpl().CmdDrawMeshTasksIndirect(commandBuffer, buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  RayTracing  ]
+
+static void NRI_CALL CmdDispatchRays(CommandBuffer& commandBuffer, const DispatchRaysDesc& dispatchRaysDesc) {
+    Get(commandBuffer).stats.dispatchNum++;
+
+    g_DeviceStatistics->GetRayTracingImpl().CmdDispatchRays(commandBuffer, dispatchRaysDesc);
+}
+
+static void NRI_CALL CmdDispatchRaysIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset) {
+    Get(commandBuffer).stats.dispatchIndirectNum++;
+
+    g_DeviceStatistics->GetRayTracingImpl().CmdDispatchRaysIndirect(commandBuffer, buffer, offset);
+}
+
+static Result NRI_CALL CreateRayTracingPipeline(Device& device, const RayTracingPipelineDesc& rayTracingPipelineDesc, Pipeline*& pipeline) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = RayTracing().CreateRayTracingPipeline(device, rayTracingPipelineDesc, pipeline);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::PIPELINE, pipeline, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateAccelerationStructureDescriptor(const AccelerationStructure& accelerationStructure, Descriptor*& descriptor) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = RayTracing().CreateAccelerationStructureDescriptor(accelerationStructure, descriptor);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::DESCRIPTOR, descriptor, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateAccelerationStructure(Device& device, const AccelerationStructureDesc& accelerationStructureDesc, AccelerationStructure*& accelerationStructure) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = RayTracing().CreateAccelerationStructure(device, accelerationStructureDesc, accelerationStructure);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::ACCELERATION_STRUCTURE, accelerationStructure, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateMicromap(Device& device, const MicromapDesc& micromapDesc, Micromap*& micromap) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = RayTracing().CreateMicromap(device, micromapDesc, micromap);
+    if (result == Result::SUCCESS)
+        OnCreateObject(ObjectType::MICROMAP, micromap, hostBytes, 0);
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommittedAccelerationStructure(Device& device, MemoryLocation memoryLocation, float priority, const AccelerationStructureDesc& accelerationStructureDesc, AccelerationStructure*& accelerationStructure) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = RayTracing().CreateCommittedAccelerationStructure(device, memoryLocation, priority, accelerationStructureDesc, accelerationStructure);
+    if (result == Result::SUCCESS) {
+        MemoryDesc memoryDesc = {};
+        RayTracing().GetAccelerationStructureMemoryDesc(*accelerationStructure, memoryLocation, memoryDesc);
+
+        OnCreateObject(ObjectType::ACCELERATION_STRUCTURE, accelerationStructure, hostBytes, memoryDesc.size);
+    }
+
+    return result;
+}
+
+static Result NRI_CALL CreateCommittedMicromap(Device& device, MemoryLocation memoryLocation, float priority, const MicromapDesc& micromapDesc, Micromap*& micromap) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = RayTracing().CreateCommittedMicromap(device, memoryLocation, priority, micromapDesc, micromap);
+    if (result == Result::SUCCESS) {
+        MemoryDesc memoryDesc = {};
+        RayTracing().GetMicromapMemoryDesc(*micromap, memoryLocation, memoryDesc);
+
+        OnCreateObject(ObjectType::MICROMAP, micromap, hostBytes, memoryDesc.size);
+    }
+
+    return result;
+}
+
+static Result NRI_CALL CreatePlacedAccelerationStructure(Device& device, Memory* memory, uint64_t offset, const AccelerationStructureDesc& accelerationStructureDesc, AccelerationStructure*& accelerationStructure) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = RayTracing().CreatePlacedAccelerationStructure(device, memory, offset, accelerationStructureDesc, accelerationStructure);
+    if (result == Result::SUCCESS) {
+        MemoryDesc memoryDesc = {};
+        if (IsHeapPlacement(memory))
+            RayTracing().GetAccelerationStructureMemoryDesc(*accelerationStructure, (MemoryLocation)offset, memoryDesc);
+
+        OnCreateObject(ObjectType::ACCELERATION_STRUCTURE, accelerationStructure, hostBytes, memoryDesc.size);
+    }
+
+    return result;
+}
+
+static Result NRI_CALL CreatePlacedMicromap(Device& device, Memory* memory, uint64_t offset, const MicromapDesc& micromapDesc, Micromap*& micromap) {
+    int64_t hostBytes = t_HostBytes;
+
+    Result result = RayTracing().CreatePlacedMicromap(device, memory, offset, micromapDesc, micromap);
+    if (result == Result::SUCCESS) {
+        MemoryDesc memoryDesc = {};
+        if (IsHeapPlacement(memory))
+            RayTracing().GetMicromapMemoryDesc(*micromap, (MemoryLocation)offset, memoryDesc);
+
+        OnCreateObject(ObjectType::MICROMAP, micromap, hostBytes, memoryDesc.size);
+    }
+
+    return result;
+}
+
+static void NRI_CALL DestroyAccelerationStructure(AccelerationStructure* accelerationStructure) {
+    g_DeviceStatistics->OnDestroyObject(accelerationStructure);
+
+    RayTracing().DestroyAccelerationStructure(accelerationStructure);
+}
+
+static void NRI_CALL DestroyMicromap(Micromap* micromap) {
+    g_DeviceStatistics->OnDestroyObject(micromap);
+
+    RayTracing().DestroyMicromap(micromap);
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Statistics  ]
+
+static void NRI_CALL GetCommandBufferStats(const CommandBuffer& commandBuffer, CommandStats& commandStats) {
+    commandStats = Get(commandBuffer).stats;
+}
+
+static void NRI_CALL GetQueueSubmitStats(const Queue& queue, CommandStats& commandStats) {
+    g_DeviceStatistics->GetQueueSubmitStats(queue, commandStats);
+}
+
+static void NRI_CALL EndStatisticsFrame(Device&, CommandStats& frameStats) {
+    g_DeviceStatistics->EndFrame(frameStats);
+}
+
+static void NRI_CALL GetHostMemoryStats(const Device&, HostMemoryStats& hostMemoryStats) {
+    g_DeviceStatistics->GetHostMemoryStats(hostMemoryStats);
+}
+
+static void NRI_CALL GetObjectCensus(const Device&, ObjectCensus& objectCensus) {
+    g_DeviceStatistics->GetObjectCensus(objectCensus);
+}
+
+static void NRI_CALL GetLiveObjects(const Device&, LiveObjectDesc* liveObjectDescs, uint32_t& liveObjectDescNum) {
+    g_DeviceStatistics->GetLiveObjects(liveObjectDescs, liveObjectDescNum);
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  HostAllocationTracker  ]
+
+static inline AllocationTag GetTag(const HostAllocationView& view) {
+    if (t_AllocationTag != AllocationTag::MAX_NUM)
+        return t_AllocationTag;
+
+    return view.tag == AllocationTag::MAX_NUM ? AllocationTag::DEVICE : view.tag;
+}
+
+static void* NRI_CALL TrackedAllocate(void* userArg, size_t size, size_t alignment) {
+    const HostAllocationView& view = *(HostAllocationView*)userArg;
+    OnFrameArenaHostAllocation(size);
+
+    return view.tracker->Allocate(size, alignment, GetTag(view));
+}
+
+static void* NRI_CALL TrackedReallocate(void* userArg, void* memory, size_t size, size_t alignment) {
+    const HostAllocationView& view = *(HostAllocationView*)userArg;
+    OnFrameArenaHostAllocation(size);
+
+    return view.tracker->Reallocate(memory, size, alignment, GetTag(view));
+}
+
+static void NRI_CALL TrackedFree(void* userArg, void* memory) {
+    const HostAllocationView& view = *(HostAllocationView*)userArg;
+
+    view.tracker->Free(memory);
+}
+
+static HostAllocationTracker* GetHostAllocationTracker(const AllocationCallbacks& allocationCallbacks) {
+    if (allocationCallbacks.Allocate != TrackedAllocate)
+        return nullptr;
+
+    return ((HostAllocationView*)allocationCallbacks.userArg)->tracker;
+}
+
+static void Fill(AllocationStats& dst, const HostAllocationCounters& src) {
+    dst.liveBytes = src.liveBytes.load(std::memory_order_relaxed);
+    dst.peakBytes = src.peakBytes.load(std::memory_order_relaxed);
+    dst.allocationNum = src.allocationNum.load(std::memory_order_relaxed);
+    dst.liveAllocationNum = src.liveAllocationNum.load(std::memory_order_relaxed);
+    dst.frameAllocationNum = src.lastFrameAllocationNum.load(std::memory_order_relaxed);
+}
+
+static void OnAllocate(HostAllocationCounters& counters, uint64_t size) {
+    uint64_t liveBytes = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64_t peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    while (liveBytes > peakBytes && !counters.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+        ;
+
+    counters.allocationNum.fetch_add(1, std::memory_order_relaxed);
+    counters.liveAllocationNum.fetch_add(1, std::memory_order_relaxed);
+    counters.frameAllocationNum.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void OnFree(HostAllocationCounters& counters, uint64_t size) {
+    counters.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    counters.liveAllocationNum.fetch_sub(1, std::memory_order_relaxed);
+}
+
+HostAllocationTracker::HostAllocationTracker(const AllocationCallbacks& allocationCallbacks)
+    : m_AllocationCallbacks(allocationCallbacks) {
+    for (size_t i = 0; i < m_Views.size(); i++)
+        m_Views[i] = {this, (AllocationTag)i};
+}
+
+void* HostAllocationTracker::Allocate(size_t size, size_t alignment, AllocationTag tag) {
+    // The header goes right before the returned memory, the offset keeps the requested alignment
+    size_t offset = std::max(alignment, HOST_ALLOCATION_HEADER_SIZE);
+
+    uint8_t* memory = (uint8_t*)m_AllocationCallbacks.Allocate(m_AllocationCallbacks.userArg, size + offset, offset);
+    if (!memory)
+        return nullptr;
+
+    memory += offset;
+
+    HostAllocationHeader* header = (HostAllocationHeader*)(memory - HOST_ALLOCATION_HEADER_SIZE);
+    header->size = size;
+    header->offset = (uint32_t)offset;
+    header->tag = tag;
+
+    OnAllocate(m_Counters[(size_t)tag], size);
+    OnAllocate(m_Counters.back(), size);
+    t_HostBytes += size;
+
+    return memory;
+}
+
+void* HostAllocationTracker::Reallocate(void* memory, size_t size, size_t alignment, AllocationTag tag) {
+    if (!memory)
+        return Allocate(size, alignment, tag);
+
+    // The original tag is preserved
+    const HostAllocationHeader* header = (HostAllocationHeader*)((uint8_t*)memory - HOST_ALLOCATION_HEADER_SIZE);
+
+    void* newMemory = Allocate(size, alignment, header->tag);
+    if (newMemory) {
+        memcpy(newMemory, memory, std::min((size_t)header->size, size));
+        Free(memory);
+    }
+
+    return newMemory;
+}
+
+void HostAllocationTracker::Free(void* memory) {
+    if (!memory)
+        return;
+
+    const HostAllocationHeader* header = (HostAllocationHeader*)((uint8_t*)memory - HOST_ALLOCATION_HEADER_SIZE);
+
+    OnFree(m_Counters[(size_t)header->tag], header->size);
+    OnFree(m_Counters.back(), header->size);
+    t_HostBytes -= header->size;
+
+    m_AllocationCallbacks.Free(m_AllocationCallbacks.userArg, (uint8_t*)memory - header->offset);
+}
+
+void HostAllocationTracker::GetStats(HostMemoryStats& hostMemoryStats) const {
+    for (size_t i = 0; i < (size_t)AllocationTag::MAX_NUM; i++)
+        Fill(hostMemoryStats.tags[i], m_Counters[i]);
+
+    Fill(hostMemoryStats.total, m_Counters.back());
+}
+
+void HostAllocationTracker::EndFrame() {
+    for (HostAllocationCounters& counters : m_Counters)
+        counters.lastFrameAllocationNum.store(counters.frameAllocationNum.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DeviceStatistics  ]
+
+DeviceStatistics::DeviceStatistics(const DeviceCreationDesc& desc, DeviceBase& device)
+    : m_Device(device)
+    , m_CommandBuffers(device.GetStdAllocator())
+    , m_QueueSubmits(device.GetStdAllocator())
+    , m_LiveObjects(device.GetStdAllocator())
+    , m_HostAllocationTracker(GetHostAllocationTracker(device.GetAllocationCallbacks()))
+    , m_IsHostAllocationReportEnabled(desc.enableHostAllocationReport) {
+}
+
+DeviceStatistics::~DeviceStatistics() {
+    // Leak report
+    if (!m_LiveObjects.empty()) {
+        NRI_REPORT_WARNING(&m_Device, "%u object(s) are still alive (host %" PRIu64 " bytes, device %" PRIu64 " bytes)", m_ObjectCensus.total.liveNum, m_ObjectCensus.total.hostBytes, m_ObjectCensus.total.deviceBytes);
+
+        for (const auto& entry : m_LiveObjects) {
+            const LiveObject& liveObject = entry.second;
+            NRI_REPORT_WARNING(&m_Device, "  %s %p '%s' (host %" PRIu64 " bytes, device %" PRIu64 " bytes)", g_ObjectTypeNames[(size_t)liveObject.type], entry.first, liveObject.name.c_str(), liveObject.hostBytes, liveObject.deviceBytes);
+        }
+    }
+
+    for (auto& entry : m_CommandBuffers)
+        Destroy(m_Device.GetAllocationCallbacks(), entry.second);
+
+    if (g_DeviceStatistics == this)
+        g_DeviceStatistics = nullptr;
+
+    g_Epoch.fetch_add(1, std::memory_order_release);
+}
+
+bool DeviceStatistics::Create() {
+    NRI_RETURN_ON_FAILURE(&m_Device, !g_DeviceStatistics, false, "Statistics can be enabled only for one device at a time");
+
+    if (m_Device.FillFunctionTable(m_CoreImpl) != Result::SUCCESS)
+        return false;
+
+    // Optional
+    m_Device.FillFunctionTable(m_MeshShaderImpl);
+    m_Device.FillFunctionTable(m_RayTracingImpl);
+
+    g_DeviceStatistics = this;
+
+    return true;
+}
+
+CommandBufferStats& DeviceStatistics::GetCommandBufferStats(const CommandBuffer& commandBuffer) {
+    uint64_t epoch = g_Epoch.load(std::memory_order_acquire);
+    if (t_Cache.commandBuffer == &commandBuffer && t_Cache.epoch == epoch)
+        return *t_Cache.commandBufferStats;
+
+    // Lazily registered, to handle command buffers created via wrappers too
+    ExclusiveScope lock(m_Lock);
+
+    auto it = m_CommandBuffers.find(&commandBuffer);
+    if (it == m_CommandBuffers.end()) {
+        CommandBufferStats* commandBufferStats = Allocate<CommandBufferStats>(m_Device.GetAllocationCallbacks());
+        *commandBufferStats = {};
+
+        it = m_CommandBuffers.insert({&commandBuffer, commandBufferStats}).first;
+    }
+
+    t_Cache = {&commandBuffer, it->second, epoch};
+
+    return *it->second;
+}
+
+void DeviceStatistics::OnDestroyCommandBuffer(const CommandBuffer& commandBuffer) {
+    ExclusiveScope lock(m_Lock);
+
+    auto it = m_CommandBuffers.find(&commandBuffer);
+    if (it != m_CommandBuffers.end()) {
+        Destroy(m_Device.GetAllocationCallbacks(), it->second);
+        m_CommandBuffers.erase(it);
+
+        g_Epoch.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void DeviceStatistics::OnQueueSubmit(const Queue& queue, const QueueSubmitDesc& queueSubmitDesc) {
+    CommandStats submitStats = {};
+    submitStats.commandBufferNum = queueSubmitDesc.commandBufferNum;
+    submitStats.submitNum = 1;
+
+    ExclusiveScope lock(m_Lock);
+
+    for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+        auto it = m_CommandBuffers.find(queueSubmitDesc.commandBuffers[i]);
+        if (it != m_CommandBuffers.end())
+            Accumulate(submitStats, it->second->stats);
+    }
+
+    m_QueueSubmits[&queue] = submitStats;
+    Accumulate(m_FrameStats, submitStats);
+}
+
+void DeviceStatistics::GetQueueSubmitStats(const Queue& queue, CommandStats& commandStats) {
+    ExclusiveScope lock(m_Lock);
+
+    auto it = m_QueueSubmits.find(&queue);
+    commandStats = it == m_QueueSubmits.end() ? CommandStats{} : it->second;
+}
+
+void DeviceStatistics::EndFrame(CommandStats& frameStats) {
+    ExclusiveScope lock(m_Lock);
+
+    frameStats = m_FrameStats;
+    m_FrameStats = {};
+
+    if (!m_HostAllocationTracker)
+        return;
+
+    m_HostAllocationTracker->EndFrame();
+
+    // Steady state frames are expected to be allocation-free
+    if (m_IsHostAllocationReportEnabled) {
+        HostMemoryStats hostMemoryStats = {};
+        m_HostAllocationTracker->GetStats(hostMemoryStats);
+
+        if (hostMemoryStats.total.frameAllocationNum) {
+            char buf[MAX_MESSAGE_LENGTH];
+            int32_t length = snprintf(buf, sizeof(buf), "%u host allocation(s) in the frame:", hostMemoryStats.total.frameAllocationNum);
+
+            for (size_t i = 0; i < (size_t)AllocationTag::MAX_NUM && length > 0 && length < (int32_t)sizeof(buf); i++) {
+                if (hostMemoryStats.tags[i].frameAllocationNum)
+                    length += snprintf(buf + length, sizeof(buf) - length, " %s=%u", g_AllocationTagNames[i], hostMemoryStats.tags[i].frameAllocationNum);
+            }
+
+            NRI_REPORT_WARNING(&m_Device, "%s", buf);
+        }
+    }
+}
+
+void DeviceStatistics::OnCreateObject(ObjectType type, const void* object, uint64_t hostBytes, uint64_t deviceBytes) {
+    ExclusiveScope lock(m_Lock);
+
+    LiveObject liveObject = {String(m_Device.GetStdAllocator()), hostBytes, deviceBytes, type};
+    m_LiveObjects.insert({object, std::move(liveObject)});
+
+    for (ObjectTypeStats* objectTypeStats : {&m_ObjectCensus.types[(size_t)type], &m_ObjectCensus.total}) {
+        objectTypeStats->hostBytes += hostBytes;
+        objectTypeStats->deviceBytes += deviceBytes;
+        objectTypeStats->liveNum++;
+    }
+}
+
+void DeviceStatistics::OnDestroyObject(const void* object) {
+    if (!object)
+        return;
+
+    ExclusiveScope lock(m_Lock);
+
+    auto it = m_LiveObjects.find(object);
+    if (it == m_LiveObjects.end())
+        return;
+
+    const LiveObject& liveObject = it->second;
+    for (ObjectTypeStats* objectTypeStats : {&m_ObjectCensus.types[(size_t)liveObject.type], &m_ObjectCensus.total}) {
+        objectTypeStats->hostBytes -= liveObject.hostBytes;
+        objectTypeStats->deviceBytes -= liveObject.deviceBytes;
+        objectTypeStats->liveNum--;
+    }
+
+    m_LiveObjects.erase(it);
+}
+
+void DeviceStatistics::OnSetDebugName(const void* object, const char* name) {
+    ExclusiveScope lock(m_Lock);
+
+    auto it = m_LiveObjects.find(object);
+    if (it != m_LiveObjects.end())
+        it->second.name = name ? name : "";
+}
+
+void DeviceStatistics::GetObjectCensus(ObjectCensus& objectCensus) {
+    ExclusiveScope lock(m_Lock);
+
+    objectCensus = m_ObjectCensus;
+}
+
+void DeviceStatistics::GetLiveObjects(LiveObjectDesc* liveObjectDescs, uint32_t& liveObjectDescNum) {
+    ExclusiveScope lock(m_Lock);
+
+    if (!liveObjectDescs) {
+        liveObjectDescNum = (uint32_t)m_LiveObjects.size();
+        return;
+    }
+
+    uint32_t i = 0;
+    for (auto it = m_LiveObjects.begin(); it != m_LiveObjects.end() && i < liveObjectDescNum; it++, i++) {
+        const LiveObject& liveObject = it->second;
+
+        LiveObjectDesc& liveObjectDesc = liveObjectDescs[i];
+        liveObjectDesc.object = it->first;
+        liveObjectDesc.name = liveObject.name.empty() ? nullptr : liveObject.name.c_str();
+        liveObjectDesc.hostBytes = liveObject.hostBytes;
+        liveObjectDesc.deviceBytes = liveObject.deviceBytes;
+        liveObjectDesc.type = liveObject.type;
+    }
+
+    liveObjectDescNum = i;
+}
+
+void DeviceStatistics::GetHostMemoryStats(HostMemoryStats& hostMemoryStats) const {
+    hostMemoryStats = {};
+
+    if (m_HostAllocationTracker)
+        m_HostAllocationTracker->GetStats(hostMemoryStats);
+}
+
+uint64_t DeviceStatistics::GetTextureRegionSize(const Texture& texture, const TextureRegionDesc* region) const {
+    const TextureDesc& textureDesc = m_CoreImpl.GetTextureDesc(texture);
+    const FormatProps& formatProps = GetFormatProps(textureDesc.format);
+    GraphicsAPI graphicsAPI = m_Device.GetDesc().graphicsAPI;
+
+    Dim_t mipBegin = region ? region->mipOffset : 0;
+    Dim_t mipEnd = region ? mipBegin + 1 : textureDesc.mipNum;
+
+    uint64_t size = 0;
+    for (Dim_t mip = mipBegin; mip < mipEnd; mip++) {
+        Dim_t w = GetDimension(graphicsAPI, textureDesc, 0, mip);
+        Dim_t h = GetDimension(graphicsAPI, textureDesc, 1, mip);
+        Dim_t d = GetDimension(graphicsAPI, textureDesc, 2, mip);
+
+        if (region) {
+            w = region->width == WHOLE_SIZE ? w - region->x : region->width;
+            h = region->height == WHOLE_SIZE ? h - region->y : region->height;
+            d = region->depth == WHOLE_SIZE ? d - region->z : region->depth;
+        }
+
+        uint64_t rowSize = ((w + formatProps.blockWidth - 1) / formatProps.blockWidth) * formatProps.stride;
+        uint64_t rowNum = (h + formatProps.blockHeight - 1) / formatProps.blockHeight;
+
+        size += rowSize * rowNum * d;
+    }
+
+    // A region addresses a single layer
+    return region ? size : size * textureDesc.layerNum;
+}
+
+uint64_t DeviceStatistics::GetBufferRangeSize(const Buffer& buffer, uint64_t offset, uint64_t size) const {
+    if (size == WHOLE_SIZE)
+        size = m_CoreImpl.GetBufferDesc(buffer).size - offset;
+
+    return size;
+}
+
+#pragma endregion
+
+bool CreateHostAllocationTracker(AllocationCallbacks& allocationCallbacks) {
+    HostAllocationTracker* tracker = Allocate<HostAllocationTracker>(allocationCallbacks, allocationCallbacks);
+    if (!tracker)
+        return false;
+
+    allocationCallbacks.Allocate = TrackedAllocate;
+    allocationCallbacks.Reallocate = TrackedReallocate;
+    allocationCallbacks.Free = TrackedFree;
+    allocationCallbacks.userArg = tracker->GetView(AllocationTag::MAX_NUM);
+
+    return true;
+}
+
+void SetHostAllocationTag(AllocationCallbacks& allocationCallbacks, AllocationTag tag) {
+    HostAllocationTracker* tracker = GetHostAllocationTracker(allocationCallbacks);
+    if (tracker)
+        allocationCallbacks.userArg = tracker->GetView(tag);
+}
+
+void DestroyHostAllocationTracker(const AllocationCallbacks& allocationCallbacks) {
+    HostAllocationTracker* tracker = GetHostAllocationTracker(allocationCallbacks);
+    if (tracker) {
+        AllocationCallbacks originalAllocationCallbacks = tracker->GetAllocationCallbacks();
+        Destroy(originalAllocationCallbacks, tracker);
+    }
+}
+
+bool CreateDeviceStatistics(const DeviceCreationDesc& desc, DeviceBase& device) {
+    DeviceStatistics* deviceStatistics = Allocate<DeviceStatistics>(device.GetAllocationCallbacks(), desc, device);
+    if (!deviceStatistics->Create()) {
+        Destroy(device.GetAllocationCallbacks(), deviceStatistics);
+        return false;
+    }
+
+    return true;
+}
+
+void DestroyDeviceStatistics(const DeviceBase& device) {
+    if (g_DeviceStatistics && &g_DeviceStatistics->GetDevice() == &device)
+        Destroy(device.GetAllocationCallbacks(), g_DeviceStatistics);
+}
+
+void InstrumentFunctionTable(const DeviceBase& device, CoreInterface& table) {
+    if (!g_DeviceStatistics || &g_DeviceStatistics->GetDevice() != &device)
+        return;
+
+    table.SetDebugName = ::SetDebugName;
+    table.CreateCommandAllocator = ::CreateCommandAllocator;
+    table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateCommandBundle = ::CreateCommandBundle;
+    table.CreateReusableCommandBuffer = ::CreateReusableCommandBuffer;
+    table.CreateCommandBuffers = ::CreateCommandBuffers;
+    table.CreateFence = ::CreateFence;
+    table.CreateDescriptorPool = ::CreateDescriptorPool;
+    table.CreatePipelineLayout = ::CreatePipelineLayout;
+    table.CreateGraphicsPipeline = ::CreateGraphicsPipeline;
+    table.CreateComputePipeline = ::CreateComputePipeline;
+    table.CreateQueryPool = ::CreateQueryPool;
+    table.CreateSampler = ::CreateSampler;
+    table.CreateBufferView = ::CreateBufferView;
+    table.CreateTextureView = ::CreateTextureView;
+    table.AllocateMemory = ::AllocateMemory;
+    table.CreateBuffer = ::CreateBuffer;
+    table.CreateTexture = ::CreateTexture;
+    table.CreateCommittedBuffer = ::CreateCommittedBuffer;
+    table.CreateCommittedTexture = ::CreateCommittedTexture;
+    table.CreatePlacedBuffer = ::CreatePlacedBuffer;
+    table.CreatePlacedTexture = ::CreatePlacedTexture;
+    table.DestroyCommandAllocator = ::DestroyCommandAllocator;
+    table.DestroyCommandBuffer = ::DestroyCommandBuffer;
+    table.DestroyDescriptorPool = ::DestroyDescriptorPool;
+    table.DestroyBuffer = ::DestroyBuffer;
+    table.DestroyTexture = ::DestroyTexture;
+    table.DestroyDescriptor = ::DestroyDescriptor;
+    table.DestroyPipelineLayout = ::DestroyPipelineLayout;
+    table.DestroyPipeline = ::DestroyPipeline;
+    table.DestroyQueryPool = ::DestroyQueryPool;
+    table.DestroyFence = ::DestroyFence;
+    table.FreeMemory = ::FreeMemory;
+    table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.EndCommandBuffer = ::EndCommandBuffer;
+    table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
+    table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
+    table.CmdSetRootConstants = ::CmdSetRootConstants;
+    table.CmdSetRootDescriptor = ::CmdSetRootDescriptor;
+    table.CmdSetPipeline = ::CmdSetPipeline;
+    table.CmdBarrier = ::CmdBarrier;
+    table.CmdBeginRendering = ::CmdBeginRendering;
+    table.CmdClearAttachments = ::CmdClearAttachments;
+    table.CmdDraw = ::CmdDraw;
+    table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
+    table.CmdDrawIndirect = ::CmdDrawIndirect;
+    table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
+    table.CmdExecuteBundle = ::CmdExecuteBundle;
+    table.CmdDispatch = ::CmdDispatch;
+    table.CmdDispatchIndirect = ::CmdDispatchIndirect;
+    table.CmdCopyBuffer = ::CmdCopyBuffer;
+    table.CmdCopyTexture = ::CmdCopyTexture;
+    table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
+    table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
+    table.CmdZeroBuffer = ::CmdZeroBuffer;
+    table.CmdResolveTexture = ::CmdResolveTexture;
+    table.CmdClearStorage = ::CmdClearStorage;
+    table.QueueSubmit = ::QueueSubmit;
+}
+
+void InstrumentFunctionTable(const DeviceBase& device, MeshShaderInterface& table) {
+    if (!g_DeviceStatistics || &g_DeviceStatistics->GetDevice() != &device)
+        return;
+
+    table.CmdDrawMeshTasks = ::CmdDrawMeshTasks;
+    table.CmdDrawMeshTasksIndirect = ::CmdDrawMeshTasksIndirect;
+}
+
+void InstrumentFunctionTable(const DeviceBase& device, RayTracingInterface& table) {
+    if (!g_DeviceStatistics || &g_DeviceStatistics->GetDevice() != &device)
+        return;
+
+    table.CreateRayTracingPipeline = ::CreateRayTracingPipeline;
+    table.CreateAccelerationStructureDescriptor = ::CreateAccelerationStructureDescriptor;
+    table.CreateAccelerationStructure = ::CreateAccelerationStructure;
+    table.CreateMicromap = ::CreateMicromap;
+    table.CreateCommittedAccelerationStructure = ::CreateCommittedAccelerationStructure;
+    table.CreateCommittedMicromap = ::CreateCommittedMicromap;
+    table.CreatePlacedAccelerationStructure = ::CreatePlacedAccelerationStructure;
+    table.CreatePlacedMicromap = ::CreatePlacedMicromap;
+    table.DestroyAccelerationStructure = ::DestroyAccelerationStructure;
+    table.DestroyMicromap = ::DestroyMicromap;
+    table.CmdDispatchRays = ::CmdDispatchRays;
+    table.CmdDispatchRaysIndirect = ::CmdDispatchRaysIndirect;
+}
+
+Result FillFunctionTable(const DeviceBase& device, StatisticsInterface& table) {
+    if (!g_DeviceStatistics || &g_DeviceStatistics->GetDevice() != &device)
+        return Result::UNSUPPORTED;
+
+    table.GetCommandBufferStats = ::GetCommandBufferStats;
+    table.GetQueueSubmitStats = ::GetQueueSubmitStats;
+    table.EndStatisticsFrame = ::EndStatisticsFrame;
+    table.GetHostMemoryStats = ::GetHostMemoryStats;
+    table.GetObjectCensus = ::GetObjectCensus;
+    table.GetLiveObjects = ::GetLiveObjects;
+
+    return Result::SUCCESS;
+}
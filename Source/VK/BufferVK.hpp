@@ -12,10 +12,13 @@ BufferVK::~BufferVK() {
 }
 
 Result BufferVK::Create(const BufferDesc& bufferDesc) {
+    NRI_VALIDATE_ARGUMENT(&m_Device, bufferDesc.size != 0, Result::INVALID_ARGUMENT, "'size' is 0");
+
     m_Desc = bufferDesc;
 
     VkBufferCreateInfo info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    m_Device.FillCreateInfo(bufferDesc, info);
+    VkBufferUsageFlags2CreateInfoKHR usage2Info = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR};
+    m_Device.FillCreateInfo(bufferDesc, info, usage2Info);
 
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateBuffer(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
@@ -160,10 +163,13 @@ NRI_INLINE void BufferVK::SetDebugName(const char* name) {
 
 NRI_INLINE void* BufferVK::Map(uint64_t offset, uint64_t size) {
     NRI_CHECK(m_MappedMemory, "No CPU access");
+    NRI_VALIDATE_ARGUMENT(&m_Device, m_MappedMemory, nullptr, "the buffer is not in host-visible memory");
 
     if (size == WHOLE_SIZE)
         size = m_Desc.size;
 
+    NRI_VALIDATE_ARGUMENT(&m_Device, offset + size <= m_Desc.size, nullptr, "'offset + size' is out of bounds");
+
     m_MappedMemoryRangeSize = size;
     m_MappedMemoryRangeOffset = offset;
 
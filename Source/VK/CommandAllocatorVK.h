@@ -4,9 +4,20 @@
 
 namespace nri {
 
+struct CommandBufferVK;
+
+// A released command buffer, which wrapper is destroyed, but the memory and the handle are kept for reuse
+struct PooledCommandBufferVK {
+    CommandBufferVK* memory;
+    VkCommandBuffer handle;
+};
+
 struct CommandAllocatorVK final : public DebugNameBase {
     inline CommandAllocatorVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_Blocks(device.GetStdAllocator())
+        , m_FreeCommandBuffers(device.GetStdAllocator())
+        , m_ReleasedCommandBuffers(device.GetStdAllocator()) {
     }
 
     inline operator VkCommandPool() const {
@@ -17,10 +28,15 @@ struct CommandAllocatorVK final : public DebugNameBase {
         return m_Device;
     }
 
+    inline QueueType GetType() const {
+        return m_Type;
+    }
+
     ~CommandAllocatorVK();
 
     Result Create(const Queue& queue);
     Result Create(const CommandAllocatorVKDesc& commandAllocatorVKDesc);
+    void ReleaseCommandBuffer(CommandBufferVK& commandBuffer);
 
     //================================================================================================================
     // DebugNameBase
@@ -33,10 +49,16 @@ struct CommandAllocatorVK final : public DebugNameBase {
     //================================================================================================================
 
     Result CreateCommandBuffer(CommandBuffer*& commandBuffer);
+    Result CreateCommandBuffers(CommandBuffer** commandBuffers, uint32_t commandBufferNum);
+    Result CreateCommandBundle(const CommandBundleDesc& commandBundleDesc, CommandBuffer*& commandBundle);
+    Result CreateReusableCommandBuffer(const ReusableCommandBufferDesc& reusableCommandBufferDesc, CommandBuffer*& commandBuffer);
     void Reset();
 
 private:
     DeviceVK& m_Device;
+    Vector<CommandBufferVK*> m_Blocks; // wrappers of command buffers allocated at once
+    Vector<PooledCommandBufferVK> m_FreeCommandBuffers;
+    Vector<PooledCommandBufferVK> m_ReleasedCommandBuffers; // become free after "Reset"
     VkCommandPool m_Handle = VK_NULL_HANDLE;
     QueueType m_Type = (QueueType)0;
     bool m_OwnsNativeObjects = true;
@@ -1,10 +1,20 @@
 // © 2021 NVIDIA Corporation
 
 CommandAllocatorVK::~CommandAllocatorVK() {
-    if (m_OwnsNativeObjects) {
-        const auto& vk = m_Device.GetDispatchTable();
+    const auto& vk = m_Device.GetDispatchTable();
+    if (m_OwnsNativeObjects)
         vk.DestroyCommandPool(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+    else {
+        for (const PooledCommandBufferVK& pooled : m_FreeCommandBuffers)
+            vk.FreeCommandBuffers(m_Device, m_Handle, 1, &pooled.handle);
+
+        for (const PooledCommandBufferVK& pooled : m_ReleasedCommandBuffers)
+            vk.FreeCommandBuffers(m_Device, m_Handle, 1, &pooled.handle);
     }
+
+    const auto& allocationCallbacks = m_Device.GetAllocationCallbacks();
+    for (CommandBufferVK* block : m_Blocks)
+        allocationCallbacks.Free(allocationCallbacks.userArg, block);
 }
 
 Result CommandAllocatorVK::Create(const Queue& queue) {
@@ -29,14 +39,81 @@ Result CommandAllocatorVK::Create(const CommandAllocatorVKDesc& commandAllocator
     return Result::SUCCESS;
 }
 
+void CommandAllocatorVK::ReleaseCommandBuffer(CommandBufferVK& commandBuffer) {
+    VkCommandBuffer handle = commandBuffer;
+    commandBuffer.~CommandBufferVK();
+
+    ExclusiveScope lock(m_Lock);
+
+    // An owned pool has "RESET_COMMAND_BUFFER_BIT", i.e. "vkBeginCommandBuffer" implicitly resets a reused command buffer
+    if (m_OwnsNativeObjects)
+        m_FreeCommandBuffers.push_back({&commandBuffer, handle});
+    else
+        m_ReleasedCommandBuffers.push_back({&commandBuffer, handle});
+}
+
 NRI_INLINE void CommandAllocatorVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)m_Handle, name);
 }
 
 NRI_INLINE Result CommandAllocatorVK::CreateCommandBuffer(CommandBuffer*& commandBuffer) {
+    return CreateCommandBuffers(&commandBuffer, 1);
+}
+
+NRI_INLINE Result CommandAllocatorVK::CreateCommandBuffers(CommandBuffer** commandBuffers, uint32_t commandBufferNum) {
+    ExclusiveScope lock(m_Lock);
+
+    uint32_t reusedNum = std::min(commandBufferNum, (uint32_t)m_FreeCommandBuffers.size());
+    uint32_t newNum = commandBufferNum - reusedNum;
+
+    // Missing command buffers are allocated at once: one driver call for handles and one host allocation for wrappers
+    if (newNum) {
+        Scratch<VkCommandBuffer> handles = NRI_ALLOCATE_SCRATCH(m_Device, VkCommandBuffer, newNum);
+
+        const VkCommandBufferAllocateInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, m_Handle, VK_COMMAND_BUFFER_LEVEL_PRIMARY, newNum};
+
+        const auto& vk = m_Device.GetDispatchTable();
+        VkResult vkResult = vk.AllocateCommandBuffers(m_Device, &info, handles);
+        NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkAllocateCommandBuffers");
+
+        const auto& allocationCallbacks = m_Device.GetAllocationCallbacks();
+        CommandBufferVK* block = (CommandBufferVK*)allocationCallbacks.Allocate(allocationCallbacks.userArg, newNum * sizeof(CommandBufferVK), alignof(CommandBufferVK));
+        if (!block) {
+            vk.FreeCommandBuffers(m_Device, m_Handle, newNum, handles);
+            return Result::OUT_OF_MEMORY;
+        }
+
+        m_Blocks.push_back(block);
+
+        for (uint32_t i = 0; i < newNum; i++) {
+            CommandBufferVK* commandBufferVK = new (block + i) CommandBufferVK(m_Device);
+            commandBufferVK->Create(*this, handles[i]);
+
+            commandBuffers[reusedNum + i] = (CommandBuffer*)commandBufferVK;
+        }
+    }
+
+    // Released command buffers get a fresh wrapper
+    for (uint32_t i = 0; i < reusedNum; i++) {
+        const PooledCommandBufferVK& pooled = m_FreeCommandBuffers.back();
+
+        CommandBufferVK* commandBufferVK = new (pooled.memory) CommandBufferVK(m_Device);
+        commandBufferVK->Create(*this, pooled.handle);
+
+        commandBuffers[i] = (CommandBuffer*)commandBufferVK;
+
+        m_FreeCommandBuffers.pop_back();
+    }
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE Result CommandAllocatorVK::CreateCommandBundle(const CommandBundleDesc& commandBundleDesc, CommandBuffer*& commandBundle) {
+    NRI_VALIDATE_ARGUMENT(&m_Device, commandBundleDesc.colorFormatNum <= BUNDLE_COLOR_FORMAT_MAX_NUM, Result::INVALID_ARGUMENT, "'colorFormatNum' is out of bounds");
+
     ExclusiveScope lock(m_Lock);
 
-    const VkCommandBufferAllocateInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, m_Handle, VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
+    const VkCommandBufferAllocateInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, m_Handle, VK_COMMAND_BUFFER_LEVEL_SECONDARY, 1};
 
     VkCommandBuffer commandBufferHandle = VK_NULL_HANDLE;
 
@@ -46,16 +123,29 @@ NRI_INLINE Result CommandAllocatorVK::CreateCommandBuffer(CommandBuffer*& comman
 
     CommandBufferVK* commandBufferVK = Allocate<CommandBufferVK>(m_Device.GetAllocationCallbacks(), m_Device);
     commandBufferVK->Create(m_Handle, commandBufferHandle, m_Type);
+    commandBufferVK->SetBundleDesc(commandBundleDesc);
 
-    commandBuffer = (CommandBuffer*)commandBufferVK;
+    commandBundle = (CommandBuffer*)commandBufferVK;
 
     return Result::SUCCESS;
 }
 
+NRI_INLINE Result CommandAllocatorVK::CreateReusableCommandBuffer(const ReusableCommandBufferDesc& reusableCommandBufferDesc, CommandBuffer*& commandBuffer) {
+    Result result = CreateCommandBuffer(commandBuffer);
+    if (result == Result::SUCCESS)
+        ((CommandBufferVK*)commandBuffer)->SetReusable(reusableCommandBufferDesc.simultaneousUse);
+
+    return result;
+}
+
 NRI_INLINE void CommandAllocatorVK::Reset() {
     ExclusiveScope lock(m_Lock);
 
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.ResetCommandPool(m_Device, m_Handle, (VkCommandPoolResetFlags)0);
     NRI_RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkResetCommandPool");
+
+    // All command buffers are in the initial state now
+    m_FreeCommandBuffers.insert(m_FreeCommandBuffers.end(), m_ReleasedCommandBuffers.begin(), m_ReleasedCommandBuffers.end());
+    m_ReleasedCommandBuffers.clear();
 }
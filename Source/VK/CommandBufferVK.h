@@ -7,10 +7,52 @@ namespace nri {
 struct PipelineVK;
 struct PipelineLayoutVK;
 struct DescriptorVK;
+struct FenceVK;
+
+constexpr uint32_t STATE_FILTER_SET_MAX_NUM = 8;
+constexpr uint32_t STATE_FILTER_VERTEX_BUFFER_MAX_NUM = 16;
+constexpr uint32_t STATE_FILTER_VIEWPORT_MAX_NUM = 16;
+constexpr uint32_t BUNDLE_COLOR_FORMAT_MAX_NUM = 8;
+
+// Inherited rendering state of a bundle (secondary command buffer)
+struct BundleVK {
+    std::array<VkFormat, BUNDLE_COLOR_FORMAT_MAX_NUM> colorFormats;
+    VkFormat depthFormat;
+    VkFormat stencilFormat;
+    VkSampleCountFlagBits sampleNum;
+    uint32_t colorFormatNum;
+    uint32_t viewMask;
+    bool isRendering; // executed inside "CmdBeginRendering/CmdEndRendering"
+};
+
+struct VertexBufferStateVK {
+    VkBuffer handle;
+    uint64_t offset;
+    uint32_t stride;
+};
+
+// Shadow state for "enableRedundantStateFiltering" (zeroed = unknown)
+struct StateFilterVK {
+    std::array<std::array<VkDescriptorSet, STATE_FILTER_SET_MAX_NUM>, (size_t)BindPoint::MAX_NUM> descriptorSets;
+    std::array<VertexBufferStateVK, STATE_FILTER_VERTEX_BUFFER_MAX_NUM> vertexBuffers;
+    std::array<Viewport, STATE_FILTER_VIEWPORT_MAX_NUM> viewports;
+    std::array<Rect, STATE_FILTER_VIEWPORT_MAX_NUM> scissors;
+    const PipelineVK* pipeline;
+    VkBuffer indexBuffer;
+    uint64_t indexBufferOffset;
+    DepthBiasDesc depthBias;
+    uint32_t vertexBufferMask;
+    uint32_t viewportNum;
+    uint32_t scissorNum;
+    IndexType indexType;
+    bool isDepthBiasKnown;
+};
 
 struct CommandBufferVK final : public DebugNameBase {
     inline CommandBufferVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_PendingBufferBarriers(device.GetStdAllocator())
+        , m_PendingTextureBarriers(device.GetStdAllocator()) {
     }
 
     inline operator VkCommandBuffer() const {
@@ -21,10 +63,43 @@ struct CommandBufferVK final : public DebugNameBase {
         return m_Device;
     }
 
+    // Not NULL for a command buffer, which memory and handle are pooled by the allocator
+    inline CommandAllocatorVK* GetCommandAllocator() const {
+        return m_CommandAllocator;
+    }
+
+    inline uint32_t GetFilteredCommandNum() const {
+        return m_FilteredCommandNum;
+    }
+
+    // Emits barriers deferred by "enableBarrierBatching", must precede any command executing on the GPU
+    inline void FlushBarriers() {
+        if (m_IsBarrierBatchingEnabled)
+            EmitPendingBarriers();
+    }
+
+    // A reusable command buffer without "simultaneousUse" must not be pending at re-submission or re-recording
+    inline bool IsSubmissionTracked() const {
+        return m_IsReusable && !m_IsSimultaneousUse;
+    }
+
+    inline void SetPendingSubmission(FenceVK& fence, uint64_t value) {
+        m_PendingFence = &fence;
+        m_PendingValue = value;
+    }
+
+    inline void SetReusable(bool isSimultaneousUse) {
+        m_IsReusable = true;
+        m_IsSimultaneousUse = isSimultaneousUse;
+    }
+
     ~CommandBufferVK();
 
     void Create(VkCommandPool commandPool, VkCommandBuffer commandBuffer, QueueType type);
+    void Create(CommandAllocatorVK& commandAllocator, VkCommandBuffer commandBuffer);
+    void SetBundleDesc(const CommandBundleDesc& commandBundleDesc);
     Result Create(const CommandBufferVKDesc& commandBufferVKDesc);
+    void WaitForPendingSubmission();
 
     //================================================================================================================
     // DebugNameBase
@@ -46,6 +121,7 @@ struct CommandBufferVK final : public DebugNameBase {
     void Barrier(const BarrierDesc& barrierDesc);
     void BeginRendering(const RenderingDesc& renderingDesc);
     void EndRendering();
+    void ExecuteBundle(const CommandBuffer& commandBundle);
     void SetViewports(const Viewport* viewports, uint32_t viewportNum);
     void SetScissors(const Rect* rects, uint32_t rectNum);
     void SetDepthBounds(float boundsMin, float boundsMax);
@@ -60,6 +136,8 @@ struct CommandBufferVK final : public DebugNameBase {
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawDescNum);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawIndexedDescNum);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void Dispatch(const DispatchDesc& dispatchDesc);
@@ -88,11 +166,27 @@ struct CommandBufferVK final : public DebugNameBase {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc);
+
+private:
+    void SetDepthBiasState(const DepthBiasDesc& depthBiasDesc);
+    void DeferBufferBarrier(const VkBufferMemoryBarrier2& barrier);
+    void DeferTextureBarrier(const VkImageMemoryBarrier2& barrier);
+    void EmitPendingBarriers();
 
 private:
     DeviceVK& m_Device;
+    StateFilterVK m_StateFilter = {};
+    BundleVK m_Bundle = {};
+    Vector<VkBufferMemoryBarrier2> m_PendingBufferBarriers;
+    Vector<VkImageMemoryBarrier2> m_PendingTextureBarriers;
+    VkMemoryBarrier2 m_PendingGlobalBarrier = {}; // all global barriers are merged into one
     const PipelineLayoutVK* m_PipelineLayout = nullptr;
+    const PipelineVK* m_Pipeline = nullptr; // for "ExecuteIndirectCommands" without an execution set
     const DescriptorVK* m_DepthStencil = nullptr;
+    CommandAllocatorVK* m_CommandAllocator = nullptr;
+    FenceVK* m_PendingFence = nullptr; // the last submission of a tracked command buffer
+    uint64_t m_PendingValue = 0;
     VkCommandBuffer m_Handle = VK_NULL_HANDLE;
     VkCommandPool m_CommandPool = VK_NULL_HANDLE;
     QueueType m_Type = (QueueType)0;
@@ -101,7 +195,14 @@ private:
     Dim_t m_RenderLayerNum = 0;
     Dim_t m_RenderWidth = 0;
     Dim_t m_RenderHeight = 0;
+    uint32_t m_FilteredCommandNum = 0; // since "Begin"
     bool m_RenderPass = false;
+    bool m_IsBundle = false;
+    bool m_IsReusable = false;
+    bool m_IsSimultaneousUse = false;
+    bool m_IsStateFilteringEnabled = false;
+    bool m_IsBarrierBatchingEnabled = false;
+    bool m_IsPendingBarrierRegionLocal = false;
 };
 
 } // namespace nri
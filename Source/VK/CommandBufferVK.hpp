@@ -45,6 +45,48 @@ static inline void FillRenderingAttachmentInfo(VkRenderingAttachmentInfo& attach
     layerNum = std::min(layerNum, texViewDesc.layerOrSliceNum);
 }
 
+static inline bool IsEqual(const Viewport& a, const Viewport& b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height && a.depthMin == b.depthMin && a.depthMax == b.depthMax && a.originBottomLeft == b.originBottomLeft;
+}
+
+static inline bool IsEqual(const Rect& a, const Rect& b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+static inline bool IsEqual(const DepthBiasDesc& a, const DepthBiasDesc& b) {
+    return a.constant == b.constant && a.clamp == b.clamp && a.slope == b.slope;
+}
+
+static inline bool IsEqual(const VkImageSubresourceRange& a, const VkImageSubresourceRange& b) {
+    return a.aspectMask == b.aspectMask && a.baseMipLevel == b.baseMipLevel && a.levelCount == b.levelCount && a.baseArrayLayer == b.baseArrayLayer && a.layerCount == b.layerCount;
+}
+
+static inline bool IsOverlapped(uint64_t offsetA, uint64_t sizeA, uint64_t offsetB, uint64_t sizeB, uint64_t wholeSize) {
+    uint64_t endA = sizeA == wholeSize ? UINT64_MAX : offsetA + sizeA;
+    uint64_t endB = sizeB == wholeSize ? UINT64_MAX : offsetB + sizeB;
+
+    return offsetA < endB && offsetB < endA;
+}
+
+static inline bool IsOverlapped(const VkImageSubresourceRange& a, const VkImageSubresourceRange& b) {
+    return (a.aspectMask & b.aspectMask)
+        && IsOverlapped(a.baseMipLevel, a.levelCount, b.baseMipLevel, b.levelCount, VK_REMAINING_MIP_LEVELS)
+        && IsOverlapped(a.baseArrayLayer, a.layerCount, b.baseArrayLayer, b.layerCount, VK_REMAINING_ARRAY_LAYERS);
+}
+
+static inline bool IsOwnershipTransfer(uint32_t srcQueueFamilyIndex, uint32_t dstQueueFamilyIndex) {
+    return srcQueueFamilyIndex != dstQueueFamilyIndex;
+}
+
+// Two barriers without commands in between: "src" and "dst" scopes are united, the intermediate state is never observed
+template <typename T>
+static inline void MergeBarrier(T& pending, const T& barrier) {
+    pending.srcStageMask |= barrier.srcStageMask;
+    pending.srcAccessMask |= barrier.srcAccessMask;
+    pending.dstStageMask |= barrier.dstStageMask;
+    pending.dstAccessMask |= barrier.dstAccessMask;
+}
+
 CommandBufferVK::~CommandBufferVK() {
     if (m_CommandPool) {
         const auto& vk = m_Device.GetDispatchTable();
@@ -56,12 +98,48 @@ void CommandBufferVK::Create(VkCommandPool commandPool, VkCommandBuffer commandB
     m_CommandPool = commandPool;
     m_Handle = commandBuffer;
     m_Type = type;
+    m_IsStateFilteringEnabled = m_Device.IsStateFilteringEnabled();
+    m_IsBarrierBatchingEnabled = m_Device.IsBarrierBatchingEnabled();
+}
+
+void CommandBufferVK::Create(CommandAllocatorVK& commandAllocator, VkCommandBuffer commandBuffer) {
+    m_CommandAllocator = &commandAllocator;
+    m_Handle = commandBuffer;
+    m_Type = commandAllocator.GetType();
+    m_IsStateFilteringEnabled = m_Device.IsStateFilteringEnabled();
+    m_IsBarrierBatchingEnabled = m_Device.IsBarrierBatchingEnabled();
+}
+
+void CommandBufferVK::SetBundleDesc(const CommandBundleDesc& commandBundleDesc) {
+    m_IsBundle = true;
+
+    m_Bundle = {};
+    m_Bundle.colorFormatNum = commandBundleDesc.colorFormatNum;
+    for (uint32_t i = 0; i < commandBundleDesc.colorFormatNum; i++)
+        m_Bundle.colorFormats[i] = GetVkFormat(commandBundleDesc.colorFormats[i]);
+
+    m_Bundle.depthFormat = GetVkFormat(commandBundleDesc.depthStencilFormat);
+    if (GetFormatProps(commandBundleDesc.depthStencilFormat).isStencil)
+        m_Bundle.stencilFormat = m_Bundle.depthFormat;
+
+    m_Bundle.sampleNum = (VkSampleCountFlagBits)std::max(commandBundleDesc.sampleNum, (Sample_t)1);
+    m_Bundle.viewMask = commandBundleDesc.viewMask;
+    m_Bundle.isRendering = commandBundleDesc.colorFormatNum || commandBundleDesc.depthStencilFormat != Format::UNKNOWN;
+}
+
+void CommandBufferVK::WaitForPendingSubmission() {
+    if (m_PendingFence) {
+        m_PendingFence->Wait(m_PendingValue);
+        m_PendingFence = nullptr;
+    }
 }
 
 Result CommandBufferVK::Create(const CommandBufferVKDesc& commandBufferVKDesc) {
     m_CommandPool = VK_NULL_HANDLE;
     m_Handle = (VkCommandBuffer)commandBufferVKDesc.vkCommandBuffer;
     m_Type = commandBufferVKDesc.queueType;
+    m_IsStateFilteringEnabled = m_Device.IsStateFilteringEnabled();
+    m_IsBarrierBatchingEnabled = m_Device.IsBarrierBatchingEnabled();
 
     return Result::SUCCESS;
 }
@@ -74,17 +152,54 @@ NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool*) {
     VkCommandBufferBeginInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
     info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 
+    if (m_IsReusable) {
+        WaitForPendingSubmission();
+        info.flags = m_IsSimultaneousUse ? VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT : 0;
+    }
+
+    // A bundle can be executed many times, including pending executions by several primary command buffers
+    VkCommandBufferInheritanceRenderingInfo inheritanceRenderingInfo = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO};
+    VkCommandBufferInheritanceInfo inheritanceInfo = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO};
+    if (m_IsBundle) {
+        info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+        info.pInheritanceInfo = &inheritanceInfo;
+
+        if (m_Bundle.isRendering) {
+            inheritanceRenderingInfo.viewMask = m_Bundle.viewMask;
+            inheritanceRenderingInfo.colorAttachmentCount = m_Bundle.colorFormatNum;
+            inheritanceRenderingInfo.pColorAttachmentFormats = m_Bundle.colorFormats.data();
+            inheritanceRenderingInfo.depthAttachmentFormat = m_Bundle.depthFormat;
+            inheritanceRenderingInfo.stencilAttachmentFormat = m_Bundle.stencilFormat;
+            inheritanceRenderingInfo.rasterizationSamples = m_Bundle.sampleNum;
+
+            inheritanceInfo.pNext = &inheritanceRenderingInfo;
+            info.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        }
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.BeginCommandBuffer(m_Handle, &info);
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkBeginCommandBuffer");
 
     m_PipelineLayout = nullptr;
+    m_Pipeline = nullptr;
     m_PipelineBindPoint = BindPoint::INHERIT;
+    m_DepthStencil = nullptr;
+    m_ViewMask = m_Bundle.viewMask;
+    m_RenderPass = m_Bundle.isRendering;
+    m_StateFilter = {};
+    m_FilteredCommandNum = 0;
+    m_PendingBufferBarriers.clear();
+    m_PendingTextureBarriers.clear();
+    m_PendingGlobalBarrier = {};
+    m_IsPendingBarrierRegionLocal = false;
 
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result CommandBufferVK::End() {
+    FlushBarriers();
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.EndCommandBuffer(m_Handle);
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkEndCommandBuffer");
@@ -93,6 +208,21 @@ NRI_INLINE Result CommandBufferVK::End() {
 }
 
 NRI_INLINE void CommandBufferVK::SetViewports(const Viewport* viewports, uint32_t viewportNum) {
+    if (m_IsStateFilteringEnabled) {
+        bool isRedundant = viewportNum == m_StateFilter.viewportNum;
+        for (uint32_t i = 0; i < viewportNum && isRedundant; i++)
+            isRedundant = IsEqual(viewports[i], m_StateFilter.viewports[i]);
+
+        if (isRedundant) {
+            m_FilteredCommandNum++;
+            return;
+        }
+
+        m_StateFilter.viewportNum = viewportNum <= STATE_FILTER_VIEWPORT_MAX_NUM ? viewportNum : 0;
+        for (uint32_t i = 0; i < m_StateFilter.viewportNum; i++)
+            m_StateFilter.viewports[i] = viewports[i];
+    }
+
     Scratch<VkViewport> vkViewports = NRI_ALLOCATE_SCRATCH(m_Device, VkViewport, viewportNum);
     for (uint32_t i = 0; i < viewportNum; i++) {
         const Viewport& in = viewports[i];
@@ -116,6 +246,21 @@ NRI_INLINE void CommandBufferVK::SetViewports(const Viewport* viewports, uint32_
 }
 
 NRI_INLINE void CommandBufferVK::SetScissors(const Rect* rects, uint32_t rectNum) {
+    if (m_IsStateFilteringEnabled) {
+        bool isRedundant = rectNum == m_StateFilter.scissorNum;
+        for (uint32_t i = 0; i < rectNum && isRedundant; i++)
+            isRedundant = IsEqual(rects[i], m_StateFilter.scissors[i]);
+
+        if (isRedundant) {
+            m_FilteredCommandNum++;
+            return;
+        }
+
+        m_StateFilter.scissorNum = rectNum <= STATE_FILTER_VIEWPORT_MAX_NUM ? rectNum : 0;
+        for (uint32_t i = 0; i < m_StateFilter.scissorNum; i++)
+            m_StateFilter.scissors[i] = rects[i];
+    }
+
     Scratch<VkRect2D> vkRects = NRI_ALLOCATE_SCRATCH(m_Device, VkRect2D, rectNum);
     for (uint32_t i = 0; i < rectNum; i++) {
         const Rect& in = rects[i];
@@ -180,11 +325,27 @@ NRI_INLINE void CommandBufferVK::SetShadingRate(const ShadingRateDesc& shadingRa
 }
 
 NRI_INLINE void CommandBufferVK::SetDepthBias(const DepthBiasDesc& depthBiasDesc) {
+    SetDepthBiasState(depthBiasDesc);
+}
+
+void CommandBufferVK::SetDepthBiasState(const DepthBiasDesc& depthBiasDesc) {
+    if (m_IsStateFilteringEnabled) {
+        if (m_StateFilter.isDepthBiasKnown && IsEqual(depthBiasDesc, m_StateFilter.depthBias)) {
+            m_FilteredCommandNum++;
+            return;
+        }
+
+        m_StateFilter.depthBias = depthBiasDesc;
+        m_StateFilter.isDepthBiasKnown = true;
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdSetDepthBias(m_Handle, depthBiasDesc.constant, depthBiasDesc.clamp, depthBiasDesc.slope);
 }
 
 NRI_INLINE void CommandBufferVK::ClearAttachments(const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum) {
+    FlushBarriers();
+
     static_assert(sizeof(VkClearValue) == sizeof(ClearValue), "Sizeof mismatch");
 
     // Attachments
@@ -242,6 +403,8 @@ NRI_INLINE void CommandBufferVK::ClearAttachments(const ClearAttachmentDesc* cle
 }
 
 NRI_INLINE void CommandBufferVK::ClearStorage(const ClearStorageDesc& clearStorageDesc) {
+    FlushBarriers();
+
     const DescriptorVK& descriptorVK = *(DescriptorVK*)clearStorageDesc.descriptor;
 
     const auto& vk = m_Device.GetDispatchTable();
@@ -276,6 +439,8 @@ NRI_INLINE void CommandBufferVK::ClearStorage(const ClearStorageDesc& clearStora
 }
 
 NRI_INLINE void CommandBufferVK::BeginRendering(const RenderingDesc& renderingDesc) {
+    FlushBarriers();
+
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     Dim_t renderWidth = deviceDesc.dimensions.attachmentMaxDim;
     Dim_t renderHeight = deviceDesc.dimensions.attachmentMaxDim;
@@ -320,6 +485,9 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const RenderingDesc& renderingDe
     renderingInfo.renderArea = {{0, 0}, {renderWidth, renderHeight}};
     renderingInfo.layerCount = renderLayerNum;
 
+    if (renderingDesc.bundlesOnly)
+        renderingInfo.flags = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT;
+
     // Shading rate
     VkRenderingFragmentShadingRateAttachmentInfoKHR shadingRate = {VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR};
     if (renderingDesc.shadingRate) {
@@ -341,9 +509,15 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const RenderingDesc& renderingDe
     m_RenderLayerNum = renderLayerNum;
     m_ViewMask = renderingDesc.viewMask;
     m_RenderPass = true;
+
+    // Conservative: a new render pass starts with an unknown state
+    if (m_IsStateFilteringEnabled)
+        m_StateFilter = {};
 }
 
 NRI_INLINE void CommandBufferVK::EndRendering() {
+    FlushBarriers();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdEndRendering(m_Handle);
 
@@ -351,7 +525,51 @@ NRI_INLINE void CommandBufferVK::EndRendering() {
     m_RenderPass = false;
 }
 
+NRI_INLINE void CommandBufferVK::ExecuteBundle(const CommandBuffer& commandBundle) {
+    FlushBarriers();
+
+    VkCommandBuffer commandBundleHandle = (const CommandBufferVK&)commandBundle;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdExecuteCommands(m_Handle, 1, &commandBundleHandle);
+
+    // Bound state is undefined after execution
+    m_PipelineLayout = nullptr;
+    m_Pipeline = nullptr;
+    if (m_IsStateFilteringEnabled)
+        m_StateFilter = {};
+}
+
 NRI_INLINE void CommandBufferVK::SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
+    if (m_IsStateFilteringEnabled) {
+        bool isCached = baseSlot + vertexBufferNum <= STATE_FILTER_VERTEX_BUFFER_MAX_NUM;
+        bool isRedundant = isCached;
+
+        for (uint32_t i = 0; i < vertexBufferNum && isRedundant; i++) {
+            const VertexBufferDesc& vertexBufferDesc = vertexBufferDescs[i];
+            const VertexBufferStateVK& state = m_StateFilter.vertexBuffers[baseSlot + i];
+            VkBuffer handle = vertexBufferDesc.buffer ? ((BufferVK*)vertexBufferDesc.buffer)->GetHandle() : VK_NULL_HANDLE;
+
+            isRedundant = (m_StateFilter.vertexBufferMask & (1u << (baseSlot + i))) && state.handle == handle && state.offset == vertexBufferDesc.offset && state.stride == vertexBufferDesc.stride;
+        }
+
+        if (isRedundant) {
+            m_FilteredCommandNum++;
+            return;
+        }
+
+        if (!isCached)
+            m_StateFilter.vertexBufferMask = 0;
+
+        for (uint32_t i = 0; i < vertexBufferNum && isCached; i++) {
+            const VertexBufferDesc& vertexBufferDesc = vertexBufferDescs[i];
+            VkBuffer handle = vertexBufferDesc.buffer ? ((BufferVK*)vertexBufferDesc.buffer)->GetHandle() : VK_NULL_HANDLE;
+
+            m_StateFilter.vertexBuffers[baseSlot + i] = {handle, vertexBufferDesc.offset, vertexBufferDesc.stride};
+            m_StateFilter.vertexBufferMask |= 1u << (baseSlot + i);
+        }
+    }
+
     Scratch<uint8_t> scratch = NRI_ALLOCATE_SCRATCH(m_Device, uint8_t, vertexBufferNum * (sizeof(VkBuffer) + sizeof(VkDeviceSize) * 3));
     uint8_t* ptr = scratch;
 
@@ -371,6 +589,8 @@ NRI_INLINE void CommandBufferVK::SetVertexBuffers(uint32_t baseSlot, const Verte
 
         const BufferVK* bufferVK = (BufferVK*)vertexBufferDesc.buffer;
         if (bufferVK) {
+            NRI_VALIDATE_ARGUMENT(&m_Device, vertexBufferDesc.offset <= bufferVK->GetDesc().size, ReturnVoid(), "'vertexBufferDescs[%u].offset' is out of bounds", i);
+
             handles[i] = bufferVK->GetHandle();
             offsets[i] = vertexBufferDesc.offset;
             sizes[i] = bufferVK->GetDesc().size - vertexBufferDesc.offset;
@@ -389,6 +609,18 @@ NRI_INLINE void CommandBufferVK::SetVertexBuffers(uint32_t baseSlot, const Verte
 
 NRI_INLINE void CommandBufferVK::SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType) {
     const BufferVK& bufferVK = (BufferVK&)buffer;
+    NRI_VALIDATE_ARGUMENT(&m_Device, offset < bufferVK.GetDesc().size, ReturnVoid(), "'offset' is out of bounds");
+
+    if (m_IsStateFilteringEnabled) {
+        if (m_StateFilter.indexBuffer == bufferVK.GetHandle() && m_StateFilter.indexBufferOffset == offset && m_StateFilter.indexType == indexType) {
+            m_FilteredCommandNum++;
+            return;
+        }
+
+        m_StateFilter.indexBuffer = bufferVK.GetHandle();
+        m_StateFilter.indexBufferOffset = offset;
+        m_StateFilter.indexType = indexType;
+    }
 
     const auto& vk = m_Device.GetDispatchTable();
     if (m_Device.m_IsSupported.maintenance5) {
@@ -399,52 +631,95 @@ NRI_INLINE void CommandBufferVK::SetIndexBuffer(const Buffer& buffer, uint64_t o
 }
 
 NRI_INLINE void CommandBufferVK::SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
-    m_PipelineLayout = (PipelineLayoutVK*)&pipelineLayout;
+    // Re-binding the same layout doesn't disturb anything, including pushed immutable samplers
+    const PipelineLayoutVK* pipelineLayoutVK = (PipelineLayoutVK*)&pipelineLayout;
+    if (m_PipelineLayout == pipelineLayoutVK && m_PipelineBindPoint == bindPoint)
+        return;
+
+    m_PipelineLayout = pipelineLayoutVK;
     m_PipelineBindPoint = bindPoint;
 
+    // Descriptor sets are bound with the current pipeline layout
+    if (m_IsStateFilteringEnabled)
+        m_StateFilter.descriptorSets = {};
+
     { // Push immutable samplers
         const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
 
-        for (uint32_t i = bindingInfo.rootSamplerBindingOffset; i < (uint32_t)bindingInfo.pushDescriptors.size(); i++) {
-            // https://registry.khronos.org/vulkan/specs/latest/html/vkspec.html#descriptorsets-push-descriptors
-            // To push an immutable sampler...
-            VkDescriptorImageInfo imageInfo = {};
+        uint32_t rootSamplerNum = (uint32_t)bindingInfo.pushDescriptors.size() - bindingInfo.rootSamplerBindingOffset;
+        if (!rootSamplerNum)
+            return;
+
+        // https://registry.khronos.org/vulkan/specs/latest/html/vkspec.html#descriptorsets-push-descriptors
+        // To push an immutable sampler...
+        VkDescriptorImageInfo imageInfo = {};
 
-            VkWriteDescriptorSet descriptorWrite = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-            descriptorWrite.dstBinding = bindingInfo.pushDescriptors[i];
+        Scratch<VkWriteDescriptorSet> descriptorWrites = NRI_ALLOCATE_SCRATCH(m_Device, VkWriteDescriptorSet, rootSamplerNum);
+        for (uint32_t i = 0; i < rootSamplerNum; i++) {
+            VkWriteDescriptorSet& descriptorWrite = descriptorWrites[i];
+            descriptorWrite = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+            descriptorWrite.dstBinding = bindingInfo.pushDescriptors[bindingInfo.rootSamplerBindingOffset + i];
             descriptorWrite.descriptorCount = 1;
             descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
             descriptorWrite.pImageInfo = &imageInfo;
+        }
 
-            VkPipelineBindPoint vkPipelineBindPoint = GetPipelineBindPoint(bindPoint);
+        VkPipelineBindPoint vkPipelineBindPoint = GetPipelineBindPoint(bindPoint);
 
-            const auto& vk = m_Device.GetDispatchTable();
-            vk.CmdPushDescriptorSet(m_Handle, vkPipelineBindPoint, *m_PipelineLayout, bindingInfo.rootRegisterSpace, 1, &descriptorWrite);
-        }
+        const auto& vk = m_Device.GetDispatchTable();
+        vk.CmdPushDescriptorSet(m_Handle, vkPipelineBindPoint, *m_PipelineLayout, bindingInfo.rootRegisterSpace, rootSamplerNum, descriptorWrites);
     }
 }
 
 NRI_INLINE void CommandBufferVK::SetPipeline(const Pipeline& pipeline) {
     const PipelineVK& pipelineVK = (PipelineVK&)pipeline;
+    m_Pipeline = &pipelineVK;
 
-    const auto& vk = m_Device.GetDispatchTable();
-    vk.CmdBindPipeline(m_Handle, pipelineVK.GetBindPoint(), pipelineVK);
+    if (m_IsStateFilteringEnabled && m_StateFilter.pipeline == &pipelineVK)
+        m_FilteredCommandNum++;
+    else {
+        const auto& vk = m_Device.GetDispatchTable();
+        vk.CmdBindPipeline(m_Handle, pipelineVK.GetBindPoint(), pipelineVK);
+
+        // A pipeline without a dynamic state overrides it
+        m_StateFilter.pipeline = &pipelineVK;
+        if (pipelineVK.GetBindPoint() == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+            if (!pipelineVK.IsVertexStrideDynamic())
+                m_StateFilter.vertexBufferMask = 0;
+            if (!IsDepthBiasEnabled(pipelineVK.GetDepthBias()))
+                m_StateFilter.isDepthBiasKnown = false;
+        }
+    }
 
-    // Set depth bias provided at pipeline creation time to match D3D12 behavior
+    // Set depth bias provided at pipeline creation time to match D3D12 behavior (can be filtered, if already set)
     const DepthBiasDesc& depthBias = pipelineVK.GetDepthBias();
     if (IsDepthBiasEnabled(depthBias))
-        vk.CmdSetDepthBias(m_Handle, depthBias.constant, depthBias.clamp, depthBias.slope);
+        SetDepthBiasState(depthBias);
 }
 
 NRI_INLINE void CommandBufferVK::SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc) {
+    NRI_VALIDATE_ARGUMENT(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
+    NRI_VALIDATE_ARGUMENT(&m_Device, setDescriptorSetDesc.descriptorSet, ReturnVoid(), "'descriptorSet' is NULL");
+
     const DescriptorSetVK& descriptorSetVK = *(DescriptorSetVK*)setDescriptorSetDesc.descriptorSet;
     VkDescriptorSet vkDescriptorSet = descriptorSetVK.GetHandle();
 
     const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
+    NRI_VALIDATE_ARGUMENT(&m_Device, setDescriptorSetDesc.setIndex < bindingInfo.sets.size(), ReturnVoid(), "'setIndex' is out of bounds");
     uint32_t registerSpace = bindingInfo.sets[setDescriptorSetDesc.setIndex].registerSpace;
 
     BindPoint bindPoint = setDescriptorSetDesc.bindPoint == BindPoint::INHERIT ? m_PipelineBindPoint : setDescriptorSetDesc.bindPoint;
 
+    if (m_IsStateFilteringEnabled && registerSpace < STATE_FILTER_SET_MAX_NUM) {
+        VkDescriptorSet& boundDescriptorSet = m_StateFilter.descriptorSets[(size_t)bindPoint][registerSpace];
+        if (boundDescriptorSet == vkDescriptorSet) {
+            m_FilteredCommandNum++;
+            return;
+        }
+
+        boundDescriptorSet = vkDescriptorSet;
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
 #if 0 // TODO: NV driver can crash if VVL is enabled...
     if (m_Device.m_IsSupported.maintenance6) {
@@ -480,7 +755,10 @@ NRI_INLINE void CommandBufferVK::SetDescriptorSet(const SetDescriptorSetDesc& se
 }
 
 NRI_INLINE void CommandBufferVK::SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc) {
+    NRI_VALIDATE_ARGUMENT(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
+
     const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
+    NRI_VALIDATE_ARGUMENT(&m_Device, setRootConstantsDesc.rootConstantIndex < bindingInfo.pushConstants.size(), ReturnVoid(), "'rootConstantIndex' is out of bounds");
     const PushConstantBindingDesc& pushConstantBindingDesc = bindingInfo.pushConstants[setRootConstantsDesc.rootConstantIndex];
     uint32_t offset = pushConstantBindingDesc.offset + setRootConstantsDesc.offset;
 
@@ -499,11 +777,15 @@ NRI_INLINE void CommandBufferVK::SetRootConstants(const SetRootConstantsDesc& se
 }
 
 NRI_INLINE void CommandBufferVK::SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc) {
+    NRI_VALIDATE_ARGUMENT(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
+    NRI_VALIDATE_ARGUMENT(&m_Device, setRootDescriptorDesc.descriptor, ReturnVoid(), "'descriptor' is NULL");
+
     const DescriptorVK& descriptorVK = *(DescriptorVK*)setRootDescriptorDesc.descriptor;
 
     VkAccelerationStructureKHR accelerationStructure = descriptorVK.GetAccelerationStructure();
 
     const auto& bindingInfo = m_PipelineLayout->GetBindingInfo();
+    NRI_VALIDATE_ARGUMENT(&m_Device, setRootDescriptorDesc.rootDescriptorIndex < bindingInfo.rootSamplerBindingOffset, ReturnVoid(), "'rootDescriptorIndex' is out of bounds");
 
     VkDescriptorBufferInfo bufferInfo = descriptorVK.GetBufferInfo();
     bufferInfo.offset += setRootDescriptorDesc.offset; // TODO: adjust "size"?
@@ -545,19 +827,98 @@ NRI_INLINE void CommandBufferVK::SetRootDescriptor(const SetRootDescriptorDesc&
 }
 
 NRI_INLINE void CommandBufferVK::Draw(const DrawDesc& drawDesc) {
+    FlushBarriers();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDraw(m_Handle, drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
 }
 
 NRI_INLINE void CommandBufferVK::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
+    FlushBarriers();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDrawIndexed(m_Handle, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
 }
 
+// A multi-draw shares instancing, i.e. it covers a run of draws with the same "instanceNum" and "baseInstance"
+template <typename T>
+static inline uint32_t GetMultiDrawRunEnd(const T* descs, uint32_t begin, uint32_t end, uint32_t maxNum) {
+    const T& first = descs[begin];
+
+    uint32_t i = begin + 1;
+    end = std::min(end, begin + maxNum);
+    while (i < end && descs[i].instanceNum == first.instanceNum && descs[i].baseInstance == first.baseInstance)
+        i++;
+
+    return i;
+}
+
+NRI_INLINE void CommandBufferVK::DrawMulti(const DrawDesc* drawDescs, uint32_t drawDescNum) {
+    FlushBarriers();
+
+    const auto& vk = m_Device.GetDispatchTable();
+    if (!m_Device.m_IsSupported.multiDraw) {
+        for (uint32_t i = 0; i < drawDescNum; i++) {
+            const DrawDesc& drawDesc = drawDescs[i];
+            vk.CmdDraw(m_Handle, drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
+        }
+
+        return;
+    }
+
+    Scratch<VkMultiDrawInfoEXT> drawInfos = NRI_ALLOCATE_SCRATCH(m_Device, VkMultiDrawInfoEXT, drawDescNum);
+    for (uint32_t i = 0; i < drawDescNum; i++) {
+        drawInfos[i].firstVertex = drawDescs[i].baseVertex;
+        drawInfos[i].vertexCount = drawDescs[i].vertexNum;
+    }
+
+    for (uint32_t begin = 0; begin < drawDescNum;) {
+        uint32_t end = GetMultiDrawRunEnd(drawDescs, begin, drawDescNum, m_Device.GetMultiDrawMaxNum());
+
+        const DrawDesc& first = drawDescs[begin];
+        vk.CmdDrawMultiEXT(m_Handle, end - begin, &drawInfos[begin], first.instanceNum, first.baseInstance, sizeof(VkMultiDrawInfoEXT));
+
+        begin = end;
+    }
+}
+
+NRI_INLINE void CommandBufferVK::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawIndexedDescNum) {
+    FlushBarriers();
+
+    const auto& vk = m_Device.GetDispatchTable();
+    if (!m_Device.m_IsSupported.multiDraw) {
+        for (uint32_t i = 0; i < drawIndexedDescNum; i++) {
+            const DrawIndexedDesc& drawIndexedDesc = drawIndexedDescs[i];
+            vk.CmdDrawIndexed(m_Handle, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
+        }
+
+        return;
+    }
+
+    Scratch<VkMultiDrawIndexedInfoEXT> drawInfos = NRI_ALLOCATE_SCRATCH(m_Device, VkMultiDrawIndexedInfoEXT, drawIndexedDescNum);
+    for (uint32_t i = 0; i < drawIndexedDescNum; i++) {
+        drawInfos[i].firstIndex = drawIndexedDescs[i].baseIndex;
+        drawInfos[i].indexCount = drawIndexedDescs[i].indexNum;
+        drawInfos[i].vertexOffset = drawIndexedDescs[i].baseVertex;
+    }
+
+    for (uint32_t begin = 0; begin < drawIndexedDescNum;) {
+        uint32_t end = GetMultiDrawRunEnd(drawIndexedDescs, begin, drawIndexedDescNum, m_Device.GetMultiDrawMaxNum());
+
+        const DrawIndexedDesc& first = drawIndexedDescs[begin];
+        vk.CmdDrawMultiIndexedEXT(m_Handle, end - begin, &drawInfos[begin], first.instanceNum, first.baseInstance, sizeof(VkMultiDrawIndexedInfoEXT), nullptr);
+
+        begin = end;
+    }
+}
+
 NRI_INLINE void CommandBufferVK::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    FlushBarriers();
+
     const BufferVK& bufferVK = (BufferVK&)buffer;
-    const auto& vk = m_Device.GetDispatchTable();
+    NRI_VALIDATE_ARGUMENT(&m_Device, offset < bufferVK.GetDesc().size, ReturnVoid(), "'offset' is out of bounds");
 
+    const auto& vk = m_Device.GetDispatchTable();
     if (countBuffer) {
         const BufferVK& countBufferVK = *(BufferVK*)countBuffer;
         vk.CmdDrawIndirectCount(m_Handle, bufferVK.GetHandle(), offset, countBufferVK.GetHandle(), countBufferOffset, drawNum, stride);
@@ -566,9 +927,12 @@ NRI_INLINE void CommandBufferVK::DrawIndirect(const Buffer& buffer, uint64_t off
 }
 
 NRI_INLINE void CommandBufferVK::DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    FlushBarriers();
+
     const BufferVK& bufferVK = (BufferVK&)buffer;
-    const auto& vk = m_Device.GetDispatchTable();
+    NRI_VALIDATE_ARGUMENT(&m_Device, offset < bufferVK.GetDesc().size, ReturnVoid(), "'offset' is out of bounds");
 
+    const auto& vk = m_Device.GetDispatchTable();
     if (countBuffer) {
         const BufferVK& countBufferVK = *(BufferVK*)countBuffer;
         vk.CmdDrawIndexedIndirectCount(m_Handle, bufferVK.GetHandle(), offset, countBufferVK.GetHandle(), countBufferOffset, drawNum, stride);
@@ -577,9 +941,14 @@ NRI_INLINE void CommandBufferVK::DrawIndexedIndirect(const Buffer& buffer, uint6
 }
 
 NRI_INLINE void CommandBufferVK::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    FlushBarriers();
+
     const BufferVK& src = (BufferVK&)srcBuffer;
     const BufferVK& dstBufferVK = (BufferVK&)dstBuffer;
 
+    NRI_VALIDATE_ARGUMENT(&m_Device, size == WHOLE_SIZE || srcOffset + size <= src.GetDesc().size, ReturnVoid(), "'srcOffset + size' is out of bounds");
+    NRI_VALIDATE_ARGUMENT(&m_Device, size == WHOLE_SIZE || dstOffset + size <= dstBufferVK.GetDesc().size, ReturnVoid(), "'dstOffset + size' is out of bounds");
+
     VkBufferCopy2 region = {VK_STRUCTURE_TYPE_BUFFER_COPY_2};
     region.srcOffset = srcOffset;
     region.dstOffset = dstOffset;
@@ -596,6 +965,8 @@ NRI_INLINE void CommandBufferVK::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffse
 }
 
 NRI_INLINE void CommandBufferVK::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    FlushBarriers();
+
     const TextureVK& src = (TextureVK&)srcTexture;
     const TextureVK& dst = (TextureVK&)dstTexture;
     const TextureDesc& dstDesc = dst.GetDesc();
@@ -672,6 +1043,8 @@ NRI_INLINE void CommandBufferVK::CopyTexture(Texture& dstTexture, const TextureR
 }
 
 NRI_INLINE void CommandBufferVK::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion, ResolveOp resolveOp) {
+    FlushBarriers();
+
     const TextureVK& src = (TextureVK&)srcTexture;
     const TextureVK& dst = (TextureVK&)dstTexture;
     const TextureDesc& dstDesc = dst.GetDesc();
@@ -757,6 +1130,8 @@ NRI_INLINE void CommandBufferVK::ResolveTexture(Texture& dstTexture, const Textu
 }
 
 NRI_INLINE void CommandBufferVK::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    FlushBarriers();
+
     const BufferVK& src = (BufferVK&)srcBuffer;
     const TextureVK& dst = (TextureVK&)dstTexture;
     const FormatProps& formatProps = GetFormatProps(dst.GetDesc().format);
@@ -804,6 +1179,8 @@ NRI_INLINE void CommandBufferVK::UploadBufferToTexture(Texture& dstTexture, cons
 }
 
 NRI_INLINE void CommandBufferVK::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    FlushBarriers();
+
     const TextureVK& src = (TextureVK&)srcTexture;
     const BufferVK& dst = (BufferVK&)dstBuffer;
     const FormatProps& formatProps = GetFormatProps(src.GetDesc().format);
@@ -851,24 +1228,34 @@ NRI_INLINE void CommandBufferVK::ReadbackTextureToBuffer(Buffer& dstBuffer, cons
 }
 
 NRI_INLINE void CommandBufferVK::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    FlushBarriers();
+
     BufferVK& dst = (BufferVK&)buffer;
 
     if (size == WHOLE_SIZE)
         size = dst.GetDesc().size;
 
+    NRI_VALIDATE_ARGUMENT(&m_Device, offset + size <= dst.GetDesc().size, ReturnVoid(), "'offset + size' is out of bounds");
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdFillBuffer(m_Handle, dst.GetHandle(), offset, size, 0);
 }
 
 NRI_INLINE void CommandBufferVK::Dispatch(const DispatchDesc& dispatchDesc) {
+    FlushBarriers();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDispatch(m_Handle, dispatchDesc.x, dispatchDesc.y, dispatchDesc.z);
 }
 
 NRI_INLINE void CommandBufferVK::DispatchIndirect(const Buffer& buffer, uint64_t offset) {
+    FlushBarriers();
+
     static_assert(sizeof(DispatchDesc) == sizeof(VkDispatchIndirectCommand));
 
     const BufferVK& bufferVK = (BufferVK&)buffer;
+    NRI_VALIDATE_ARGUMENT(&m_Device, offset + sizeof(DispatchDesc) <= bufferVK.GetDesc().size, ReturnVoid(), "'offset' is out of bounds");
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDispatchIndirect(m_Handle, bufferVK.GetHandle(), offset);
 }
@@ -968,8 +1355,8 @@ NRI_INLINE void CommandBufferVK::Barrier(const BarrierDesc& barrierDesc) {
         out.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED; // "VK_SHARING_MODE_CONCURRENT" is intentionally used for buffers to match D3D12 spec
         out.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         out.buffer = bufferVK.GetHandle();
-        out.offset = 0;
-        out.size = VK_WHOLE_SIZE;
+        out.offset = in.offset;
+        out.size = in.size == WHOLE_SIZE ? VK_WHOLE_SIZE : in.size;
     }
 
     // Texture
@@ -1008,6 +1395,30 @@ NRI_INLINE void CommandBufferVK::Barrier(const BarrierDesc& barrierDesc) {
             isRegionLocal = true;
     }
 
+    // Defer
+    if (m_IsBarrierBatchingEnabled) {
+        // "VK_DEPENDENCY_BY_REGION_BIT" applies to the whole batch, i.e. region-local and regular barriers can't be in one batch
+        if (isRegionLocal != m_IsPendingBarrierRegionLocal)
+            EmitPendingBarriers();
+
+        for (uint32_t i = 0; i < barrierDesc.globalNum; i++) {
+            if (m_PendingGlobalBarrier.sType == VK_STRUCTURE_TYPE_MEMORY_BARRIER_2)
+                MergeBarrier(m_PendingGlobalBarrier, memoryBarriers[i]);
+            else
+                m_PendingGlobalBarrier = memoryBarriers[i];
+        }
+
+        for (uint32_t i = 0; i < barrierDesc.bufferNum; i++)
+            DeferBufferBarrier(bufferBarriers[i]);
+
+        for (uint32_t i = 0; i < barrierDesc.textureNum; i++)
+            DeferTextureBarrier(textureBarriers[i]);
+
+        m_IsPendingBarrierRegionLocal = isRegionLocal;
+
+        return;
+    }
+
     // Submit
     VkDependencyInfo dependencyInfo = {VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
     dependencyInfo.memoryBarrierCount = barrierDesc.globalNum;
@@ -1024,13 +1435,86 @@ NRI_INLINE void CommandBufferVK::Barrier(const BarrierDesc& barrierDesc) {
     vk.CmdPipelineBarrier2(m_Handle, &dependencyInfo);
 }
 
+void CommandBufferVK::DeferBufferBarrier(const VkBufferMemoryBarrier2& barrier) {
+    for (VkBufferMemoryBarrier2& pending : m_PendingBufferBarriers) {
+        if (pending.buffer != barrier.buffer || !IsOverlapped(pending.offset, pending.size, barrier.offset, barrier.size, VK_WHOLE_SIZE))
+            continue;
+
+        if (pending.offset == barrier.offset && pending.size == barrier.size) {
+            MergeBarrier(pending, barrier);
+            return;
+        }
+
+        // Partially overlapping ranges can't be in one batch
+        EmitPendingBarriers();
+        break;
+    }
+
+    m_PendingBufferBarriers.push_back(barrier);
+}
+
+void CommandBufferVK::DeferTextureBarrier(const VkImageMemoryBarrier2& barrier) {
+    for (VkImageMemoryBarrier2& pending : m_PendingTextureBarriers) {
+        if (pending.image != barrier.image || !IsOverlapped(pending.subresourceRange, barrier.subresourceRange))
+            continue;
+
+        // "A -> B" followed by "B -> C" becomes "A -> C"
+        bool isOwnershipTransfer = IsOwnershipTransfer(pending.srcQueueFamilyIndex, pending.dstQueueFamilyIndex) || IsOwnershipTransfer(barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex);
+        if (!isOwnershipTransfer && IsEqual(pending.subresourceRange, barrier.subresourceRange)) {
+            MergeBarrier(pending, barrier);
+
+            if (barrier.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED)
+                pending.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED; // discard wins
+            pending.newLayout = barrier.newLayout;
+
+            return;
+        }
+
+        // Partially overlapping subresources and queue ownership transfers can't be in one batch
+        EmitPendingBarriers();
+        break;
+    }
+
+    m_PendingTextureBarriers.push_back(barrier);
+}
+
+void CommandBufferVK::EmitPendingBarriers() {
+    bool hasGlobalBarrier = m_PendingGlobalBarrier.sType == VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+    if (!hasGlobalBarrier && m_PendingBufferBarriers.empty() && m_PendingTextureBarriers.empty())
+        return;
+
+    VkDependencyInfo dependencyInfo = {VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+    dependencyInfo.memoryBarrierCount = hasGlobalBarrier ? 1 : 0;
+    dependencyInfo.pMemoryBarriers = &m_PendingGlobalBarrier;
+    dependencyInfo.bufferMemoryBarrierCount = (uint32_t)m_PendingBufferBarriers.size();
+    dependencyInfo.pBufferMemoryBarriers = m_PendingBufferBarriers.data();
+    dependencyInfo.imageMemoryBarrierCount = (uint32_t)m_PendingTextureBarriers.size();
+    dependencyInfo.pImageMemoryBarriers = m_PendingTextureBarriers.data();
+
+    if (m_IsPendingBarrierRegionLocal)
+        dependencyInfo.dependencyFlags |= VK_DEPENDENCY_BY_REGION_BIT;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdPipelineBarrier2(m_Handle, &dependencyInfo);
+
+    // "clear" keeps the capacity, i.e. no allocations in steady state
+    m_PendingBufferBarriers.clear();
+    m_PendingTextureBarriers.clear();
+    m_PendingGlobalBarrier = {};
+    m_IsPendingBarrierRegionLocal = false;
+}
+
 NRI_INLINE void CommandBufferVK::BeginQuery(QueryPool& queryPool, uint32_t offset) {
+    FlushBarriers();
+
     QueryPoolVK& queryPoolVK = (QueryPoolVK&)queryPool;
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBeginQuery(m_Handle, queryPoolVK.GetHandle(), offset, (VkQueryControlFlagBits)0);
 }
 
 NRI_INLINE void CommandBufferVK::EndQuery(QueryPool& queryPool, uint32_t offset) {
+    FlushBarriers();
+
     QueryPoolVK& queryPoolVK = (QueryPoolVK&)queryPool;
     const auto& vk = m_Device.GetDispatchTable();
 
@@ -1043,6 +1527,8 @@ NRI_INLINE void CommandBufferVK::EndQuery(QueryPool& queryPool, uint32_t offset)
 }
 
 NRI_INLINE void CommandBufferVK::CopyQueries(const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset) {
+    FlushBarriers();
+
     const QueryPoolVK& queryPoolVK = (QueryPoolVK&)queryPool;
     const BufferVK& bufferVK = (BufferVK&)dstBuffer;
 
@@ -1054,6 +1540,8 @@ NRI_INLINE void CommandBufferVK::CopyQueries(const QueryPool& queryPool, uint32_
 }
 
 NRI_INLINE void CommandBufferVK::ResetQueries(QueryPool& queryPool, uint32_t offset, uint32_t num) {
+    FlushBarriers();
+
     QueryPoolVK& queryPoolVK = (QueryPoolVK&)queryPool;
 
     const auto& vk = m_Device.GetDispatchTable();
@@ -1093,6 +1581,8 @@ NRI_INLINE void CommandBufferVK::Annotation(const char* name, uint32_t bgra) {
 }
 
 NRI_INLINE void CommandBufferVK::BuildTopLevelAccelerationStructures(const BuildTopLevelAccelerationStructureDesc* buildTopLevelAccelerationStructureDescs, uint32_t buildTopLevelAccelerationStructureDescNum) {
+    FlushBarriers();
+
     static_assert(sizeof(VkAccelerationStructureInstanceKHR) == sizeof(TopLevelInstance), "Mismatched sizeof");
 
     Scratch<VkAccelerationStructureBuildGeometryInfoKHR> infos = NRI_ALLOCATE_SCRATCH(m_Device, VkAccelerationStructureBuildGeometryInfoKHR, buildTopLevelAccelerationStructureDescNum);
@@ -1144,6 +1634,8 @@ NRI_INLINE void CommandBufferVK::BuildTopLevelAccelerationStructures(const Build
 }
 
 NRI_INLINE void CommandBufferVK::BuildBottomLevelAccelerationStructures(const BuildBottomLevelAccelerationStructureDesc* buildBottomLevelAccelerationStructureDescs, uint32_t buildBottomLevelAccelerationStructureDescNum) {
+    FlushBarriers();
+
     // Count
     uint32_t geometryTotalNum = 0;
     uint32_t micromapTotalNum = 0;
@@ -1213,6 +1705,8 @@ NRI_INLINE void CommandBufferVK::BuildBottomLevelAccelerationStructures(const Bu
 }
 
 NRI_INLINE void CommandBufferVK::BuildMicromaps(const BuildMicromapDesc* buildMicromapDescs, uint32_t buildMicromapDescNum) {
+    FlushBarriers();
+
     static_assert(sizeof(MicromapTriangle) == sizeof(VkMicromapTriangleEXT), "Mismatched sizeof");
 
     Scratch<VkMicromapBuildInfoEXT> infos = NRI_ALLOCATE_SCRATCH(m_Device, VkMicromapBuildInfoEXT, buildMicromapDescNum);
@@ -1243,6 +1737,8 @@ NRI_INLINE void CommandBufferVK::BuildMicromaps(const BuildMicromapDesc* buildMi
 }
 
 NRI_INLINE void CommandBufferVK::CopyAccelerationStructure(AccelerationStructure& dst, const AccelerationStructure& src, CopyMode copyMode) {
+    FlushBarriers();
+
     VkAccelerationStructureKHR dstHandle = ((AccelerationStructureVK&)dst).GetHandle();
     VkAccelerationStructureKHR srcHandle = ((AccelerationStructureVK&)src).GetHandle();
 
@@ -1256,6 +1752,8 @@ NRI_INLINE void CommandBufferVK::CopyAccelerationStructure(AccelerationStructure
 }
 
 NRI_INLINE void CommandBufferVK::CopyMicromap(Micromap& dst, const Micromap& src, CopyMode copyMode) {
+    FlushBarriers();
+
     VkMicromapEXT dstHandle = ((MicromapVK&)dst).GetHandle();
     VkMicromapEXT srcHandle = ((MicromapVK&)src).GetHandle();
 
@@ -1269,6 +1767,8 @@ NRI_INLINE void CommandBufferVK::CopyMicromap(Micromap& dst, const Micromap& src
 }
 
 NRI_INLINE void CommandBufferVK::WriteAccelerationStructuresSizes(const AccelerationStructure* const* accelerationStructures, uint32_t accelerationStructureNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    FlushBarriers();
+
     Scratch<VkAccelerationStructureKHR> handles = NRI_ALLOCATE_SCRATCH(m_Device, VkAccelerationStructureKHR, accelerationStructureNum);
     for (uint32_t i = 0; i < accelerationStructureNum; i++)
         handles[i] = ((AccelerationStructureVK*)accelerationStructures[i])->GetHandle();
@@ -1280,6 +1780,8 @@ NRI_INLINE void CommandBufferVK::WriteAccelerationStructuresSizes(const Accelera
 }
 
 NRI_INLINE void CommandBufferVK::WriteMicromapsSizes(const Micromap* const* micromaps, uint32_t micromapNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    FlushBarriers();
+
     Scratch<VkMicromapEXT> handles = NRI_ALLOCATE_SCRATCH(m_Device, VkMicromapEXT, micromapNum);
     for (uint32_t i = 0; i < micromapNum; i++)
         handles[i] = ((MicromapVK*)micromaps[i])->GetHandle();
@@ -1291,6 +1793,8 @@ NRI_INLINE void CommandBufferVK::WriteMicromapsSizes(const Micromap* const* micr
 }
 
 NRI_INLINE void CommandBufferVK::DispatchRays(const DispatchRaysDesc& dispatchRaysDesc) {
+    FlushBarriers();
+
     VkStridedDeviceAddressRegionKHR raygen = {};
     raygen.deviceAddress = GetBufferDeviceAddress(dispatchRaysDesc.raygenShader.buffer, dispatchRaysDesc.raygenShader.offset);
     raygen.size = dispatchRaysDesc.raygenShader.size;
@@ -1316,6 +1820,8 @@ NRI_INLINE void CommandBufferVK::DispatchRays(const DispatchRaysDesc& dispatchRa
 }
 
 NRI_INLINE void CommandBufferVK::DispatchRaysIndirect(const Buffer& buffer, uint64_t offset) {
+    FlushBarriers();
+
     static_assert(sizeof(DispatchRaysIndirectDesc) == sizeof(VkTraceRaysIndirectCommand2KHR));
 
     VkDeviceAddress deviceAddress = GetBufferDeviceAddress(&buffer, offset);
@@ -1325,19 +1831,62 @@ NRI_INLINE void CommandBufferVK::DispatchRaysIndirect(const Buffer& buffer, uint
 }
 
 NRI_INLINE void CommandBufferVK::DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc) {
+    FlushBarriers();
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDrawMeshTasksEXT(m_Handle, drawMeshTasksDesc.x, drawMeshTasksDesc.y, drawMeshTasksDesc.z);
 }
 
 NRI_INLINE void CommandBufferVK::DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    FlushBarriers();
+
     static_assert(sizeof(DrawMeshTasksDesc) == sizeof(VkDrawMeshTasksIndirectCommandEXT));
 
     const BufferVK& bufferVK = (BufferVK&)buffer;
-    const auto& vk = m_Device.GetDispatchTable();
+    NRI_VALIDATE_ARGUMENT(&m_Device, offset < bufferVK.GetDesc().size, ReturnVoid(), "'offset' is out of bounds");
 
+    const auto& vk = m_Device.GetDispatchTable();
     if (countBuffer) {
         const BufferVK& countBufferVK = *(BufferVK*)countBuffer;
         vk.CmdDrawMeshTasksIndirectCountEXT(m_Handle, bufferVK.GetHandle(), offset, countBufferVK.GetHandle(), countBufferOffset, drawNum, stride);
     } else
         vk.CmdDrawMeshTasksIndirectEXT(m_Handle, bufferVK.GetHandle(), offset, drawNum, stride);
 }
+
+NRI_INLINE void CommandBufferVK::ExecuteIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    FlushBarriers();
+
+    const IndirectCommandLayoutVK& indirectCommandLayoutVK = *(IndirectCommandLayoutVK*)executeIndirectCommandsDesc.indirectCommandLayout;
+    const IndirectExecutionSetVK* indirectExecutionSetVK = (IndirectExecutionSetVK*)executeIndirectCommandsDesc.indirectExecutionSet;
+    const BufferVK& preprocessBufferVK = *(BufferVK*)executeIndirectCommandsDesc.preprocessBuffer;
+    NRI_VALIDATE_ARGUMENT(&m_Device, executeIndirectCommandsDesc.preprocessBufferOffset < preprocessBufferVK.GetDesc().size, ReturnVoid(), "'preprocessBufferOffset' is out of bounds");
+
+    VkGeneratedCommandsInfoEXT generatedCommandsInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_EXT};
+    generatedCommandsInfo.shaderStages = indirectCommandLayoutVK.GetShaderStages();
+    generatedCommandsInfo.indirectExecutionSet = indirectExecutionSetVK ? (VkIndirectExecutionSetEXT)*indirectExecutionSetVK : VK_NULL_HANDLE;
+    generatedCommandsInfo.indirectCommandsLayout = indirectCommandLayoutVK;
+    generatedCommandsInfo.indirectAddress = GetBufferDeviceAddress(executeIndirectCommandsDesc.argumentBuffer, executeIndirectCommandsDesc.argumentBufferOffset);
+    generatedCommandsInfo.indirectAddressSize = (VkDeviceSize)executeIndirectCommandsDesc.sequenceMaxNum * indirectCommandLayoutVK.GetStride();
+    generatedCommandsInfo.preprocessAddress = GetBufferDeviceAddress(executeIndirectCommandsDesc.preprocessBuffer, executeIndirectCommandsDesc.preprocessBufferOffset);
+    generatedCommandsInfo.preprocessSize = preprocessBufferVK.GetDesc().size - executeIndirectCommandsDesc.preprocessBufferOffset;
+    generatedCommandsInfo.maxSequenceCount = executeIndirectCommandsDesc.sequenceMaxNum;
+    generatedCommandsInfo.sequenceCountAddress = GetBufferDeviceAddress(executeIndirectCommandsDesc.countBuffer, executeIndirectCommandsDesc.countBufferOffset);
+
+    // Without an execution set the currently bound pipeline is used
+    VkGeneratedCommandsPipelineInfoEXT pipelineInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_PIPELINE_INFO_EXT};
+    if (!indirectExecutionSetVK) {
+        NRI_VALIDATE_ARGUMENT(&m_Device, m_Pipeline, ReturnVoid(), "'SetPipeline' has not been called");
+
+        pipelineInfo.pipeline = *m_Pipeline;
+        generatedCommandsInfo.pNext = &pipelineInfo;
+    }
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdExecuteGeneratedCommandsEXT(m_Handle, VK_FALSE, &generatedCommandsInfo);
+
+    // State changed by the layout commands is undefined after execution
+    if (indirectExecutionSetVK)
+        m_Pipeline = nullptr;
+    if (m_IsStateFilteringEnabled)
+        m_StateFilter = {};
+}
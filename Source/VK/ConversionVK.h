@@ -22,6 +22,22 @@ constexpr VkIndexType GetIndexType(IndexType indexType) {
     return g_IndexTypes[(size_t)indexType];
 }
 
+constexpr std::array<VkIndirectCommandsTokenTypeEXT, (size_t)IndirectCommandType::MAX_NUM> g_IndirectCommandsTokenTypes = {
+    VK_INDIRECT_COMMANDS_TOKEN_TYPE_EXECUTION_SET_EXT,   // EXECUTION_SET
+    VK_INDIRECT_COMMANDS_TOKEN_TYPE_PUSH_CONSTANT_EXT,   // ROOT_CONSTANTS
+    VK_INDIRECT_COMMANDS_TOKEN_TYPE_VERTEX_BUFFER_EXT,   // VERTEX_BUFFER
+    VK_INDIRECT_COMMANDS_TOKEN_TYPE_INDEX_BUFFER_EXT,    // INDEX_BUFFER
+    VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_EXT,            // DRAW
+    VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_INDEXED_EXT,    // DRAW_INDEXED
+    VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_MESH_TASKS_EXT, // DRAW_MESH_TASKS
+    VK_INDIRECT_COMMANDS_TOKEN_TYPE_DISPATCH_EXT,        // DISPATCH
+};
+NRI_VALIDATE_ARRAY(g_IndirectCommandsTokenTypes);
+
+constexpr VkIndirectCommandsTokenTypeEXT GetIndirectCommandsTokenType(IndirectCommandType indirectCommandType) {
+    return g_IndirectCommandsTokenTypes[(size_t)indirectCommandType];
+}
+
 constexpr std::array<VkAttachmentLoadOp, (size_t)LoadOp::MAX_NUM> g_LoadOps = {
     VK_ATTACHMENT_LOAD_OP_LOAD,  // LOAD
     VK_ATTACHMENT_LOAD_OP_CLEAR, // CLEAR
@@ -61,6 +61,8 @@ NRI_INLINE Result DescriptorPoolVK::AllocateDescriptorSets(const PipelineLayout&
     ExclusiveScope lock(m_Lock);
 
     const PipelineLayoutVK& pipelineLayoutVK = (PipelineLayoutVK&)pipelineLayout;
+    NRI_VALIDATE_ARGUMENT(&m_Device, setIndex < pipelineLayoutVK.GetBindingInfo().sets.size(), Result::INVALID_ARGUMENT, "'setIndex' is out of bounds");
+
     VkDescriptorSetLayout setLayout = pipelineLayoutVK.GetDescriptorSetLayout(setIndex);
 
     const auto& bindingInfo = pipelineLayoutVK.GetBindingInfo();
@@ -27,6 +27,7 @@ struct IsSupported {
     uint32_t swapChainMaintenance1      : 1;
     uint32_t fifoLatestReady            : 1;
     uint32_t unifiedImageLayoutsVideo   : 1;
+    uint32_t multiDraw                  : 1;
 };
 
 static_assert(sizeof(IsSupported) == sizeof(uint32_t), "4 bytes expected");
@@ -68,12 +69,26 @@ struct DeviceVK final : public DeviceBase {
         return m_IsMemoryZeroInitializationEnabled;
     }
 
+    inline bool IsStateFilteringEnabled() const {
+        return m_IsStateFilteringEnabled;
+    }
+
+    inline bool IsBarrierBatchingEnabled() const {
+        return m_IsBarrierBatchingEnabled;
+    }
+
+    inline uint32_t GetMultiDrawMaxNum() const {
+        return m_MultiDrawMaxNum;
+    }
+
     inline VmaAllocator_T* GetVma() const {
         return m_Vma;
     }
 
     template <typename Implementation, typename Interface, typename... Args>
     inline Result CreateImplementation(Interface*& entity, const Args&... args) {
+        NRI_ALLOCATION_SCOPE(GetAllocationTag<Interface>());
+
         Implementation* impl = Allocate<Implementation>(GetAllocationCallbacks(), *this);
         Result result = impl->Create(args...);
 
@@ -90,7 +105,7 @@ struct DeviceVK final : public DeviceBase {
     ~DeviceVK();
 
     Result Create(const DeviceCreationDesc& desc, const DeviceCreationVKDesc& descVK);
-    void FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info) const;
+    void FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info, VkBufferUsageFlags2CreateInfoKHR& usage2Info) const;
     void FillCreateInfo(const TextureDesc& bufferDesc, VkImageCreateInfo& info) const;
     void FillCreateInfo(const SamplerDesc& samplerDesc, VkSamplerCreateInfo& info, VkSamplerReductionModeCreateInfo& reductionModeInfo, VkSamplerCustomBorderColorCreateInfoEXT& borderColorInfo) const;
     void GetMemoryDesc2(const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const;
@@ -101,6 +116,7 @@ struct DeviceVK final : public DeviceBase {
     bool GetMemoryTypeByIndex(uint32_t index, MemoryTypeInfo& memoryTypeInfo) const;
     void GetAccelerationStructureBuildSizesInfo(const AccelerationStructureDesc& accelerationStructureDesc, VkAccelerationStructureBuildSizesInfoKHR& sizesInfo);
     void GetMicromapBuildSizesInfo(const MicromapDesc& micromapDesc, VkMicromapBuildSizesInfoEXT& sizesInfo);
+    uint64_t GetIndirectCommandsPreprocessBufferSize(const IndirectCommandsPreprocessDesc& indirectCommandsPreprocessDesc) const;
     void SetDebugNameToTrivialObject(VkObjectType objectType, uint64_t handle, const char* name);
 
     //================================================================================================================
@@ -119,6 +135,7 @@ struct DeviceVK final : public DeviceBase {
 
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(DeviceGeneratedCommandsInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
@@ -182,8 +199,11 @@ private:
     VmaAllocator_T* m_Vma = nullptr;
     uint32_t m_NumActiveFamilyIndices = 0;
     uint32_t m_MinorVersion = 0;
+    uint32_t m_MultiDrawMaxNum = 0; // "maxMultiDrawCount"
     bool m_OwnsNativeObjects = true;
     bool m_IsMemoryZeroInitializationEnabled = false;
+    bool m_IsStateFilteringEnabled = false;
+    bool m_IsBarrierBatchingEnabled = false;
 
     Lock m_Lock;
 };
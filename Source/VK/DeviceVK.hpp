@@ -320,11 +320,13 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     APPEND_EXT(true, VK_KHR_UNIFIED_IMAGE_LAYOUTS_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_CUSTOM_BORDER_COLOR_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_IMAGE_SLICED_VIEW_OF_3D_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_MESH_SHADER_EXTENSION_NAME);
+    APPEND_EXT(true, VK_EXT_MULTI_DRAW_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_PRESENT_MODE_FIFO_LATEST_READY_EXTENSION_NAME);
     APPEND_EXT(true, VK_EXT_ROBUSTNESS_2_EXTENSION_NAME); // TODO: use KHR
     APPEND_EXT(true, VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME);
@@ -610,10 +612,12 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     PNEXTCHAIN_APPEND_FEATURES(true, KHR, DynamicRenderingLocalRead, DYNAMIC_RENDERING_LOCAL_READ);
     PNEXTCHAIN_APPEND_FEATURES(true, KHR, UnifiedImageLayouts, UNIFIED_IMAGE_LAYOUTS);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, CustomBorderColor, CUSTOM_BORDER_COLOR);
+    PNEXTCHAIN_APPEND_FEATURES(true, EXT, DeviceGeneratedCommands, DEVICE_GENERATED_COMMANDS);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, FragmentShaderInterlock, FRAGMENT_SHADER_INTERLOCK);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, ImageSlicedViewOf3D, IMAGE_SLICED_VIEW_OF_3D);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, MemoryPriority, MEMORY_PRIORITY);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, MeshShader, MESH_SHADER);
+    PNEXTCHAIN_APPEND_FEATURES(true, EXT, MultiDraw, MULTI_DRAW);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, OpacityMicromap, OPACITY_MICROMAP);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, PresentModeFifoLatestReady, PRESENT_MODE_FIFO_LATEST_READY);
     PNEXTCHAIN_APPEND_FEATURES(true, EXT, Robustness2, ROBUSTNESS_2);
@@ -668,6 +672,7 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     m_IsSupported.imageSlicedView = ImageSlicedViewOf3DFeatures.imageSlicedViewOf3D != 0;
     m_IsSupported.customBorderColor = CustomBorderColorFeatures.customBorderColors != 0 && CustomBorderColorFeatures.customBorderColorWithoutFormat != 0;
     m_IsSupported.robustness = features.features.robustBufferAccess != 0 && features13.robustImageAccess != 0;
+    m_IsSupported.multiDraw = MultiDrawFeatures.multiDraw != 0;
     m_IsSupported.robustness2 = Robustness2Features.robustBufferAccess2 != 0 && Robustness2Features.robustImageAccess2 != 0;
     m_IsSupported.pipelineRobustness = features14.pipelineRobustness;
     m_IsSupported.swapChainMaintenance1 = SwapchainMaintenance1Features.swapchainMaintenance1;
@@ -675,6 +680,8 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     m_IsSupported.unifiedImageLayoutsVideo = UnifiedImageLayoutsFeatures.unifiedImageLayoutsVideo;
 
     m_IsMemoryZeroInitializationEnabled = desc.enableMemoryZeroInitialization && ZeroInitializeDeviceMemoryFeatures.zeroInitializeDeviceMemory;
+    m_IsStateFilteringEnabled = desc.enableRedundantStateFiltering;
+    m_IsBarrierBatchingEnabled = desc.enableBarrierBatching;
 
     // Check hard requirements
     NRI_RETURN_ON_FAILURE(this, ExtendedDynamicStateFeatures.extendedDynamicState != 0, Result::UNSUPPORTED, "'extendedDynamicState' is not supported by the device");
@@ -830,6 +837,7 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         PNEXTCHAIN_APPEND_PROPS(true, KHR, RayTracingPipeline, RAY_TRACING_PIPELINE);
         PNEXTCHAIN_APPEND_PROPS(true, EXT, ConservativeRasterization, CONSERVATIVE_RASTERIZATION);
         PNEXTCHAIN_APPEND_PROPS(true, EXT, MeshShader, MESH_SHADER);
+        PNEXTCHAIN_APPEND_PROPS(true, EXT, MultiDraw, MULTI_DRAW);
         PNEXTCHAIN_APPEND_PROPS(true, EXT, OpacityMicromap, OPACITY_MICROMAP);
         PNEXTCHAIN_APPEND_PROPS(true, EXT, SampleLocations, SAMPLE_LOCATIONS);
 
@@ -1145,6 +1153,10 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         m_Desc.features.swapChain = IsExtensionSupported(VK_KHR_SWAPCHAIN_EXTENSION_NAME, desiredDeviceExts);
         m_Desc.features.meshShader = MeshShaderFeatures.meshShader != 0 && MeshShaderFeatures.taskShader != 0;
         m_Desc.features.lowLatency = m_IsSupported.presentId != 0 && IsExtensionSupported(VK_NV_LOW_LATENCY_2_EXTENSION_NAME, desiredDeviceExts);
+        m_Desc.features.commandBundles = true;
+        m_Desc.features.deviceGeneratedCommands = DeviceGeneratedCommandsFeatures.deviceGeneratedCommands != 0 && m_IsSupported.maintenance5 != 0 && m_IsSupported.deviceAddress != 0;
+
+        m_MultiDrawMaxNum = MultiDrawProps.maxMultiDrawCount;
 
         m_Desc.features.componentSwizzle = true;
         m_Desc.features.independentFrontAndBackStencilReferenceAndMasks = true;
@@ -1232,13 +1244,20 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     return FillFunctionTable(m_iCore);
 }
 
-void DeviceVK::FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info) const {
+void DeviceVK::FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info, VkBufferUsageFlags2CreateInfoKHR& usage2Info) const {
     info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO}; // should be already set
     info.size = bufferDesc.size;
     info.usage = GetBufferUsageFlags(bufferDesc.usage, bufferDesc.structureStride, m_IsSupported.deviceAddress);
     info.sharingMode = m_NumActiveFamilyIndices <= 1 ? VK_SHARING_MODE_EXCLUSIVE : VK_SHARING_MODE_CONCURRENT;
     info.queueFamilyIndexCount = m_NumActiveFamilyIndices;
     info.pQueueFamilyIndices = m_ActiveQueueFamilyIndices.data();
+
+    // "VkBufferUsageFlags2" overrides "usage"
+    usage2Info = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR}; // should be already set
+    if ((bufferDesc.usage & BufferUsageBits::PREPROCESS_BUFFER) && m_Desc.features.deviceGeneratedCommands) {
+        usage2Info.usage = (VkBufferUsageFlags2KHR)info.usage | VK_BUFFER_USAGE_2_PREPROCESS_BUFFER_BIT_EXT;
+        info.pNext = &usage2Info;
+    }
 }
 
 void DeviceVK::FillCreateInfo(const TextureDesc& textureDesc, VkImageCreateInfo& info) const {
@@ -1324,7 +1343,8 @@ void DeviceVK::FillCreateInfo(const SamplerDesc& samplerDesc, VkSamplerCreateInf
 
 void DeviceVK::GetMemoryDesc2(const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const {
     VkBufferCreateInfo createInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    FillCreateInfo(bufferDesc, createInfo);
+    VkBufferUsageFlags2CreateInfoKHR usage2Info = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR};
+    FillCreateInfo(bufferDesc, createInfo, usage2Info);
 
     VkMemoryDedicatedRequirements dedicatedRequirements = {VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS};
 
@@ -1534,6 +1554,28 @@ void DeviceVK::GetMicromapBuildSizesInfo(const MicromapDesc& micromapDesc, VkMic
     vk.GetMicromapBuildSizesEXT(m_Device, VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR, &buildInfo, &sizesInfo);
 }
 
+uint64_t DeviceVK::GetIndirectCommandsPreprocessBufferSize(const IndirectCommandsPreprocessDesc& indirectCommandsPreprocessDesc) const {
+    const IndirectExecutionSetVK* indirectExecutionSetVK = (const IndirectExecutionSetVK*)indirectCommandsPreprocessDesc.indirectExecutionSet;
+
+    VkGeneratedCommandsMemoryRequirementsInfoEXT requirementsInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_EXT};
+    requirementsInfo.indirectExecutionSet = indirectExecutionSetVK ? (VkIndirectExecutionSetEXT)*indirectExecutionSetVK : VK_NULL_HANDLE;
+    requirementsInfo.indirectCommandsLayout = *(const IndirectCommandLayoutVK*)indirectCommandsPreprocessDesc.indirectCommandLayout;
+    requirementsInfo.maxSequenceCount = indirectCommandsPreprocessDesc.sequenceMaxNum;
+
+    VkGeneratedCommandsPipelineInfoEXT pipelineInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_PIPELINE_INFO_EXT};
+    if (!indirectExecutionSetVK && indirectCommandsPreprocessDesc.pipeline) {
+        pipelineInfo.pipeline = *(const PipelineVK*)indirectCommandsPreprocessDesc.pipeline;
+        requirementsInfo.pNext = &pipelineInfo;
+    }
+
+    VkMemoryRequirements2 requirements = {VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+
+    const auto& vk = GetDispatchTable();
+    vk.GetGeneratedCommandsMemoryRequirementsEXT(m_Device, &requirementsInfo, &requirements);
+
+    return requirements.memoryRequirements.size;
+}
+
 Result DeviceVK::CreateInstance(bool enableGraphicsAPIValidation, const Vector<const char*>& desiredInstanceExts) {
     Vector<const char*> layers(GetStdAllocator());
     if (enableGraphicsAPIValidation)
@@ -1850,6 +1892,7 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(CmdFillBuffer);
     GET_DEVICE_CORE_FUNC(CmdBeginRendering);
     GET_DEVICE_CORE_FUNC(CmdEndRendering);
+    GET_DEVICE_CORE_FUNC(CmdExecuteCommands);
     GET_DEVICE_CORE_FUNC(CmdPushDescriptorSet);
     GET_DEVICE_CORE_FUNC(EndCommandBuffer);
 
@@ -1899,10 +1942,25 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
         GET_DEVICE_FUNC(CmdWriteMicromapsPropertiesEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CreateIndirectCommandsLayoutEXT);
+        GET_DEVICE_FUNC(DestroyIndirectCommandsLayoutEXT);
+        GET_DEVICE_FUNC(CreateIndirectExecutionSetEXT);
+        GET_DEVICE_FUNC(DestroyIndirectExecutionSetEXT);
+        GET_DEVICE_FUNC(UpdateIndirectExecutionSetPipelineEXT);
+        GET_DEVICE_FUNC(GetGeneratedCommandsMemoryRequirementsEXT);
+        GET_DEVICE_FUNC(CmdExecuteGeneratedCommandsEXT);
+    }
+
     if (IsExtensionSupported(VK_EXT_SAMPLE_LOCATIONS_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(CmdSetSampleLocationsEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CmdDrawMultiEXT);
+        GET_DEVICE_FUNC(CmdDrawMultiIndexedEXT);
+    }
+
     if (IsExtensionSupported(VK_EXT_MESH_SHADER_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(CmdDrawMeshTasksEXT);
         GET_DEVICE_FUNC(CmdDrawMeshTasksIndirectEXT);
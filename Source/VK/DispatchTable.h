@@ -147,6 +147,7 @@ struct DispatchTable {
     VK_FUNC(CmdFillBuffer);                               // - | +
     VK_FUNC(CmdBeginRendering);                           // - | +
     VK_FUNC(CmdEndRendering);                             // - | + TODO: use "vkCmdEndRendering2KHR" from "VK_KHR_maintenance10"
+    VK_FUNC(CmdExecuteCommands);                          // - | +
     VK_FUNC(CmdPushDescriptorSet);                        // - | +
     VK_FUNC(EndCommandBuffer);                            // - | +
                                                           // VK_KHR_maintenance4
@@ -187,8 +188,19 @@ struct DispatchTable {
     VK_FUNC(CmdBuildMicromapsEXT);                        // - | +
     VK_FUNC(CmdCopyMicromapEXT);                          // - | +
     VK_FUNC(CmdWriteMicromapsPropertiesEXT);              // - | +
+                                                          // VK_EXT_device_generated_commands
+    VK_FUNC(CreateIndirectCommandsLayoutEXT);             // + | +
+    VK_FUNC(DestroyIndirectCommandsLayoutEXT);            // - | +
+    VK_FUNC(CreateIndirectExecutionSetEXT);               // + | +
+    VK_FUNC(DestroyIndirectExecutionSetEXT);              // - | +
+    VK_FUNC(UpdateIndirectExecutionSetPipelineEXT);       // - | +
+    VK_FUNC(GetGeneratedCommandsMemoryRequirementsEXT);   // - | +
+    VK_FUNC(CmdExecuteGeneratedCommandsEXT);              // - | +
                                                           // VK_EXT_sample_locations
     VK_FUNC(CmdSetSampleLocationsEXT);                    // - | +
+                                                          // VK_EXT_multi_draw
+    VK_FUNC(CmdDrawMultiEXT);                             // - | +
+    VK_FUNC(CmdDrawMultiIndexedEXT);                      // - | +
                                                           // VK_EXT_mesh_shader
     VK_FUNC(CmdDrawMeshTasksEXT);                         // - | +
     VK_FUNC(CmdDrawMeshTasksIndirectEXT);                 // - | +
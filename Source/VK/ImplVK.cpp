@@ -13,6 +13,8 @@
 #include "DescriptorSetVK.h"
 #include "DescriptorVK.h"
 #include "FenceVK.h"
+#include "IndirectCommandLayoutVK.h"
+#include "IndirectExecutionSetVK.h"
 #include "MemoryVK.h"
 #include "MicromapVK.h"
 #include "PipelineLayoutVK.h"
@@ -39,6 +41,8 @@ using namespace nri;
 #include "DescriptorVK.hpp"
 #include "DeviceVK.hpp"
 #include "FenceVK.hpp"
+#include "IndirectCommandLayoutVK.hpp"
+#include "IndirectExecutionSetVK.hpp"
 #include "MemoryVK.hpp"
 #include "MicromapVK.hpp"
 #include "PipelineLayoutVK.hpp"
@@ -93,6 +97,18 @@ static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, C
     return ((CommandAllocatorVK&)commandAllocator).CreateCommandBuffer(commandBuffer);
 }
 
+static Result NRI_CALL CreateReusableCommandBuffer(CommandAllocator& commandAllocator, const ReusableCommandBufferDesc& reusableCommandBufferDesc, CommandBuffer*& commandBuffer) {
+    return ((CommandAllocatorVK&)commandAllocator).CreateReusableCommandBuffer(reusableCommandBufferDesc, commandBuffer);
+}
+
+static Result NRI_CALL CreateCommandBuffers(CommandAllocator& commandAllocator, CommandBuffer** commandBuffers, uint32_t commandBufferNum) {
+    return ((CommandAllocatorVK&)commandAllocator).CreateCommandBuffers(commandBuffers, commandBufferNum);
+}
+
+static Result NRI_CALL CreateCommandBundle(CommandAllocator& commandAllocator, const CommandBundleDesc& commandBundleDesc, CommandBuffer*& commandBundle) {
+    return ((CommandAllocatorVK&)commandAllocator).CreateCommandBundle(commandBundleDesc, commandBundle);
+}
+
 static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
     return ((DeviceVK&)device).CreateImplementation<FenceVK>(fence, initialValue);
 }
@@ -106,10 +122,14 @@ static Result NRI_CALL CreatePipelineLayout(Device& device, const PipelineLayout
 }
 
 static Result NRI_CALL CreateGraphicsPipeline(Device& device, const GraphicsPipelineDesc& graphicsPipelineDesc, Pipeline*& pipeline) {
+    NRI_TRACE_SCOPE("CreateGraphicsPipeline");
+
     return ((DeviceVK&)device).CreateImplementation<PipelineVK>(pipeline, graphicsPipelineDesc);
 }
 
 static Result NRI_CALL CreateComputePipeline(Device& device, const ComputePipelineDesc& computePipelineDesc, Pipeline*& pipeline) {
+    NRI_TRACE_SCOPE("CreateComputePipeline");
+
     return ((DeviceVK&)device).CreateImplementation<PipelineVK>(pipeline, computePipelineDesc);
 }
 
@@ -136,7 +156,13 @@ static void NRI_CALL DestroyCommandAllocator(CommandAllocator* commandAllocator)
 }
 
 static void NRI_CALL DestroyCommandBuffer(CommandBuffer* commandBuffer) {
-    Destroy((CommandBufferVK*)commandBuffer);
+    CommandBufferVK* commandBufferVK = (CommandBufferVK*)commandBuffer;
+    CommandAllocatorVK* commandAllocator = commandBufferVK ? commandBufferVK->GetCommandAllocator() : nullptr;
+
+    if (commandAllocator)
+        commandAllocator->ReleaseCommandBuffer(*commandBufferVK);
+    else
+        Destroy(commandBufferVK);
 }
 
 static void NRI_CALL DestroyDescriptorPool(DescriptorPool* descriptorPool) {
@@ -385,6 +411,14 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferVK&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawDescNum) {
+    ((CommandBufferVK&)commandBuffer).DrawMulti(drawDescs, drawDescNum);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawIndexedDescNum) {
+    ((CommandBufferVK&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawIndexedDescNum);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferVK&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -397,6 +431,10 @@ static void NRI_CALL CmdEndRendering(CommandBuffer& commandBuffer) {
     ((CommandBufferVK&)commandBuffer).EndRendering();
 }
 
+static void NRI_CALL CmdExecuteBundle(CommandBuffer& commandBuffer, const CommandBuffer& commandBundle) {
+    ((CommandBufferVK&)commandBuffer).ExecuteBundle(commandBundle);
+}
+
 static void NRI_CALL CmdDispatch(CommandBuffer& commandBuffer, const DispatchDesc& dispatchDesc) {
     ((CommandBufferVK&)commandBuffer).Dispatch(dispatchDesc);
 }
@@ -504,6 +542,8 @@ static uint32_t NRI_CALL GetQuerySize(const QueryPool& queryPool) {
 }
 
 static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& workSubmissionDesc) {
+    NRI_TRACE_SCOPE("QueueSubmit");
+
     return ((QueueVK&)queue).Submit(workSubmissionDesc);
 }
 
@@ -571,7 +611,11 @@ static void* NRI_CALL GetCommandBufferNativeObject(const CommandBuffer* commandB
     if (!commandBuffer)
         return nullptr;
 
-    return (VkCommandBuffer)(*(CommandBufferVK*)commandBuffer);
+    // Native commands can follow, deferred barriers must precede them
+    CommandBufferVK& commandBufferVK = *(CommandBufferVK*)commandBuffer;
+    commandBufferVK.FlushBarriers();
+
+    return (VkCommandBuffer)commandBufferVK;
 }
 
 static uint64_t NRI_CALL GetBufferNativeObject(const Buffer* buffer) {
@@ -629,6 +673,9 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateCommandBundle = ::CreateCommandBundle;
+    table.CreateReusableCommandBuffer = ::CreateReusableCommandBuffer;
+    table.CreateCommandBuffers = ::CreateCommandBuffers;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTextureView = ::CreateTextureView;
@@ -688,9 +735,12 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
+    table.CmdExecuteBundle = ::CmdExecuteBundle;
     table.CmdDispatch = ::CmdDispatch;
     table.CmdDispatchIndirect = ::CmdDispatchIndirect;
     table.CmdCopyBuffer = ::CmdCopyBuffer;
@@ -733,6 +783,54 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  Device generated commands  ]
+
+static Result NRI_CALL CreateIndirectCommandLayout(Device& device, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    return ((DeviceVK&)device).CreateImplementation<IndirectCommandLayoutVK>(indirectCommandLayout, indirectCommandLayoutDesc);
+}
+
+static Result NRI_CALL CreateIndirectExecutionSet(Device& device, const IndirectExecutionSetDesc& indirectExecutionSetDesc, IndirectExecutionSet*& indirectExecutionSet) {
+    return ((DeviceVK&)device).CreateImplementation<IndirectExecutionSetVK>(indirectExecutionSet, indirectExecutionSetDesc);
+}
+
+static uint64_t NRI_CALL GetIndirectCommandsPreprocessBufferSize(const Device& device, const IndirectCommandsPreprocessDesc& indirectCommandsPreprocessDesc) {
+    return ((DeviceVK&)device).GetIndirectCommandsPreprocessBufferSize(indirectCommandsPreprocessDesc);
+}
+
+static void NRI_CALL UpdateIndirectExecutionSet(IndirectExecutionSet& indirectExecutionSet, uint32_t baseIndex, const Pipeline* const* pipelines, uint32_t pipelineNum) {
+    ((IndirectExecutionSetVK&)indirectExecutionSet).Update(baseIndex, pipelines, pipelineNum);
+}
+
+static void NRI_CALL DestroyIndirectCommandLayout(IndirectCommandLayout* indirectCommandLayout) {
+    Destroy((IndirectCommandLayoutVK*)indirectCommandLayout);
+}
+
+static void NRI_CALL DestroyIndirectExecutionSet(IndirectExecutionSet* indirectExecutionSet) {
+    Destroy((IndirectExecutionSetVK*)indirectExecutionSet);
+}
+
+static void NRI_CALL CmdExecuteIndirectCommands(CommandBuffer& commandBuffer, const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    ((CommandBufferVK&)commandBuffer).ExecuteIndirectCommands(executeIndirectCommandsDesc);
+}
+
+Result DeviceVK::FillFunctionTable(DeviceGeneratedCommandsInterface& table) const {
+    if (!m_Desc.features.deviceGeneratedCommands)
+        return Result::UNSUPPORTED;
+
+    table.CreateIndirectCommandLayout = ::CreateIndirectCommandLayout;
+    table.CreateIndirectExecutionSet = ::CreateIndirectExecutionSet;
+    table.GetIndirectCommandsPreprocessBufferSize = ::GetIndirectCommandsPreprocessBufferSize;
+    table.UpdateIndirectExecutionSet = ::UpdateIndirectExecutionSet;
+    table.DestroyIndirectCommandLayout = ::DestroyIndirectCommandLayout;
+    table.DestroyIndirectExecutionSet = ::DestroyIndirectExecutionSet;
+    table.CmdExecuteIndirectCommands = ::CmdExecuteIndirectCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -762,11 +860,48 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation
     return ((DeviceVK&)device).QueryVideoMemoryInfo(memoryLocation, videoMemoryInfo);
 }
 
+static Result NRI_CALL CreateCommandRecorder(Queue& queue, const CommandRecorderDesc& commandRecorderDesc, CommandRecorder*& commandRecorder) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::COMMAND);
+
+    DeviceVK& deviceVK = ((QueueVK&)queue).GetDevice();
+    CommandRecorderImpl* impl = Allocate<CommandRecorderImpl>(deviceVK.GetAllocationCallbacks(), (Device&)deviceVK, deviceVK.GetCoreInterface(), queue);
+    Result result = impl ? impl->Create(commandRecorderDesc) : Result::OUT_OF_MEMORY;
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        commandRecorder = nullptr;
+    } else
+        commandRecorder = (CommandRecorder*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyCommandRecorder(CommandRecorder* commandRecorder) {
+    Destroy((CommandRecorderImpl*)commandRecorder);
+}
+
+static void NRI_CALL BeginCommandRecorderFrame(CommandRecorder& commandRecorder) {
+    ((CommandRecorderImpl&)commandRecorder).BeginFrame();
+}
+
+static Result NRI_CALL AcquireCommandBuffer(CommandRecorder& commandRecorder, uint32_t threadIndex, uint32_t sortKey, CommandBuffer*& commandBuffer) {
+    return ((CommandRecorderImpl&)commandRecorder).AcquireCommandBuffer(threadIndex, sortKey, commandBuffer);
+}
+
+static Result NRI_CALL SubmitCommandRecorderFrame(CommandRecorder& commandRecorder, const QueueSubmitDesc& queueSubmitDesc) {
+    return ((CommandRecorderImpl&)commandRecorder).Submit(queueSubmitDesc);
+}
+
 Result DeviceVK::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.CreateCommandRecorder = ::CreateCommandRecorder;
+    table.DestroyCommandRecorder = ::DestroyCommandRecorder;
+    table.BeginCommandRecorderFrame = ::BeginCommandRecorderFrame;
+    table.AcquireCommandBuffer = ::AcquireCommandBuffer;
+    table.SubmitCommandRecorderFrame = ::SubmitCommandRecorderFrame;
 
     return Result::SUCCESS;
 }
@@ -779,6 +914,8 @@ Result DeviceVK::FillFunctionTable(HelperInterface& table) const {
 #if NRI_ENABLE_IMGUI_EXTENSION
 
 static Result NRI_CALL CreateImgui(Device& device, const ImguiDesc& imguiDesc, Imgui*& imgui) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::IMGUI);
+
     DeviceVK& deviceVK = (DeviceVK&)device;
     ImguiImpl* impl = Allocate<ImguiImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
     Result result = impl->Create(imguiDesc);
@@ -881,6 +1018,8 @@ Result DeviceVK::FillFunctionTable(MeshShaderInterface& table) const {
 #pragma region[  RayTracing  ]
 
 static Result NRI_CALL CreateRayTracingPipeline(Device& device, const RayTracingPipelineDesc& pipelineDesc, Pipeline*& pipeline) {
+    NRI_TRACE_SCOPE("CreateRayTracingPipeline");
+
     return ((DeviceVK&)device).CreateImplementation<PipelineVK>(pipeline, pipelineDesc);
 }
 
@@ -1113,6 +1252,8 @@ Result DeviceVK::FillFunctionTable(RayTracingInterface& table) const {
 #pragma region[  Streamer  ]
 
 static Result NRI_CALL CreateStreamer(Device& device, const StreamerDesc& streamerDesc, Streamer*& streamer) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::STREAMER);
+
     DeviceVK& deviceVK = (DeviceVK&)device;
     StreamerImpl* impl = Allocate<StreamerImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
     Result result = impl->Create(streamerDesc);
@@ -1221,6 +1362,8 @@ Result DeviceVK::FillFunctionTable(SwapChainInterface& table) const {
 #pragma region[  Upscaler  ]
 
 static Result NRI_CALL CreateUpscaler(Device& device, const UpscalerDesc& upscalerDesc, Upscaler*& upscaler) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::UPSCALER);
+
     DeviceVK& deviceVK = (DeviceVK&)device;
     UpscalerImpl* impl = Allocate<UpscalerImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
     Result result = impl->Create(upscalerDesc);
@@ -1315,6 +1458,10 @@ static uint32_t NRI_CALL GetQueueFamilyIndexVK(const Queue& queue) {
     return ((QueueVK&)queue).GetFamilyIndex();
 }
 
+static uint32_t NRI_CALL GetFilteredCommandNumVK(const CommandBuffer& commandBuffer) {
+    return ((CommandBufferVK&)commandBuffer).GetFilteredCommandNum();
+}
+
 static VKHandle NRI_CALL GetPhysicalDeviceVK(const Device& device) {
     return (VkPhysicalDevice)((DeviceVK&)device);
 }
@@ -1343,6 +1490,7 @@ Result DeviceVK::FillFunctionTable(WrapperVKInterface& table) const {
     table.CreateFenceVK = ::CreateFenceVK;
     table.CreateAccelerationStructureVK = ::CreateAccelerationStructureVK;
     table.GetQueueFamilyIndexVK = ::GetQueueFamilyIndexVK;
+    table.GetFilteredCommandNumVK = ::GetFilteredCommandNumVK;
     table.GetPhysicalDeviceVK = ::GetPhysicalDeviceVK;
     table.GetInstanceVK = ::GetInstanceVK;
     table.GetDeviceProcAddrVK = ::GetDeviceProcAddrVK;
@@ -0,0 +1,45 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct IndirectCommandLayoutVK final : public DebugNameBase {
+    inline IndirectCommandLayoutVK(DeviceVK& device)
+        : m_Device(device) {
+    }
+
+    inline operator VkIndirectCommandsLayoutEXT() const {
+        return m_Handle;
+    }
+
+    inline DeviceVK& GetDevice() const {
+        return m_Device;
+    }
+
+    inline VkShaderStageFlags GetShaderStages() const {
+        return m_ShaderStages;
+    }
+
+    inline uint32_t GetStride() const {
+        return m_Stride;
+    }
+
+    ~IndirectCommandLayoutVK();
+
+    Result Create(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) NRI_DEBUG_NAME_OVERRIDE;
+
+private:
+    DeviceVK& m_Device;
+    VkIndirectCommandsLayoutEXT m_Handle = VK_NULL_HANDLE;
+    VkShaderStageFlags m_ShaderStages = 0;
+    uint32_t m_Stride = 0;
+};
+
+} // namespace nri
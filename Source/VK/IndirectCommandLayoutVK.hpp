@@ -0,0 +1,81 @@
+// © 2021 NVIDIA Corporation
+
+IndirectCommandLayoutVK::~IndirectCommandLayoutVK() {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.DestroyIndirectCommandsLayoutEXT(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+}
+
+Result IndirectCommandLayoutVK::Create(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc) {
+    static_assert((uint32_t)IndexType::UINT16 == VK_INDEX_TYPE_UINT16, "Type mismatch");
+    static_assert((uint32_t)IndexType::UINT32 == VK_INDEX_TYPE_UINT32, "Type mismatch");
+    static_assert(sizeof(BindVertexBufferIndirectDesc) == sizeof(VkBindVertexBufferIndirectCommandEXT), "Type mismatch");
+    static_assert(sizeof(BindIndexBufferIndirectDesc) == sizeof(VkBindIndexBufferIndirectCommandEXT), "Type mismatch");
+
+    if (!m_Device.GetDesc().features.deviceGeneratedCommands)
+        return Result::UNSUPPORTED;
+
+    m_ShaderStages = GetShaderStageFlags(indirectCommandLayoutDesc.shaderStages);
+    m_Stride = indirectCommandLayoutDesc.stride;
+
+    const PipelineLayoutVK* pipelineLayoutVK = (const PipelineLayoutVK*)indirectCommandLayoutDesc.pipelineLayout;
+
+    // Token payloads are referenced by pointers
+    Scratch<VkIndirectCommandsLayoutTokenEXT> tokens = NRI_ALLOCATE_SCRATCH(m_Device, VkIndirectCommandsLayoutTokenEXT, indirectCommandLayoutDesc.commandNum);
+    Scratch<VkIndirectCommandsPushConstantTokenEXT> pushConstantTokens = NRI_ALLOCATE_SCRATCH(m_Device, VkIndirectCommandsPushConstantTokenEXT, indirectCommandLayoutDesc.commandNum);
+    Scratch<VkIndirectCommandsVertexBufferTokenEXT> vertexBufferTokens = NRI_ALLOCATE_SCRATCH(m_Device, VkIndirectCommandsVertexBufferTokenEXT, indirectCommandLayoutDesc.commandNum);
+
+    VkIndirectCommandsExecutionSetTokenEXT executionSetToken = {};
+    executionSetToken.type = VK_INDIRECT_EXECUTION_SET_INFO_TYPE_PIPELINES_EXT;
+    executionSetToken.shaderStages = m_ShaderStages;
+
+    VkIndirectCommandsIndexBufferTokenEXT indexBufferToken = {};
+    indexBufferToken.mode = VK_INDIRECT_COMMANDS_INPUT_MODE_VULKAN_INDEX_BUFFER_EXT;
+
+    for (uint32_t i = 0; i < indirectCommandLayoutDesc.commandNum; i++) {
+        const IndirectCommandDesc& in = indirectCommandLayoutDesc.commands[i];
+
+        VkIndirectCommandsLayoutTokenEXT& out = tokens[i];
+        out = {VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_EXT};
+        out.type = GetIndirectCommandsTokenType(in.type);
+        out.offset = in.offset;
+
+        if (in.type == IndirectCommandType::EXECUTION_SET)
+            out.data.pExecutionSet = &executionSetToken;
+        else if (in.type == IndirectCommandType::ROOT_CONSTANTS) {
+            const PushConstantBindingDesc& pushConstantBindingDesc = pipelineLayoutVK->GetBindingInfo().pushConstants[in.rootConstantIndex];
+
+            VkIndirectCommandsPushConstantTokenEXT& pushConstantToken = pushConstantTokens[i];
+            pushConstantToken = {};
+            pushConstantToken.updateRange.stageFlags = pushConstantBindingDesc.stages;
+            pushConstantToken.updateRange.offset = pushConstantBindingDesc.offset;
+            pushConstantToken.updateRange.size = pushConstantBindingDesc.size;
+
+            out.data.pPushConstant = &pushConstantToken;
+        } else if (in.type == IndirectCommandType::VERTEX_BUFFER) {
+            VkIndirectCommandsVertexBufferTokenEXT& vertexBufferToken = vertexBufferTokens[i];
+            vertexBufferToken = {};
+            vertexBufferToken.vertexBindingUnit = in.vertexBufferSlot;
+
+            out.data.pVertexBuffer = &vertexBufferToken;
+        } else if (in.type == IndirectCommandType::INDEX_BUFFER)
+            out.data.pIndexBuffer = &indexBufferToken;
+    }
+
+    VkIndirectCommandsLayoutCreateInfoEXT createInfo = {VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_EXT};
+    createInfo.flags = indirectCommandLayoutDesc.unorderedSequences ? VK_INDIRECT_COMMANDS_LAYOUT_USAGE_UNORDERED_SEQUENCES_BIT_EXT : 0;
+    createInfo.shaderStages = m_ShaderStages;
+    createInfo.indirectStride = indirectCommandLayoutDesc.stride;
+    createInfo.pipelineLayout = pipelineLayoutVK ? (VkPipelineLayout)*pipelineLayoutVK : VK_NULL_HANDLE;
+    createInfo.tokenCount = indirectCommandLayoutDesc.commandNum;
+    createInfo.pTokens = tokens;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateIndirectCommandsLayoutEXT(m_Device, &createInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateIndirectCommandsLayoutEXT");
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE void IndirectCommandLayoutVK::SetDebugName(const char* name) {
+    m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_EXT, (uint64_t)m_Handle, name);
+}
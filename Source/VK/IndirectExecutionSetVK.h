@@ -0,0 +1,41 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct IndirectExecutionSetVK final : public DebugNameBase {
+    inline IndirectExecutionSetVK(DeviceVK& device)
+        : m_Device(device) {
+    }
+
+    inline operator VkIndirectExecutionSetEXT() const {
+        return m_Handle;
+    }
+
+    inline DeviceVK& GetDevice() const {
+        return m_Device;
+    }
+
+    ~IndirectExecutionSetVK();
+
+    Result Create(const IndirectExecutionSetDesc& indirectExecutionSetDesc);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) NRI_DEBUG_NAME_OVERRIDE;
+
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    void Update(uint32_t baseIndex, const Pipeline* const* pipelines, uint32_t pipelineNum);
+
+private:
+    DeviceVK& m_Device;
+    VkIndirectExecutionSetEXT m_Handle = VK_NULL_HANDLE;
+};
+
+} // namespace nri
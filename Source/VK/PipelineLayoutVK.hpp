@@ -83,7 +83,7 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
         offset += pushConstantDesc.size;
 
         // Binding info
-        m_BindingInfo.pushConstants.push_back({range.stageFlags, range.offset});
+        m_BindingInfo.pushConstants.push_back({range.stageFlags, range.offset, range.size});
     }
 
     // Root descriptors & samplers
@@ -25,6 +25,10 @@ struct PipelineVK final : public DebugNameBase {
         return m_DepthBias;
     }
 
+    inline bool IsVertexStrideDynamic() const {
+        return m_IsVertexStrideDynamic;
+    }
+
     ~PipelineVK();
 
     Result Create(const GraphicsPipelineDesc& graphicsPipelineDesc);
@@ -52,6 +56,7 @@ private:
     VkPipeline m_Handle = VK_NULL_HANDLE;
     VkPipelineBindPoint m_BindPoint = VK_PIPELINE_BIND_POINT_MAX_ENUM;
     DepthBiasDesc m_DepthBias = {};
+    bool m_IsVertexStrideDynamic = false;
     bool m_OwnsNativeObjects = true;
 };
 
@@ -237,8 +237,10 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
     std::array<VkDynamicState, 16> dynamicStates;
     dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT;
     dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT;
-    if (vi)
+    if (vi) {
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE;
+        m_IsVertexStrideDynamic = true;
+    }
     if (rasterizationState.depthBiasEnable)
         dynamicStates[dynamicStateNum++] = VK_DYNAMIC_STATE_DEPTH_BIAS;
     if (depthStencilState.depthBoundsTestEnable)
@@ -289,6 +291,13 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
     if (FillPipelineRobustness(m_Device, graphicsPipelineDesc.robustness, robustnessInfo))
         pipelineRenderingCreateInfo.pNext = &robustnessInfo;
 
+    VkPipelineCreateFlags2CreateInfoKHR flags2Info = {VK_STRUCTURE_TYPE_PIPELINE_CREATE_FLAGS_2_CREATE_INFO_KHR}; // overrides "flags"
+    if (graphicsPipelineDesc.allowIndirectBinding && m_Device.GetDesc().features.deviceGeneratedCommands) {
+        flags2Info.pNext = info.pNext;
+        flags2Info.flags = (VkPipelineCreateFlags2KHR)flags | VK_PIPELINE_CREATE_2_INDIRECT_BINDABLE_BIT_EXT;
+        info.pNext = &flags2Info;
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateGraphicsPipelines");
@@ -341,6 +350,13 @@ Result PipelineVK::Create(const ComputePipelineDesc& computePipelineDesc) {
     if (FillPipelineRobustness(m_Device, computePipelineDesc.robustness, robustnessInfo))
         info.pNext = &robustnessInfo;
 
+    VkPipelineCreateFlags2CreateInfoKHR flags2Info = {VK_STRUCTURE_TYPE_PIPELINE_CREATE_FLAGS_2_CREATE_INFO_KHR}; // overrides "flags"
+    if (computePipelineDesc.allowIndirectBinding && m_Device.GetDesc().features.deviceGeneratedCommands) {
+        flags2Info.pNext = info.pNext;
+        flags2Info.flags = VK_PIPELINE_CREATE_2_INDIRECT_BINDABLE_BIT_EXT;
+        info.pNext = &flags2Info;
+    }
+
     vkResult = vk.CreateComputePipelines(m_Device, VK_NULL_HANDLE, 1, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateComputePipelines");
 
@@ -4,11 +4,15 @@
 
 namespace nri {
 
+struct FenceVK;
+
 struct QueueVK final : public DebugNameBase {
     inline QueueVK(DeviceVK& device)
         : m_Device(device) {
     }
 
+    ~QueueVK();
+
     inline operator VkQueue() const {
         return m_Handle;
     }
@@ -50,6 +54,8 @@ struct QueueVK final : public DebugNameBase {
 private:
     DeviceVK& m_Device;
     VkQueue m_Handle = VK_NULL_HANDLE;
+    FenceVK* m_TrackingFence = nullptr; // signaled by submissions with tracked reusable command buffers (created on demand)
+    uint64_t m_TrackingValue = 0;
     uint32_t m_FamilyIndex = INVALID_FAMILY_INDEX;
     QueueType m_Type = QueueType(-1);
     Lock m_Lock;
@@ -1,5 +1,10 @@
 // © 2021 NVIDIA Corporation
 
+QueueVK::~QueueVK() {
+    if (m_TrackingFence)
+        Destroy(m_Device.GetAllocationCallbacks(), m_TrackingFence);
+}
+
 Result QueueVK::Create(QueueType type, uint32_t familyIndex, VkQueue handle) {
     m_Type = type;
     m_FamilyIndex = familyIndex;
@@ -45,6 +50,16 @@ NRI_INLINE void QueueVK::Annotation(const char* name, uint32_t bgra) {
 }
 
 NRI_INLINE Result QueueVK::Submit(const QueueSubmitDesc& queueSubmitDesc) {
+    // A tracked command buffer can still be pending, wait for it without blocking other submissions to this queue
+    bool isTracked = false;
+    for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+        CommandBufferVK& commandBuffer = *(CommandBufferVK*)queueSubmitDesc.commandBuffers[i];
+        if (commandBuffer.IsSubmissionTracked()) {
+            commandBuffer.WaitForPendingSubmission();
+            isTracked = true;
+        }
+    }
+
     ExclusiveScope lock(m_Lock);
 
     Scratch<VkSemaphoreSubmitInfo> waitSemaphores = NRI_ALLOCATE_SCRATCH(m_Device, VkSemaphoreSubmitInfo, queueSubmitDesc.waitFenceNum);
@@ -57,11 +72,23 @@ NRI_INLINE Result QueueVK::Submit(const QueueSubmitDesc& queueSubmitDesc) {
 
     Scratch<VkCommandBufferSubmitInfo> commandBuffers = NRI_ALLOCATE_SCRATCH(m_Device, VkCommandBufferSubmitInfo, queueSubmitDesc.commandBufferNum);
     for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+        const CommandBufferVK& commandBuffer = *(CommandBufferVK*)queueSubmitDesc.commandBuffers[i];
+
         commandBuffers[i] = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO};
-        commandBuffers[i].commandBuffer = *(CommandBufferVK*)queueSubmitDesc.commandBuffers[i];
+        commandBuffers[i].commandBuffer = commandBuffer;
+    }
+
+    // Tracked command buffers need an extra signal (only "ALL_COMMANDS" guarantees completion)
+    if (isTracked && !m_TrackingFence) {
+        Fence* fence = nullptr;
+        Result result = m_Device.CreateImplementation<FenceVK>(fence, 0);
+        NRI_RETURN_ON_FAILURE(&m_Device, result == Result::SUCCESS, result, "Can't create a tracking fence");
+
+        m_TrackingFence = (FenceVK*)fence;
     }
 
-    Scratch<VkSemaphoreSubmitInfo> signalSemaphores = NRI_ALLOCATE_SCRATCH(m_Device, VkSemaphoreSubmitInfo, queueSubmitDesc.signalFenceNum);
+    uint32_t signalSemaphoreNum = queueSubmitDesc.signalFenceNum;
+    Scratch<VkSemaphoreSubmitInfo> signalSemaphores = NRI_ALLOCATE_SCRATCH(m_Device, VkSemaphoreSubmitInfo, signalSemaphoreNum + 1);
     for (uint32_t i = 0; i < queueSubmitDesc.signalFenceNum; i++) {
         signalSemaphores[i] = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
         signalSemaphores[i].semaphore = *(FenceVK*)queueSubmitDesc.signalFences[i].fence;
@@ -69,12 +96,20 @@ NRI_INLINE Result QueueVK::Submit(const QueueSubmitDesc& queueSubmitDesc) {
         signalSemaphores[i].stageMask = GetPipelineStageFlags(queueSubmitDesc.signalFences[i].stages);
     }
 
+    if (isTracked) {
+        VkSemaphoreSubmitInfo& signalSemaphore = signalSemaphores[signalSemaphoreNum++];
+        signalSemaphore = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
+        signalSemaphore.semaphore = *m_TrackingFence;
+        signalSemaphore.value = m_TrackingValue + 1;
+        signalSemaphore.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    }
+
     VkSubmitInfo2 submitInfo = {VK_STRUCTURE_TYPE_SUBMIT_INFO_2};
     submitInfo.waitSemaphoreInfoCount = queueSubmitDesc.waitFenceNum;
     submitInfo.pWaitSemaphoreInfos = waitSemaphores;
     submitInfo.commandBufferInfoCount = queueSubmitDesc.commandBufferNum;
     submitInfo.pCommandBufferInfos = commandBuffers;
-    submitInfo.signalSemaphoreInfoCount = queueSubmitDesc.signalFenceNum;
+    submitInfo.signalSemaphoreInfoCount = signalSemaphoreNum;
     submitInfo.pSignalSemaphoreInfos = signalSemaphores;
 
     VkLatencySubmissionPresentIdNV presentId = {VK_STRUCTURE_TYPE_LATENCY_SUBMISSION_PRESENT_ID_NV};
@@ -87,6 +122,16 @@ NRI_INLINE Result QueueVK::Submit(const QueueSubmitDesc& queueSubmitDesc) {
     VkResult vkResult = vk.QueueSubmit2(m_Handle, 1, &submitInfo, VK_NULL_HANDLE);
     NRI_RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "QueueSubmit2");
 
+    if (isTracked) {
+        m_TrackingValue++;
+
+        for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+            CommandBufferVK& commandBuffer = *(CommandBufferVK*)queueSubmitDesc.commandBuffers[i];
+            if (commandBuffer.IsSubmissionTracked())
+                commandBuffer.SetPendingSubmission(*m_TrackingFence, m_TrackingValue);
+        }
+    }
+
     return Result::SUCCESS;
 }
 
@@ -12,6 +12,9 @@ TextureVK::~TextureVK() {
 }
 
 Result TextureVK::Create(const TextureDesc& textureDesc) {
+    NRI_VALIDATE_ARGUMENT(&m_Device, textureDesc.width != 0, Result::INVALID_ARGUMENT, "'width' is 0");
+    NRI_VALIDATE_ARGUMENT(&m_Device, textureDesc.format > Format::UNKNOWN && textureDesc.format < Format::MAX_NUM, Result::INVALID_ARGUMENT, "'format' is invalid");
+
     m_Desc = FixTextureDesc(textureDesc);
 
     VkImageCreateInfo info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
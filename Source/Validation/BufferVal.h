@@ -5,10 +5,19 @@
 namespace nri {
 
 struct MemoryVal;
+struct FenceVal;
+
+struct InFlightRangeVal {
+    uint64_t fenceUid; // a destroyed fence means that the work has been waited for
+    uint64_t fenceValue;
+    uint64_t rangeMin;
+    uint64_t rangeMax;
+};
 
 struct BufferVal final : public ObjectVal {
     BufferVal(DeviceVal& device, Buffer* buffer, bool isBoundToMemory)
         : ObjectVal(device, buffer)
+        , m_InFlightRanges(device.GetStdAllocator())
         , m_IsBoundToMemory(isBoundToMemory) {
         m_Desc = GetCoreInterfaceImpl().GetBufferDesc(*buffer);
     }
@@ -36,6 +45,17 @@ struct BufferVal final : public ObjectVal {
         m_IsBoundToMemory = true;
     }
 
+    inline void SetMemoryLocation(MemoryLocation memoryLocation) {
+        m_MemoryLocation = memoryLocation;
+    }
+
+    inline bool IsHostVisible() const {
+        return m_MemoryLocation == MemoryLocation::HOST_UPLOAD || m_MemoryLocation == MemoryLocation::HOST_READBACK || m_MemoryLocation == MemoryLocation::DEVICE_UPLOAD;
+    }
+
+    // Called on "QueueSubmit" for all ranges used by submitted command buffers (under the device lock)
+    void SetInFlight(FenceVal* fence, uint64_t fenceValue, uint64_t offset, uint64_t size);
+
     //================================================================================================================
     // NRI
     //================================================================================================================
@@ -44,9 +64,14 @@ struct BufferVal final : public ObjectVal {
     void Unmap();
     uint64_t GetDeviceAddress() const;
 
+private:
+    void RemoveCompletedInFlightRanges();
+
 private:
     BufferDesc m_Desc = {}; // .natvis
     MemoryVal* m_Memory = nullptr;
+    Vector<InFlightRangeVal> m_InFlightRanges; // one per not yet completed submission (per-frame ring buffers have several)
+    MemoryLocation m_MemoryLocation = MemoryLocation::MAX_NUM; // unknown or wrapped
     bool m_IsBoundToMemory = false;
     bool m_IsMapped = false;
 };
@@ -13,6 +13,24 @@ NRI_INLINE void* BufferVal::Map(uint64_t offset, uint64_t size) {
     NRI_RETURN_ON_FAILURE(&m_Device, !m_IsMapped, nullptr, "the buffer is already mapped (D3D11 doesn't support nested calls)");
     NRI_RETURN_ON_FAILURE(&m_Device, offset + size <= m_Desc.size, nullptr, "out of bounds");
 
+    { // Host access to a range, which can still be accessed by the GPU, is a race
+        ExclusiveScope lock(m_Device.GetLock());
+
+        RemoveCompletedInFlightRanges();
+
+        for (const InFlightRangeVal& inFlightRange : m_InFlightRanges) {
+            uint64_t overlapMin = std::max(offset, inFlightRange.rangeMin);
+            uint64_t overlapMax = std::min(offset + size, inFlightRange.rangeMax);
+
+            if (overlapMin < overlapMax) {
+                const FenceVal* fence = m_Device.FindFence(inFlightRange.fenceUid);
+                NRI_REPORT_WARNING(&m_Device, "the buffer is still in use by the GPU: mapped range [%" PRIu64 "; %" PRIu64 ") overlaps with in-flight range [%" PRIu64 "; %" PRIu64 ") (fence '%s' has value %" PRIu64 ", but %" PRIu64 " is expected)",
+                    offset, offset + size, overlapMin, overlapMax, fence->GetDebugName(), fence->GetFenceValue(), inFlightRange.fenceValue);
+                break;
+            }
+        }
+    }
+
     m_IsMapped = true;
 
     return GetCoreInterfaceImpl().MapBuffer(*GetImpl(), offset, size);
@@ -26,6 +44,38 @@ NRI_INLINE void BufferVal::Unmap() {
     GetCoreInterfaceImpl().UnmapBuffer(*GetImpl());
 }
 
+NRI_INLINE void BufferVal::RemoveCompletedInFlightRanges() {
+    size_t n = 0;
+    for (const InFlightRangeVal& inFlightRange : m_InFlightRanges) {
+        const FenceVal* fence = m_Device.FindFence(inFlightRange.fenceUid);
+        if (fence && fence->GetFenceValue() < inFlightRange.fenceValue)
+            m_InFlightRanges[n++] = inFlightRange;
+    }
+
+    m_InFlightRanges.resize(n);
+}
+
+NRI_INLINE void BufferVal::SetInFlight(FenceVal* fence, uint64_t fenceValue, uint64_t offset, uint64_t size) {
+    if (size == WHOLE_SIZE || offset + size > m_Desc.size)
+        size = m_Desc.size - std::min(offset, m_Desc.size);
+
+    // Ranges of the same submission are merged
+    uint64_t fenceUid = fence->GetUid();
+    if (!m_InFlightRanges.empty()) {
+        InFlightRangeVal& last = m_InFlightRanges.back();
+        if (last.fenceUid == fenceUid && last.fenceValue == fenceValue) {
+            last.rangeMin = std::min(last.rangeMin, offset);
+            last.rangeMax = std::max(last.rangeMax, offset + size);
+            return;
+        }
+    }
+
+    // A new submission: a good time to forget completed ones
+    RemoveCompletedInFlightRanges();
+
+    m_InFlightRanges.push_back({fenceUid, fenceValue, offset, offset + size});
+}
+
 NRI_INLINE uint64_t BufferVal::GetDeviceAddress() const {
     return GetCoreInterfaceImpl().GetBufferDeviceAddress(*GetImpl());
 }
@@ -18,6 +18,9 @@ struct CommandAllocatorVal final : public ObjectVal {
     //================================================================================================================
 
     Result CreateCommandBuffer(CommandBuffer*& commandBuffer);
+    Result CreateCommandBuffers(CommandBuffer** commandBuffers, uint32_t commandBufferNum);
+    Result CreateReusableCommandBuffer(const ReusableCommandBufferDesc& reusableCommandBufferDesc, CommandBuffer*& commandBuffer);
+    Result CreateCommandBundle(const CommandBundleDesc& commandBundleDesc, CommandBuffer*& commandBundle);
     void Reset();
 };
 
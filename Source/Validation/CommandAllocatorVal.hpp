@@ -11,6 +11,60 @@ NRI_INLINE Result CommandAllocatorVal::CreateCommandBuffer(CommandBuffer*& comma
     return result;
 }
 
+NRI_INLINE Result CommandAllocatorVal::CreateCommandBuffers(CommandBuffer** commandBuffers, uint32_t commandBufferNum) {
+    NRI_RETURN_ON_FAILURE(&m_Device, commandBuffers, Result::INVALID_ARGUMENT, "'commandBuffers' is NULL");
+    NRI_RETURN_ON_FAILURE(&m_Device, commandBufferNum != 0, Result::INVALID_ARGUMENT, "'commandBufferNum' is 0");
+
+    const Result result = GetCoreInterfaceImpl().CreateCommandBuffers(*GetImpl(), commandBuffers, commandBufferNum);
+    if (result != Result::SUCCESS) {
+        for (uint32_t i = 0; i < commandBufferNum; i++)
+            commandBuffers[i] = nullptr;
+
+        return result;
+    }
+
+    for (uint32_t i = 0; i < commandBufferNum; i++)
+        commandBuffers[i] = (CommandBuffer*)Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBuffers[i], false);
+
+    return result;
+}
+
+NRI_INLINE Result CommandAllocatorVal::CreateReusableCommandBuffer(const ReusableCommandBufferDesc& reusableCommandBufferDesc, CommandBuffer*& commandBuffer) {
+    CommandBuffer* commandBufferImpl;
+    const Result result = GetCoreInterfaceImpl().CreateReusableCommandBuffer(*GetImpl(), reusableCommandBufferDesc, commandBufferImpl);
+
+    commandBuffer = nullptr;
+    if (result == Result::SUCCESS) {
+        CommandBufferVal* commandBufferVal = Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBufferImpl, false);
+        commandBufferVal->SetReusable();
+
+        commandBuffer = (CommandBuffer*)commandBufferVal;
+    }
+
+    return result;
+}
+
+NRI_INLINE Result CommandAllocatorVal::CreateCommandBundle(const CommandBundleDesc& commandBundleDesc, CommandBuffer*& commandBundle) {
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+
+    NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.commandBundles, Result::UNSUPPORTED, "'features.commandBundles' is false");
+    NRI_RETURN_ON_FAILURE(&m_Device, commandBundleDesc.colorFormatNum <= deviceDesc.shaderStage.fragment.attachmentMaxNum, Result::INVALID_ARGUMENT, "'colorFormatNum' is out of bounds");
+    NRI_RETURN_ON_FAILURE(&m_Device, !commandBundleDesc.colorFormatNum || commandBundleDesc.colorFormats, Result::INVALID_ARGUMENT, "'colorFormats' is NULL");
+
+    CommandBuffer* commandBundleImpl;
+    const Result result = GetCoreInterfaceImpl().CreateCommandBundle(*GetImpl(), commandBundleDesc, commandBundleImpl);
+
+    commandBundle = nullptr;
+    if (result == Result::SUCCESS) {
+        CommandBufferVal* commandBundleVal = Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBundleImpl, false);
+        commandBundleVal->SetBundleDesc(commandBundleDesc);
+
+        commandBundle = (CommandBuffer*)commandBundleVal;
+    }
+
+    return result;
+}
+
 NRI_INLINE void CommandAllocatorVal::Reset() {
     GetCoreInterfaceImpl().ResetCommandAllocator(*GetImpl());
 }
@@ -4,13 +4,55 @@
 
 namespace nri {
 
+struct BufferVal;
 struct DescriptorVal;
+struct DescriptorSetVal;
 struct PipelineVal;
 struct PipelineLayoutVal;
+struct TextureVal;
+
+constexpr uint32_t BIND_POINT_NUM = 3; // GRAPHICS, COMPUTE, RAY_TRACING
+
+struct BufferUsageVal {
+    BufferVal* buffer;
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct DescriptorSetBindingVal {
+    const DescriptorSetVal* descriptorSet;
+    uint64_t validatedSignature; // "DescriptorSetVal::GetSignature" at the last draw-time check
+};
+
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+struct TextureStateVal {
+    // The last layout transition
+    uint32_t transitionWorkIndex; // "m_WorkIndex" at the transition
+    Layout transitionBefore;
+    Layout transitionAfter;
+    Dim_t transitionMipOffset;
+    Dim_t transitionMipNum;
+    Dim_t transitionLayerOffset;
+    Dim_t transitionLayerNum;
+
+    // Subresources written by tracked commands since the last barrier, [min; max)
+    Dim_t writtenMipMin;
+    Dim_t writtenMipMax;
+    Dim_t writtenLayerMin;
+    Dim_t writtenLayerMax;
+};
+#endif
 
 struct CommandBufferVal final : public ObjectVal {
     CommandBufferVal(DeviceVal& device, CommandBuffer* commandBuffer, bool isWrapped)
         : ObjectVal(device, commandBuffer)
+        , m_DescriptorSets(device.GetStdAllocator())
+        , m_BufferUsages(device.GetStdAllocator())
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+        , m_TextureStates(device.GetStdAllocator())
+        , m_BarrierIssues(device.GetStdAllocator())
+        , m_BarrierIssueMasks(device.GetStdAllocator())
+#endif
         , m_IsRecordingStarted(isWrapped)
         , m_IsWrapped(isWrapped) {
     }
@@ -23,6 +65,52 @@ struct CommandBufferVal final : public ObjectVal {
         return GetCoreInterfaceImpl().GetCommandBufferNativeObject(GetImpl());
     }
 
+    // Host-visible buffer ranges used by recorded commands
+    inline const Vector<BufferUsageVal>& GetBufferUsages() const {
+        return m_BufferUsages;
+    }
+
+    inline bool IsBundle() const {
+        return m_IsBundle;
+    }
+
+    inline bool IsRecording() const {
+        return m_IsRecordingStarted && !m_IsWrapped;
+    }
+
+    // A regular command buffer must be re-recorded after submission (a wrapped one is recorded outside)
+    inline bool IsReRecordingNeeded() const {
+        return m_IsSubmitted && !m_IsReusable && !m_IsWrapped;
+    }
+
+    inline void OnSubmit() {
+        m_IsSubmitted = true;
+    }
+
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    inline const Vector<BarrierIssueVal>& GetBarrierIssues() const {
+        return m_BarrierIssues;
+    }
+
+    inline uint32_t GetBarrierIssueNum() const {
+        return m_BarrierIssueNum;
+    }
+
+    inline uint32_t GetBarrierWastedSubresourceNum() const {
+        return m_BarrierWastedSubresourceNum;
+    }
+#endif
+
+    inline void SetReusable() {
+        m_IsReusable = true;
+    }
+
+    inline void SetBundleDesc(const CommandBundleDesc& commandBundleDesc) {
+        m_BundleColorNum = commandBundleDesc.colorFormatNum;
+        m_IsBundle = true;
+        m_IsBundleRendering = commandBundleDesc.colorFormatNum || commandBundleDesc.depthStencilFormat != Format::UNKNOWN;
+    }
+
     inline void ResetAttachments() {
         m_RenderTargetNum = 0;
         for (auto& renderTarget : m_RenderTargets)
@@ -49,6 +137,7 @@ struct CommandBufferVal final : public ObjectVal {
     void ClearStorage(const ClearStorageDesc& clearStorageDesc);
     void BeginRendering(const RenderingDesc& renderingDesc);
     void EndRendering();
+    void ExecuteBundle(const CommandBuffer& commandBundle);
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
     void SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType);
     void SetPipelineLayout(BindPoint bindPoint, const PipelineLayout& pipelineLayout);
@@ -59,6 +148,8 @@ struct CommandBufferVal final : public ObjectVal {
     void SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawDescNum);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawIndexedDescNum);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size);
@@ -88,19 +179,55 @@ struct CommandBufferVal final : public ObjectVal {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc);
 
 private:
     void ValidateReadonlyDepthStencil();
+    void ValidateDescriptorSets(BindPoint bindPoint);
+    void ValidateDescriptorSet(uint32_t setIndex, const DescriptorSetDesc& layoutSetDesc, const DescriptorSetVal& descriptorSetVal);
+
+    void TrackBufferUsage(const Buffer* buffer, uint64_t offset, uint64_t size);
+
+    // Barrier analyzer (no-op if "NRI_ENABLE_VALIDATION_BARRIER_ANALYZER" is off)
+    void OnWork();
+    void OnTextureWrite(const Texture* texture, Dim_t mipOffset, Dim_t mipNum, Dim_t layerOffset, Dim_t layerNum);
+    void OnAttachmentWrite(const Descriptor* attachment);
+    void AnalyzeBarrier(const BarrierDesc& barrierDesc);
+
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    TextureStateVal& GetTextureState(const TextureVal* textureVal);
+    bool AddBarrierIssue(const void* resource, BarrierIssue barrierIssue, uint32_t wastedSubresourceNum);
+    void DeferBarrierIssue(const void* resource, BarrierIssue barrierIssue, const char* format, ...);
+    void AnalyzeStages(const char* barrierName, uint32_t i, const void* resource, const char* resourceName, bool isBefore, AccessBits access, StageBits stages);
+#endif
 
+    Vector<DescriptorSetBindingVal> m_DescriptorSets; // "setIndex * BIND_POINT_NUM + bindPoint - 1"
+    Vector<BufferUsageVal> m_BufferUsages;
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    UnorderedMap<const TextureVal*, TextureStateVal> m_TextureStates;
+    Vector<BarrierIssueVal> m_BarrierIssues;                // the first of each kind per resource, merged on "QueueSubmit"
+    UnorderedMap<const void*, uint32_t> m_BarrierIssueMasks; // resource => "BarrierIssue" mask
+    uint32_t m_BarrierIssueNum = 0;
+    uint32_t m_BarrierWastedSubresourceNum = 0;
+    uint32_t m_WorkIndex = 0;
+#endif
     std::array<DescriptorVal*, 16> m_RenderTargets = {};
+    std::array<const PipelineLayoutVal*, BIND_POINT_NUM> m_PipelineLayouts = {};
     DescriptorVal* m_DepthStencil = nullptr;
     PipelineLayoutVal* m_PipelineLayout = nullptr;
     PipelineVal* m_Pipeline = nullptr;
     uint32_t m_RenderTargetNum = 0;
+    uint32_t m_BundleColorNum = 0;
     int32_t m_AnnotationStack = 0;
     bool m_IsRecordingStarted = false;
     bool m_IsWrapped = false;
     bool m_IsRenderPass = false;
+    bool m_IsBundle = false;
+    bool m_IsReusable = false;
+    bool m_IsSubmitted = false; // since "Begin"
+    bool m_IsBundleRendering = false;       // a bundle executed inside of rendering
+    bool m_IsBundlesOnlyRenderPass = false; // "RenderingDesc::bundlesOnly"
+    BindPoint m_BindPoint = BindPoint::GRAPHICS;
 };
 
 } // namespace nri
@@ -80,10 +80,101 @@ static inline bool IsTextureLayoutSupported(const TextureDesc& textureDesc, Layo
     return true;
 }
 
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+
+constexpr AccessBits WRITE_ACCESS = AccessBits::SCRATCH_BUFFER
+    | AccessBits::COLOR_ATTACHMENT_WRITE
+    | AccessBits::DEPTH_STENCIL_ATTACHMENT_WRITE
+    | AccessBits::ACCELERATION_STRUCTURE_WRITE
+    | AccessBits::MICROMAP_WRITE
+    | AccessBits::SHADER_RESOURCE_STORAGE
+    | AccessBits::COPY_DESTINATION
+    | AccessBits::RESOLVE_DESTINATION
+    | AccessBits::CLEAR_STORAGE;
+
+// Writes, which are tracked per subresource by "OnTextureWrite"
+constexpr AccessBits TRACKED_WRITE_ACCESS = AccessBits::COLOR_ATTACHMENT_WRITE
+    | AccessBits::DEPTH_STENCIL_ATTACHMENT_WRITE
+    | AccessBits::COPY_DESTINATION
+    | AccessBits::RESOLVE_DESTINATION
+    | AccessBits::CLEAR_STORAGE;
+
+constexpr AccessBits UNTRACKED_WRITE_ACCESS = (AccessBits)(WRITE_ACCESS & ~TRACKED_WRITE_ACCESS);
+
+// See "Compatible StageBits" in "AccessBits"
+static inline StageBits GetMinimalStages(AccessBits access) {
+    StageBits stages = (StageBits)0;
+    if (access & AccessBits::INDEX_BUFFER)
+        stages |= StageBits::INDEX_INPUT;
+    if (access & AccessBits::VERTEX_BUFFER)
+        stages |= StageBits::VERTEX_SHADER;
+    if (access & (AccessBits::CONSTANT_BUFFER | AccessBits::SHADER_RESOURCE | AccessBits::SHADER_RESOURCE_STORAGE))
+        stages |= StageBits::ALL_SHADERS;
+    if (access & AccessBits::ARGUMENT_BUFFER)
+        stages |= StageBits::INDIRECT;
+    if (access & AccessBits::SCRATCH_BUFFER)
+        stages |= StageBits::ACCELERATION_STRUCTURE | StageBits::MICROMAP;
+    if (access & AccessBits::COLOR_ATTACHMENT)
+        stages |= StageBits::COLOR_ATTACHMENT;
+    if (access & AccessBits::DEPTH_STENCIL_ATTACHMENT)
+        stages |= StageBits::DEPTH_STENCIL_ATTACHMENT;
+    if (access & (AccessBits::SHADING_RATE_ATTACHMENT | AccessBits::INPUT_ATTACHMENT))
+        stages |= StageBits::FRAGMENT_SHADER;
+    if (access & AccessBits::ACCELERATION_STRUCTURE_READ)
+        stages |= StageBits::COMPUTE_SHADER | StageBits::RAY_TRACING_SHADERS | StageBits::ACCELERATION_STRUCTURE;
+    if (access & AccessBits::ACCELERATION_STRUCTURE_WRITE)
+        stages |= StageBits::ACCELERATION_STRUCTURE;
+    if (access & AccessBits::MICROMAP_READ)
+        stages |= StageBits::MICROMAP | StageBits::ACCELERATION_STRUCTURE;
+    if (access & AccessBits::MICROMAP_WRITE)
+        stages |= StageBits::MICROMAP;
+    if (access & AccessBits::SHADER_BINDING_TABLE)
+        stages |= StageBits::RAY_TRACING_SHADERS;
+    if (access & (AccessBits::COPY_SOURCE | AccessBits::COPY_DESTINATION))
+        stages |= StageBits::COPY;
+    if (access & (AccessBits::RESOLVE_SOURCE | AccessBits::RESOLVE_DESTINATION))
+        stages |= StageBits::RESOLVE;
+    if (access & AccessBits::CLEAR_STORAGE)
+        stages |= StageBits::CLEAR_STORAGE;
+
+    return stages;
+}
+
+static void GetStageNames(StageBits stages, char* buffer, size_t bufferSize) {
+    buffer[0] = '\0';
+
+    // Umbrella stages first
+    size_t length = 0;
+    if ((stages & StageBits::ALL_SHADERS) == (uint32_t)StageBits::ALL_SHADERS) {
+        length += snprintf(buffer + length, bufferSize - length, "ALL_SHADERS");
+        stages &= ~StageBits::ALL_SHADERS;
+    } else if ((stages & StageBits::RAY_TRACING_SHADERS) == (uint32_t)StageBits::RAY_TRACING_SHADERS) {
+        length += snprintf(buffer + length, bufferSize - length, "RAY_TRACING_SHADERS");
+        stages &= ~StageBits::RAY_TRACING_SHADERS;
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)g_stageNames.size() && length < bufferSize; i++) {
+        if (stages & (StageBits)(1u << i))
+            length += snprintf(buffer + length, bufferSize - length, "%s%s", length ? " | " : "", g_stageNames[i]);
+    }
+}
+
+static inline Dim_t GetSubresourceNum(Dim_t offset, Dim_t num, Dim_t totalNum) {
+    return num == REMAINING ? (Dim_t)(totalNum - std::min(offset, totalNum)) : num;
+}
+
+#endif
+
 static bool ValidateBufferBarrierDesc(const DeviceVal& device, uint32_t i, const BufferBarrierDesc& bufferBarrier) {
     const BufferVal& bufferVal = *(const BufferVal*)bufferBarrier.buffer;
 
     NRI_RETURN_ON_FAILURE(&device, bufferBarrier.buffer, false, "'barrierDesc.buffers[%u].buffer' is NULL", i);
+
+    uint64_t bufferSize = bufferVal.GetDesc().size;
+    NRI_RETURN_ON_FAILURE(&device, bufferBarrier.offset < bufferSize, false,
+        "'barrierDesc.buffers[%u].offset' is out of bounds of the buffer ('%s')", i, bufferVal.GetDebugName());
+    NRI_RETURN_ON_FAILURE(&device, bufferBarrier.size == WHOLE_SIZE || bufferBarrier.size <= bufferSize - bufferBarrier.offset, false,
+        "'barrierDesc.buffers[%u].offset + barrierDesc.buffers[%u].size' is out of bounds of the buffer ('%s')", i, i, bufferVal.GetDebugName());
     NRI_RETURN_ON_FAILURE(&device, IsAccessMaskSupported(bufferVal.GetDesc(), bufferBarrier.before.access), false,
         "'barrierDesc.buffers[%u].before.access' is not supported by the usage mask of the buffer ('%s')", i, bufferVal.GetDebugName());
     NRI_RETURN_ON_FAILURE(&device, IsAccessMaskSupported(bufferVal.GetDesc(), bufferBarrier.after.access), false,
@@ -123,6 +214,22 @@ NRI_INLINE Result CommandBufferVal::Begin(const DescriptorPool* descriptorPool)
 
     m_Pipeline = nullptr;
     m_PipelineLayout = nullptr;
+    m_PipelineLayouts = {};
+    m_BindPoint = BindPoint::GRAPHICS;
+    m_DescriptorSets.clear();
+    m_BufferUsages.clear();
+    m_IsRenderPass = m_IsBundleRendering;
+    m_IsBundlesOnlyRenderPass = false;
+    m_IsSubmitted = false;
+
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    m_TextureStates.clear();
+    m_BarrierIssues.clear();
+    m_BarrierIssueMasks.clear();
+    m_BarrierIssueNum = 0;
+    m_BarrierWastedSubresourceNum = 0;
+    m_WorkIndex = 0;
+#endif
 
     ResetAttachments();
 
@@ -214,6 +321,8 @@ NRI_INLINE void CommandBufferVal::SetDepthBias(const DepthBiasDesc& depthBiasDes
 NRI_INLINE void CommandBufferVal::ClearAttachments(const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundle, ReturnVoid(), "can't be called in a bundle");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     for (uint32_t i = 0; i < clearAttachmentDescNum; i++) {
@@ -234,6 +343,8 @@ NRI_INLINE void CommandBufferVal::ClearAttachments(const ClearAttachmentDesc* cl
         }
     }
 
+    OnWork();
+
     GetCoreInterfaceImpl().CmdClearAttachments(*GetImpl(), clearAttachmentDescs, clearAttachmentDescNum, rects, rectNum);
 }
 
@@ -246,6 +357,9 @@ NRI_INLINE void CommandBufferVal::ClearStorage(const ClearStorageDesc& clearStor
     NRI_RETURN_ON_FAILURE(&m_Device, descriptorVal.IsShaderResourceStorage(), ReturnVoid(), "'.storage' is not a 'SHADER_RESOURCE_STORAGE' descriptor");
     // TODO: check that a descriptor set is bound, minimal tracking of sets is needed
 
+    OnAttachmentWrite(clearStorageDesc.descriptor); // no-op for buffers
+    OnWork();
+
     auto clearStorageDescImpl = clearStorageDesc;
     clearStorageDescImpl.descriptor = NRI_GET_IMPL(Descriptor, clearStorageDesc.descriptor);
 
@@ -255,6 +369,7 @@ NRI_INLINE void CommandBufferVal::ClearStorage(const ClearStorageDesc& clearStor
 NRI_INLINE void CommandBufferVal::BeginRendering(const RenderingDesc& renderingDesc) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has already been called");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundle, ReturnVoid(), "can't be called in a bundle");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     if (renderingDesc.shadingRate)
@@ -285,23 +400,62 @@ NRI_INLINE void CommandBufferVal::BeginRendering(const RenderingDesc& renderingD
 
     m_RenderTargetNum = renderingDesc.colorNum;
     m_IsRenderPass = true;
+    m_IsBundlesOnlyRenderPass = renderingDesc.bundlesOnly;
 
     ValidateReadonlyDepthStencil();
 
+    for (uint32_t i = 0; i < renderingDesc.colorNum; i++)
+        OnAttachmentWrite(renderingDesc.colors[i].descriptor);
+
+    if (m_DepthStencil && !(m_DepthStencil->IsDepthReadonly() && m_DepthStencil->IsStencilReadonly()))
+        OnAttachmentWrite(depthStencil);
+
+    OnWork();
+
     GetCoreInterfaceImpl().CmdBeginRendering(*GetImpl(), attachmentsDescImpl);
 }
 
 NRI_INLINE void CommandBufferVal::EndRendering() {
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has not been called");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundle, ReturnVoid(), "can't be called in a bundle");
 
     m_IsRenderPass = false;
+    m_IsBundlesOnlyRenderPass = false;
 
     ResetAttachments();
 
     GetCoreInterfaceImpl().CmdEndRendering(*GetImpl());
 }
 
+NRI_INLINE void CommandBufferVal::ExecuteBundle(const CommandBuffer& commandBundle) {
+    const CommandBufferVal& commandBundleVal = (const CommandBufferVal&)commandBundle;
+
+    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundle, ReturnVoid(), "can't be called in a bundle");
+    NRI_RETURN_ON_FAILURE(&m_Device, commandBundleVal.m_IsBundle, ReturnVoid(), "'commandBundle' is not created by 'CreateCommandBundle'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !commandBundleVal.m_IsRecordingStarted, ReturnVoid(), "'commandBundle' is in the recording state");
+
+    if (commandBundleVal.m_IsBundleRendering) {
+        NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "a bundle with attachments must be executed inside 'CmdBeginRendering/CmdEndRendering'");
+        NRI_RETURN_ON_FAILURE(&m_Device, m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass must be begun with 'bundlesOnly = true'");
+        NRI_RETURN_ON_FAILURE(&m_Device, commandBundleVal.m_BundleColorNum == m_RenderTargetNum, ReturnVoid(), "'colorFormatNum' of the bundle doesn't match the number of color attachments");
+    } else
+        NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "a bundle without attachments must be executed outside of 'CmdBeginRendering/CmdEndRendering'");
+
+    OnWork();
+
+    // Bound state is undefined after execution
+    m_Pipeline = nullptr;
+    m_PipelineLayout = nullptr;
+    m_PipelineLayouts = {};
+    m_DescriptorSets.clear();
+
+    m_BufferUsages.insert(m_BufferUsages.end(), commandBundleVal.m_BufferUsages.begin(), commandBundleVal.m_BufferUsages.end());
+
+    GetCoreInterfaceImpl().CmdExecuteBundle(*GetImpl(), *commandBundleVal.GetImpl());
+}
+
 NRI_INLINE void CommandBufferVal::SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
@@ -309,6 +463,8 @@ NRI_INLINE void CommandBufferVal::SetVertexBuffers(uint32_t baseSlot, const Vert
     for (uint32_t i = 0; i < vertexBufferNum; i++) {
         vertexBufferDescsImpl[i] = vertexBufferDescs[i];
         vertexBufferDescsImpl[i].buffer = NRI_GET_IMPL(Buffer, vertexBufferDescs[i].buffer);
+
+        TrackBufferUsage(vertexBufferDescs[i].buffer, vertexBufferDescs[i].offset, WHOLE_SIZE);
     }
 
     GetCoreInterfaceImpl().CmdSetVertexBuffers(*GetImpl(), baseSlot, vertexBufferDescsImpl, vertexBufferNum);
@@ -317,6 +473,8 @@ NRI_INLINE void CommandBufferVal::SetVertexBuffers(uint32_t baseSlot, const Vert
 NRI_INLINE void CommandBufferVal::SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
+    TrackBufferUsage(&buffer, offset, WHOLE_SIZE);
+
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
 
     GetCoreInterfaceImpl().CmdSetIndexBuffer(*GetImpl(), *bufferImpl, offset, indexType);
@@ -329,6 +487,16 @@ NRI_INLINE void CommandBufferVal::SetPipelineLayout(BindPoint bindPoint, const P
     PipelineLayout* pipelineLayoutImpl = NRI_GET_IMPL(PipelineLayout, &pipelineLayout);
 
     m_PipelineLayout = (PipelineLayoutVal*)&pipelineLayout;
+    m_BindPoint = bindPoint;
+
+    // A different layout invalidates cached draw-time checks of bound descriptor sets
+    uint32_t bindPointIndex = (uint32_t)bindPoint - 1;
+    if (m_PipelineLayouts[bindPointIndex] != m_PipelineLayout) {
+        m_PipelineLayouts[bindPointIndex] = m_PipelineLayout;
+
+        for (size_t i = bindPointIndex; i < m_DescriptorSets.size(); i += BIND_POINT_NUM)
+            m_DescriptorSets[i].validatedSignature = 0;
+    }
 
     GetCoreInterfaceImpl().CmdSetPipelineLayout(*GetImpl(), bindPoint, *pipelineLayoutImpl);
 }
@@ -356,6 +524,26 @@ NRI_INLINE void CommandBufferVal::SetDescriptorPool(const DescriptorPool& descri
 NRI_INLINE void CommandBufferVal::SetDescriptorSet(const SetDescriptorSetDesc& setDescriptorSetDesc) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_PipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called");
+    NRI_RETURN_ON_FAILURE(&m_Device, setDescriptorSetDesc.descriptorSet, ReturnVoid(), "'descriptorSet' is NULL");
+
+    BindPoint bindPoint = setDescriptorSetDesc.bindPoint == BindPoint::INHERIT ? m_BindPoint : setDescriptorSetDesc.bindPoint;
+    uint32_t bindPointIndex = (uint32_t)bindPoint - 1;
+
+    const PipelineLayoutVal* pipelineLayout = m_PipelineLayouts[bindPointIndex];
+    NRI_RETURN_ON_FAILURE(&m_Device, pipelineLayout, ReturnVoid(), "'SetPipelineLayout' has not been called for the bind point");
+
+    const PipelineLayoutDesc& pipelineLayoutDesc = pipelineLayout->GetPipelineLayoutDesc();
+    NRI_RETURN_ON_FAILURE(&m_Device, setDescriptorSetDesc.setIndex < pipelineLayoutDesc.descriptorSetNum, ReturnVoid(), "'setIndex = %u' is out of 'descriptorSetNum = %u' in the pipeline layout", setDescriptorSetDesc.setIndex, pipelineLayoutDesc.descriptorSetNum);
+
+    // Rebinding the same set keeps the cached draw-time check
+    size_t index = setDescriptorSetDesc.setIndex * BIND_POINT_NUM + bindPointIndex;
+    if (index >= m_DescriptorSets.size())
+        m_DescriptorSets.resize((setDescriptorSetDesc.setIndex + 1) * BIND_POINT_NUM, {});
+
+    DescriptorSetBindingVal& binding = m_DescriptorSets[index];
+    const DescriptorSetVal* descriptorSetVal = (DescriptorSetVal*)setDescriptorSetDesc.descriptorSet;
+    if (binding.descriptorSet != descriptorSetVal)
+        binding = {descriptorSetVal, 0};
 
     auto descriptorSetBindingDescImpl = setDescriptorSetDesc;
     descriptorSetBindingDescImpl.descriptorSet = NRI_GET_IMPL(DescriptorSet, setDescriptorSetDesc.descriptorSet);
@@ -384,6 +572,8 @@ NRI_INLINE void CommandBufferVal::SetRootDescriptor(const SetRootDescriptorDesc&
     if (!descriptorVal.IsConstantBuffer())
         NRI_RETURN_ON_FAILURE(&m_Device, setRootDescriptorDesc.offset == 0 || deviceDesc.features.nonConstantBufferRootDescriptorOffset, ReturnVoid(), "Non-zero 'setRootDescriptorDesc.offset' is supported only for 'CONSTANT_BUFFER'");
 
+    TrackBufferUsage(descriptorVal.GetBuffer(), descriptorVal.GetBufferOffset() + setRootDescriptorDesc.offset, descriptorVal.GetBufferSize());
+
     auto rootDescriptorBindingDescImpl = setRootDescriptorDesc;
     rootDescriptorBindingDescImpl.descriptor = NRI_GET_IMPL(Descriptor, setRootDescriptorDesc.descriptor);
 
@@ -393,6 +583,10 @@ NRI_INLINE void CommandBufferVal::SetRootDescriptor(const SetRootDescriptorDesc&
 NRI_INLINE void CommandBufferVal::Draw(const DrawDesc& drawDesc) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
+
+    OnWork();
+    ValidateDescriptorSets(BindPoint::GRAPHICS);
 
     GetCoreInterfaceImpl().CmdDraw(*GetImpl(), drawDesc);
 }
@@ -400,17 +594,58 @@ NRI_INLINE void CommandBufferVal::Draw(const DrawDesc& drawDesc) {
 NRI_INLINE void CommandBufferVal::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
+
+    OnWork();
+    ValidateDescriptorSets(BindPoint::GRAPHICS);
 
     GetCoreInterfaceImpl().CmdDrawIndexed(*GetImpl(), drawIndexedDesc);
 }
 
+NRI_INLINE void CommandBufferVal::DrawMulti(const DrawDesc* drawDescs, uint32_t drawDescNum) {
+    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
+    NRI_RETURN_ON_FAILURE(&m_Device, drawDescs || !drawDescNum, ReturnVoid(), "'drawDescs' is NULL");
+
+    if (!drawDescNum)
+        return;
+
+    OnWork();
+    ValidateDescriptorSets(BindPoint::GRAPHICS);
+
+    GetCoreInterfaceImpl().CmdDrawMulti(*GetImpl(), drawDescs, drawDescNum);
+}
+
+NRI_INLINE void CommandBufferVal::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawIndexedDescNum) {
+    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
+    NRI_RETURN_ON_FAILURE(&m_Device, drawIndexedDescs || !drawIndexedDescNum, ReturnVoid(), "'drawIndexedDescs' is NULL");
+
+    if (!drawIndexedDescNum)
+        return;
+
+    OnWork();
+    ValidateDescriptorSets(BindPoint::GRAPHICS);
+
+    GetCoreInterfaceImpl().CmdDrawIndexedMulti(*GetImpl(), drawIndexedDescs, drawIndexedDescNum);
+}
+
 NRI_INLINE void CommandBufferVal::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
     NRI_RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
 
+    OnWork();
+    ValidateDescriptorSets(BindPoint::GRAPHICS);
+
+    TrackBufferUsage(&buffer, offset, (uint64_t)drawNum * stride);
+    TrackBufferUsage(countBuffer, countBufferOffset, sizeof(uint32_t));
+
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
     Buffer* countBufferImpl = NRI_GET_IMPL(Buffer, countBuffer);
 
@@ -422,8 +657,15 @@ NRI_INLINE void CommandBufferVal::DrawIndexedIndirect(const Buffer& buffer, uint
 
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
     NRI_RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
 
+    OnWork();
+    ValidateDescriptorSets(BindPoint::GRAPHICS);
+
+    TrackBufferUsage(&buffer, offset, (uint64_t)drawNum * stride);
+    TrackBufferUsage(countBuffer, countBufferOffset, sizeof(uint32_t));
+
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
     Buffer* countBufferImpl = NRI_GET_IMPL(Buffer, countBuffer);
 
@@ -445,6 +687,10 @@ NRI_INLINE void CommandBufferVal::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffs
         NRI_RETURN_ON_FAILURE(&m_Device, dstOffset + size <= dstDesc.size, ReturnVoid(), "'dstOffset + size' > dstBuffer.size");
     }
 
+    TrackBufferUsage(&dstBuffer, dstOffset, size);
+    TrackBufferUsage(&srcBuffer, srcOffset, size);
+    OnWork();
+
     Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
     Buffer* srcBufferImpl = NRI_GET_IMPL(Buffer, &srcBuffer);
 
@@ -455,6 +701,12 @@ NRI_INLINE void CommandBufferVal::CopyTexture(Texture& dstTexture, const Texture
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
+    if (dstRegion)
+        OnTextureWrite(&dstTexture, dstRegion->mipOffset, 1, dstRegion->layerOffset, 1);
+    else
+        OnTextureWrite(&dstTexture, 0, REMAINING, 0, REMAINING);
+    OnWork();
+
     Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
     Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
 
@@ -471,6 +723,12 @@ NRI_INLINE void CommandBufferVal::ResolveTexture(Texture& dstTexture, const Text
     if (!deviceDesc.features.resolveOpMinMax)
         NRI_RETURN_ON_FAILURE(&m_Device, resolveOp == ResolveOp::AVERAGE, ReturnVoid(), "'features.resolveOpMinMax' is false");
 
+    if (dstRegion)
+        OnTextureWrite(&dstTexture, dstRegion->mipOffset, 1, dstRegion->layerOffset, 1);
+    else
+        OnTextureWrite(&dstTexture, 0, REMAINING, 0, REMAINING);
+    OnWork();
+
     Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
     Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
 
@@ -481,6 +739,10 @@ NRI_INLINE void CommandBufferVal::UploadBufferToTexture(Texture& dstTexture, con
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
+    TrackBufferUsage(&srcBuffer, srcDataLayout.offset, WHOLE_SIZE);
+    OnTextureWrite(&dstTexture, dstRegion.mipOffset, 1, dstRegion.layerOffset, 1);
+    OnWork();
+
     Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
     Buffer* srcBufferImpl = NRI_GET_IMPL(Buffer, &srcBuffer);
 
@@ -491,6 +753,9 @@ NRI_INLINE void CommandBufferVal::ReadbackTextureToBuffer(Buffer& dstBuffer, con
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
+    TrackBufferUsage(&dstBuffer, dstDataLayout.offset, WHOLE_SIZE);
+    OnWork();
+
     Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
     Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
 
@@ -508,6 +773,9 @@ NRI_INLINE void CommandBufferVal::ZeroBuffer(Buffer& buffer, uint64_t offset, ui
         NRI_RETURN_ON_FAILURE(&m_Device, offset + size <= bufferDesc.size, ReturnVoid(), "'offset + size' > buffer.size");
     }
 
+    TrackBufferUsage(&buffer, offset, size);
+    OnWork();
+
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
 
     GetCoreInterfaceImpl().CmdZeroBuffer(*GetImpl(), *bufferImpl, offset, size);
@@ -517,6 +785,9 @@ NRI_INLINE void CommandBufferVal::Dispatch(const DispatchDesc& dispatchDesc) {
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
 
+    OnWork();
+    ValidateDescriptorSets(BindPoint::COMPUTE);
+
     GetCoreInterfaceImpl().CmdDispatch(*GetImpl(), dispatchDesc);
 }
 
@@ -527,6 +798,11 @@ NRI_INLINE void CommandBufferVal::DispatchIndirect(const Buffer& buffer, uint64_
     NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
     NRI_RETURN_ON_FAILURE(&m_Device, offset < bufferDesc.size, ReturnVoid(), "offset is greater than the buffer size");
 
+    OnWork();
+    ValidateDescriptorSets(BindPoint::COMPUTE);
+
+    TrackBufferUsage(&buffer, offset, sizeof(DispatchDesc));
+
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
     GetCoreInterfaceImpl().CmdDispatchIndirect(*GetImpl(), *bufferImpl, offset);
 }
@@ -544,6 +820,8 @@ NRI_INLINE void CommandBufferVal::Barrier(const BarrierDesc& barrierDesc) {
             return;
     }
 
+    AnalyzeBarrier(barrierDesc);
+
     Scratch<BufferBarrierDesc> buffers = NRI_ALLOCATE_SCRATCH(m_Device, BufferBarrierDesc, barrierDesc.bufferNum);
     memcpy(buffers, barrierDesc.buffers, sizeof(BufferBarrierDesc) * barrierDesc.bufferNum);
     for (uint32_t i = 0; i < barrierDesc.bufferNum; i++)
@@ -597,6 +875,9 @@ NRI_INLINE void CommandBufferVal::CopyQueries(const QueryPool& queryPool, uint32
     if (!queryPoolVal.IsImported())
         NRI_RETURN_ON_FAILURE(&m_Device, offset + num <= queryPoolVal.GetQueryNum(), ReturnVoid(), "'offset + num = %u' is out of range", offset + num);
 
+    TrackBufferUsage(&dstBuffer, dstOffset, WHOLE_SIZE);
+    OnWork();
+
     QueryPool* queryPoolImpl = NRI_GET_IMPL(QueryPool, &queryPool);
     Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
 
@@ -818,6 +1099,9 @@ NRI_INLINE void CommandBufferVal::DispatchRays(const DispatchRaysDesc& dispatchR
     NRI_RETURN_ON_FAILURE(&m_Device, dispatchRaysDesc.hitShaderGroups.offset % align == 0, ReturnVoid(), "'hitShaderGroups.offset' is misaligned");
     NRI_RETURN_ON_FAILURE(&m_Device, dispatchRaysDesc.callableShaders.offset % align == 0, ReturnVoid(), "'callableShaders.offset' is misaligned");
 
+    OnWork();
+    ValidateDescriptorSets(BindPoint::RAY_TRACING);
+
     auto dispatchRaysDescImpl = dispatchRaysDesc;
     dispatchRaysDescImpl.raygenShader.buffer = NRI_GET_IMPL(Buffer, dispatchRaysDesc.raygenShader.buffer);
     dispatchRaysDescImpl.missShaders.buffer = NRI_GET_IMPL(Buffer, dispatchRaysDesc.missShaders.buffer);
@@ -836,6 +1120,11 @@ NRI_INLINE void CommandBufferVal::DispatchRaysIndirect(const Buffer& buffer, uin
     NRI_RETURN_ON_FAILURE(&m_Device, offset < bufferDesc.size, ReturnVoid(), "offset is greater than the buffer size");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.tiers.rayTracing >= 2, ReturnVoid(), "'tiers.rayTracing' must be >= 2");
 
+    OnWork();
+    ValidateDescriptorSets(BindPoint::RAY_TRACING);
+
+    TrackBufferUsage(&buffer, offset, WHOLE_SIZE);
+
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
 
     GetRayTracingInterfaceImpl().CmdDispatchRaysIndirect(*GetImpl(), *bufferImpl, offset);
@@ -846,8 +1135,12 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasks(const DrawMeshTasksDesc& drawMes
 
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.meshShader, ReturnVoid(), "'features.meshShader' is false");
 
+    OnWork();
+    ValidateDescriptorSets(BindPoint::GRAPHICS);
+
     GetMeshShaderInterfaceImpl().CmdDrawMeshTasks(*GetImpl(), drawMeshTasksDesc);
 }
 
@@ -857,16 +1150,355 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasksIndirect(const Buffer& buffer, ui
 
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
     NRI_RETURN_ON_FAILURE(&m_Device, deviceDesc.features.meshShader, ReturnVoid(), "'features.meshShader' is false");
     NRI_RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
     NRI_RETURN_ON_FAILURE(&m_Device, offset < bufferDesc.size, ReturnVoid(), "'offset' is greater than the buffer size");
 
+    OnWork();
+    ValidateDescriptorSets(BindPoint::GRAPHICS);
+
+    TrackBufferUsage(&buffer, offset, (uint64_t)drawNum * stride);
+    TrackBufferUsage(countBuffer, countBufferOffset, sizeof(uint32_t));
+
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
     Buffer* countBufferImpl = NRI_GET_IMPL(Buffer, countBuffer);
 
     GetMeshShaderInterfaceImpl().CmdDrawMeshTasksIndirect(*GetImpl(), *bufferImpl, offset, drawNum, stride, countBufferImpl, countBufferOffset);
 }
 
+NRI_INLINE void CommandBufferVal::ExecuteIndirectCommands(const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    const IndirectCommandLayoutVal* indirectCommandLayoutVal = (const IndirectCommandLayoutVal*)executeIndirectCommandsDesc.indirectCommandLayout;
+    const BufferVal* argumentBufferVal = (const BufferVal*)executeIndirectCommandsDesc.argumentBuffer;
+    const BufferVal* preprocessBufferVal = (const BufferVal*)executeIndirectCommandsDesc.preprocessBuffer;
+
+    NRI_RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    NRI_RETURN_ON_FAILURE(&m_Device, indirectCommandLayoutVal, ReturnVoid(), "'indirectCommandLayout' is NULL");
+    NRI_RETURN_ON_FAILURE(&m_Device, argumentBufferVal, ReturnVoid(), "'argumentBuffer' is NULL");
+    NRI_RETURN_ON_FAILURE(&m_Device, preprocessBufferVal, ReturnVoid(), "'preprocessBuffer' is NULL");
+    NRI_RETURN_ON_FAILURE(&m_Device, preprocessBufferVal->GetDesc().usage & BufferUsageBits::PREPROCESS_BUFFER, ReturnVoid(), "'preprocessBuffer' must be created with 'PREPROCESS_BUFFER' usage");
+    NRI_RETURN_ON_FAILURE(&m_Device, !indirectCommandLayoutVal->HasExecutionSet() || executeIndirectCommandsDesc.indirectExecutionSet, ReturnVoid(), "'indirectExecutionSet' is required for 'EXECUTION_SET'");
+    NRI_RETURN_ON_FAILURE(&m_Device, executeIndirectCommandsDesc.indirectExecutionSet || m_Pipeline, ReturnVoid(), "'CmdSetPipeline' has not been called");
+
+    bool isDispatch = indirectCommandLayoutVal->GetActionType() == IndirectCommandType::DISPATCH;
+    if (isDispatch) {
+        NRI_RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "'DISPATCH' must be executed outside of 'CmdBeginRendering/CmdEndRendering'");
+    } else {
+        NRI_RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "draws must be executed inside 'CmdBeginRendering/CmdEndRendering'");
+        NRI_RETURN_ON_FAILURE(&m_Device, !m_IsBundlesOnlyRenderPass, ReturnVoid(), "the rendering pass accepts only 'CmdExecuteBundle' ('bundlesOnly = true')");
+    }
+
+    uint64_t argumentSize = (uint64_t)executeIndirectCommandsDesc.sequenceMaxNum * indirectCommandLayoutVal->GetStride();
+    NRI_RETURN_ON_FAILURE(&m_Device, executeIndirectCommandsDesc.argumentBufferOffset + argumentSize <= argumentBufferVal->GetDesc().size, ReturnVoid(), "'sequenceMaxNum' sequences don't fit into 'argumentBuffer'");
+    NRI_RETURN_ON_FAILURE(&m_Device, executeIndirectCommandsDesc.preprocessBufferOffset < preprocessBufferVal->GetDesc().size, ReturnVoid(), "'preprocessBufferOffset' is greater than the buffer size");
+
+    if (!executeIndirectCommandsDesc.sequenceMaxNum)
+        return;
+
+    OnWork();
+    ValidateDescriptorSets(isDispatch ? BindPoint::COMPUTE : BindPoint::GRAPHICS);
+
+    TrackBufferUsage(executeIndirectCommandsDesc.argumentBuffer, executeIndirectCommandsDesc.argumentBufferOffset, argumentSize);
+    TrackBufferUsage(executeIndirectCommandsDesc.countBuffer, executeIndirectCommandsDesc.countBufferOffset, sizeof(uint32_t));
+
+    auto executeIndirectCommandsDescImpl = executeIndirectCommandsDesc;
+    executeIndirectCommandsDescImpl.indirectCommandLayout = indirectCommandLayoutVal->GetImpl();
+    executeIndirectCommandsDescImpl.indirectExecutionSet = NRI_GET_IMPL(IndirectExecutionSet, executeIndirectCommandsDesc.indirectExecutionSet);
+    executeIndirectCommandsDescImpl.argumentBuffer = argumentBufferVal->GetImpl();
+    executeIndirectCommandsDescImpl.countBuffer = NRI_GET_IMPL(Buffer, executeIndirectCommandsDesc.countBuffer);
+    executeIndirectCommandsDescImpl.preprocessBuffer = preprocessBufferVal->GetImpl();
+
+    GetDeviceGeneratedCommandsInterfaceImpl().CmdExecuteIndirectCommands(*GetImpl(), executeIndirectCommandsDescImpl);
+
+    // The pipeline is undefined after switching via an execution set
+    if (executeIndirectCommandsDesc.indirectExecutionSet)
+        m_Pipeline = nullptr;
+}
+
+NRI_INLINE void CommandBufferVal::TrackBufferUsage(const Buffer* buffer, uint64_t offset, uint64_t size) {
+    BufferVal* bufferVal = (BufferVal*)buffer;
+    if (bufferVal && bufferVal->IsHostVisible())
+        m_BufferUsages.push_back({bufferVal, offset, size});
+}
+
+NRI_INLINE void CommandBufferVal::OnWork() {
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    m_WorkIndex++;
+#endif
+}
+
+NRI_INLINE void CommandBufferVal::OnTextureWrite([[maybe_unused]] const Texture* texture, [[maybe_unused]] Dim_t mipOffset, [[maybe_unused]] Dim_t mipNum, [[maybe_unused]] Dim_t layerOffset, [[maybe_unused]] Dim_t layerNum) {
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    const TextureVal* textureVal = (TextureVal*)texture;
+    if (!textureVal)
+        return;
+
+    const TextureDesc& textureDesc = textureVal->GetDesc();
+    Dim_t mipMax = mipOffset + GetSubresourceNum(mipOffset, mipNum, textureDesc.mipNum);
+    Dim_t layerMax = layerOffset + GetSubresourceNum(layerOffset, layerNum, textureDesc.layerNum);
+
+    TextureStateVal& textureState = GetTextureState(textureVal);
+    if (textureState.writtenMipMin < textureState.writtenMipMax) {
+        textureState.writtenMipMin = std::min(textureState.writtenMipMin, mipOffset);
+        textureState.writtenMipMax = std::max(textureState.writtenMipMax, mipMax);
+        textureState.writtenLayerMin = std::min(textureState.writtenLayerMin, layerOffset);
+        textureState.writtenLayerMax = std::max(textureState.writtenLayerMax, layerMax);
+    } else {
+        textureState.writtenMipMin = mipOffset;
+        textureState.writtenMipMax = mipMax;
+        textureState.writtenLayerMin = layerOffset;
+        textureState.writtenLayerMax = layerMax;
+    }
+#endif
+}
+
+NRI_INLINE void CommandBufferVal::OnAttachmentWrite([[maybe_unused]] const Descriptor* attachment) {
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    const DescriptorVal* descriptorVal = (DescriptorVal*)attachment;
+    if (!descriptorVal)
+        return;
+
+    const TextureViewDesc& textureViewDesc = descriptorVal->GetTextureViewDesc();
+    OnTextureWrite(textureViewDesc.texture, textureViewDesc.mipOffset, textureViewDesc.mipNum, textureViewDesc.layerOffset, textureViewDesc.layerNum);
+#endif
+}
+
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+
+NRI_INLINE TextureStateVal& CommandBufferVal::GetTextureState(const TextureVal* textureVal) {
+    auto result = m_TextureStates.try_emplace(textureVal);
+    if (result.second)
+        result.first->second = {};
+
+    return result.first->second;
+}
+
+// Returns "true" if the issue should be deferred via "DeferBarrierIssue" (the first of its kind for the resource in this command buffer)
+NRI_INLINE bool CommandBufferVal::AddBarrierIssue(const void* resource, BarrierIssue barrierIssue, uint32_t wastedSubresourceNum) {
+    m_BarrierIssueNum++;
+    m_BarrierWastedSubresourceNum += wastedSubresourceNum;
+
+    uint32_t bit = 1u << (uint32_t)barrierIssue;
+    uint32_t& mask = m_BarrierIssueMasks[resource];
+    bool isNew = (mask & bit) == 0;
+    mask |= bit;
+
+    return isNew;
+}
+
+NRI_INLINE void CommandBufferVal::DeferBarrierIssue(const void* resource, BarrierIssue barrierIssue, const char* format, ...) {
+    BarrierIssueVal& barrierIssueVal = m_BarrierIssues.emplace_back();
+    barrierIssueVal.resource = resource;
+    barrierIssueVal.barrierIssue = barrierIssue;
+
+    va_list argptr;
+    va_start(argptr, format);
+    vsnprintf(barrierIssueVal.message, sizeof(barrierIssueVal.message), format, argptr);
+    va_end(argptr);
+}
+
+NRI_INLINE void CommandBufferVal::AnalyzeStages(const char* barrierName, uint32_t i, const void* resource, const char* resourceName, bool isBefore, AccessBits access, StageBits stages) {
+    if (stages != StageBits::ALL || access == AccessBits::NONE)
+        return;
+
+    StageBits minimalStages = GetMinimalStages(access);
+    if (minimalStages == (StageBits)0)
+        return;
+
+    if (AddBarrierIssue(resource, BarrierIssue::ALL_STAGES, 0)) {
+        char stageNames[256];
+        GetStageNames(minimalStages, stageNames, sizeof(stageNames));
+
+        DeferBarrierIssue(resource, BarrierIssue::ALL_STAGES, "'barrierDesc.%s[%u].%s.stages = ALL' ('%s') is over-synchronized, suggested minimal stages for its 'access': %s",
+            barrierName, i, isBefore ? "before" : "after", resourceName, stageNames);
+    }
+}
+
+#endif
+
+NRI_INLINE void CommandBufferVal::AnalyzeBarrier([[maybe_unused]] const BarrierDesc& barrierDesc) {
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    auto isReadOnly = [](AccessBits access) {
+        return access != AccessBits::NONE && (access & WRITE_ACCESS) == 0;
+    };
+
+    for (uint32_t i = 0; i < barrierDesc.globalNum; i++) {
+        const GlobalBarrierDesc& globalBarrier = barrierDesc.globals[i];
+
+        AnalyzeStages("globals", i, nullptr, "", true, globalBarrier.before.access, globalBarrier.before.stages);
+        AnalyzeStages("globals", i, nullptr, "", false, globalBarrier.after.access, globalBarrier.after.stages);
+
+        if (isReadOnly(globalBarrier.before.access) && isReadOnly(globalBarrier.after.access)) {
+            if (AddBarrierIssue(nullptr, BarrierIssue::REDUNDANT, 0))
+                DeferBarrierIssue(nullptr, BarrierIssue::REDUNDANT, "'barrierDesc.globals[%u]' is redundant: read-to-read access doesn't need a barrier", i);
+        }
+    }
+
+    for (uint32_t i = 0; i < barrierDesc.bufferNum; i++) {
+        const BufferBarrierDesc& bufferBarrier = barrierDesc.buffers[i];
+        const BufferVal& bufferVal = *(BufferVal*)bufferBarrier.buffer;
+
+        AnalyzeStages("buffers", i, &bufferVal, bufferVal.GetDebugName(), true, bufferBarrier.before.access, bufferBarrier.before.stages);
+        AnalyzeStages("buffers", i, &bufferVal, bufferVal.GetDebugName(), false, bufferBarrier.after.access, bufferBarrier.after.stages);
+
+        if (isReadOnly(bufferBarrier.before.access) && isReadOnly(bufferBarrier.after.access)) {
+            if (AddBarrierIssue(&bufferVal, BarrierIssue::REDUNDANT, 1))
+                DeferBarrierIssue(&bufferVal, BarrierIssue::REDUNDANT, "'barrierDesc.buffers[%u]' ('%s') is redundant: read-to-read access doesn't need a barrier", i, bufferVal.GetDebugName());
+        }
+    }
+
+    for (uint32_t i = 0; i < barrierDesc.textureNum; i++) {
+        const TextureBarrierDesc& textureBarrier = barrierDesc.textures[i];
+        const TextureVal& textureVal = *(TextureVal*)textureBarrier.texture;
+        const TextureDesc& textureDesc = textureVal.GetDesc();
+
+        AnalyzeStages("textures", i, &textureVal, textureVal.GetDebugName(), true, textureBarrier.before.access, textureBarrier.before.stages);
+        AnalyzeStages("textures", i, &textureVal, textureVal.GetDebugName(), false, textureBarrier.after.access, textureBarrier.after.stages);
+
+        Dim_t mipNum = GetSubresourceNum(textureBarrier.mipOffset, textureBarrier.mipNum, textureDesc.mipNum);
+        Dim_t layerNum = GetSubresourceNum(textureBarrier.layerOffset, textureBarrier.layerNum, textureDesc.layerNum);
+        uint32_t subresourceNum = mipNum * layerNum;
+
+        bool isTransition = textureBarrier.before.layout != textureBarrier.after.layout;
+        bool isQueueTransfer = textureBarrier.srcQueue != textureBarrier.dstQueue;
+        TextureStateVal& textureState = GetTextureState(&textureVal);
+
+        if (!isTransition && !isQueueTransfer && isReadOnly(textureBarrier.before.access) && isReadOnly(textureBarrier.after.access)) {
+            if (AddBarrierIssue(&textureVal, BarrierIssue::REDUNDANT, subresourceNum))
+                DeferBarrierIssue(&textureVal, BarrierIssue::REDUNDANT, "'barrierDesc.textures[%u]' ('%s') is redundant: read-to-read access without a layout change doesn't need a barrier", i, textureVal.GetDebugName());
+        } else if (!isTransition && (textureBarrier.before.access & WRITE_ACCESS) && (textureBarrier.before.access & UNTRACKED_WRITE_ACCESS) == 0 && textureState.writtenMipMin < textureState.writtenMipMax) {
+            // Without a layout change only written subresources need synchronization
+            Dim_t mipMin = std::max(textureState.writtenMipMin, textureBarrier.mipOffset);
+            Dim_t mipMax = std::min(textureState.writtenMipMax, (Dim_t)(textureBarrier.mipOffset + mipNum));
+            Dim_t layerMin = std::max(textureState.writtenLayerMin, textureBarrier.layerOffset);
+            Dim_t layerMax = std::min(textureState.writtenLayerMax, (Dim_t)(textureBarrier.layerOffset + layerNum));
+
+            uint32_t writtenSubresourceNum = (mipMin < mipMax && layerMin < layerMax) ? (mipMax - mipMin) * (layerMax - layerMin) : 0;
+            if (writtenSubresourceNum && writtenSubresourceNum < subresourceNum) {
+                uint32_t wastedSubresourceNum = subresourceNum - writtenSubresourceNum;
+                if (AddBarrierIssue(&textureVal, BarrierIssue::TOO_WIDE, wastedSubresourceNum)) {
+                    DeferBarrierIssue(&textureVal, BarrierIssue::TOO_WIDE, "'barrierDesc.textures[%u]' ('%s') covers %u subresources, but only mips [%u; %u) and layers [%u; %u) have been written (%u subresources wasted)",
+                        i, textureVal.GetDebugName(), subresourceNum, mipMin, mipMax, layerMin, layerMax, wastedSubresourceNum);
+                }
+            }
+        }
+
+        if (isTransition) {
+            bool isUndone = textureState.transitionBefore != textureState.transitionAfter
+                && textureState.transitionWorkIndex == m_WorkIndex
+                && textureState.transitionBefore == textureBarrier.after.layout
+                && textureState.transitionAfter == textureBarrier.before.layout
+                && textureState.transitionMipOffset == textureBarrier.mipOffset
+                && textureState.transitionMipNum == mipNum
+                && textureState.transitionLayerOffset == textureBarrier.layerOffset
+                && textureState.transitionLayerNum == layerNum;
+
+            if (isUndone) {
+                if (AddBarrierIssue(&textureVal, BarrierIssue::UNDONE_TRANSITION, 2 * subresourceNum)) {
+                    DeferBarrierIssue(&textureVal, BarrierIssue::UNDONE_TRANSITION, "'barrierDesc.textures[%u]' ('%s') undoes the previous '%s -> %s' transition without any work in between (%u subresources wasted)",
+                        i, textureVal.GetDebugName(), GetLayoutName(textureState.transitionBefore), GetLayoutName(textureState.transitionAfter), 2 * subresourceNum);
+                }
+            }
+
+            textureState.transitionWorkIndex = m_WorkIndex;
+            textureState.transitionBefore = textureBarrier.before.layout;
+            textureState.transitionAfter = textureBarrier.after.layout;
+            textureState.transitionMipOffset = textureBarrier.mipOffset;
+            textureState.transitionMipNum = mipNum;
+            textureState.transitionLayerOffset = textureBarrier.layerOffset;
+            textureState.transitionLayerNum = layerNum;
+        }
+
+        // Writes are synchronized
+        textureState.writtenMipMin = 0;
+        textureState.writtenMipMax = 0;
+    }
+#endif
+}
+
+NRI_INLINE void CommandBufferVal::ValidateDescriptorSets(BindPoint bindPoint) {
+    uint32_t bindPointIndex = (uint32_t)bindPoint - 1;
+
+    const PipelineLayoutVal* pipelineLayout = m_PipelineLayouts[bindPointIndex];
+    if (!pipelineLayout)
+        return;
+
+    const PipelineLayoutDesc& pipelineLayoutDesc = pipelineLayout->GetPipelineLayoutDesc();
+    if (m_DescriptorSets.size() < pipelineLayoutDesc.descriptorSetNum * BIND_POINT_NUM)
+        m_DescriptorSets.resize(pipelineLayoutDesc.descriptorSetNum * BIND_POINT_NUM, {});
+
+    for (uint32_t i = 0; i < pipelineLayoutDesc.descriptorSetNum; i++) {
+        DescriptorSetBindingVal& binding = m_DescriptorSets[i * BIND_POINT_NUM + bindPointIndex];
+
+        // Reported once, until the binding or the layout changes
+        if (!binding.descriptorSet) {
+            if (!binding.validatedSignature)
+                NRI_REPORT_WARNING(&m_Device, "descriptor set #%u (registerSpace=%u) declared in the pipeline layout is not bound", i, pipelineLayoutDesc.descriptorSets[i].registerSpace);
+
+            binding.validatedSignature = 1;
+            continue;
+        }
+
+        // Unchanged since the last check
+        uint64_t signature = binding.descriptorSet->GetSignature();
+        if (binding.validatedSignature == signature)
+            continue;
+
+        ValidateDescriptorSet(i, pipelineLayoutDesc.descriptorSets[i], *binding.descriptorSet);
+        binding.validatedSignature = signature;
+    }
+}
+
+NRI_INLINE void CommandBufferVal::ValidateDescriptorSet(uint32_t setIndex, const DescriptorSetDesc& layoutSetDesc, const DescriptorSetVal& descriptorSetVal) {
+    const DescriptorSetDesc& setDesc = descriptorSetVal.GetDesc();
+
+    // Sets allocated for a different (but hopefully compatible) pipeline layout
+    if (&setDesc != &layoutSetDesc) {
+        NRI_RETURN_ON_FAILURE(&m_Device, setDesc.rangeNum == layoutSetDesc.rangeNum, ReturnVoid(),
+            "descriptor set #%u ('%s') is incompatible with the pipeline layout: 'rangeNum = %u', but expected %u", setIndex, descriptorSetVal.GetDebugName(), setDesc.rangeNum, layoutSetDesc.rangeNum);
+
+        for (uint32_t i = 0; i < setDesc.rangeNum; i++) {
+            const DescriptorRangeDesc& rangeDesc = setDesc.ranges[i];
+            const DescriptorRangeDesc& layoutRangeDesc = layoutSetDesc.ranges[i];
+
+            NRI_RETURN_ON_FAILURE(&m_Device, rangeDesc.descriptorType == layoutRangeDesc.descriptorType, ReturnVoid(),
+                "descriptor set #%u ('%s') is incompatible with the pipeline layout: range #%u has 'descriptorType = %s', but expected '%s'",
+                setIndex, descriptorSetVal.GetDebugName(), i, GetDescriptorTypeName(rangeDesc.descriptorType), GetDescriptorTypeName(layoutRangeDesc.descriptorType));
+            NRI_RETURN_ON_FAILURE(&m_Device, rangeDesc.baseRegisterIndex == layoutRangeDesc.baseRegisterIndex && rangeDesc.descriptorNum == layoutRangeDesc.descriptorNum, ReturnVoid(),
+                "descriptor set #%u ('%s') is incompatible with the pipeline layout: range #%u (descriptorType=%s) has different 'baseRegisterIndex' or 'descriptorNum'",
+                setIndex, descriptorSetVal.GetDebugName(), i, GetDescriptorTypeName(rangeDesc.descriptorType));
+        }
+    }
+
+    // Per-range counters are maintained by updates and copies, descriptors are visited only to report the first offender
+    for (uint32_t i = 0; i < setDesc.rangeNum; i++) {
+        const DescriptorRangeDesc& rangeDesc = setDesc.ranges[i];
+        const DescriptorRangeStateVal& rangeState = descriptorSetVal.GetRangeState(i);
+        bool isPartiallyBound = (rangeDesc.flags & (DescriptorRangeBits::PARTIALLY_BOUND | DescriptorRangeBits::ALLOW_UPDATE_AFTER_SET)) != 0;
+
+        if (rangeState.unwrittenNum && !isPartiallyBound) {
+            uint32_t j = 0;
+            while (descriptorSetVal.GetSlot(i, j).type != DescriptorType::MAX_NUM)
+                j++;
+
+            NRI_REPORT_ERROR(&m_Device, "descriptor set #%u ('%s'): descriptor #%u in range #%u (descriptorType=%s) has not been written (use 'PARTIALLY_BOUND' if it's intentional)",
+                setIndex, descriptorSetVal.GetDebugName(), j, i, GetDescriptorTypeName(rangeDesc.descriptorType));
+            return;
+        }
+
+        if (rangeState.unsupportedFormatNum) {
+            uint32_t j = 0;
+            while (descriptorSetVal.GetSlot(i, j).isFormatSupported)
+                j++;
+
+            const DescriptorSlotVal& slot = descriptorSetVal.GetSlot(i, j);
+            NRI_REPORT_ERROR(&m_Device, "descriptor set #%u ('%s'): descriptor #%u in range #%u (descriptorType=%s) has format '%s', which doesn't support such usage",
+                setIndex, descriptorSetVal.GetDebugName(), j, i, GetDescriptorTypeName(slot.type), GetFormatProps(slot.format).name);
+            return;
+        }
+    }
+}
+
 NRI_INLINE void CommandBufferVal::ValidateReadonlyDepthStencil() {
     if (m_Pipeline && m_DepthStencil) {
         if (m_DepthStencil->IsDepthReadonly() && m_Pipeline->WritesToDepth())
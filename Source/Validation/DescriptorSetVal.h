@@ -4,9 +4,28 @@
 
 namespace nri {
 
+struct DescriptorVal;
+
+// A copy of what matters for draw-time validation: a written descriptor can be legally destroyed (i.e. "PARTIALLY_BOUND")
+struct DescriptorSlotVal {
+    Format format;
+    DescriptorType type; // "MAX_NUM" if not written
+    bool isFormatSupported;
+};
+
+// Maintained incrementally by updates and copies, keeps draw-time validation of unchanged descriptors out of the way
+struct DescriptorRangeStateVal {
+    uint32_t offset; // in "m_Slots"
+    uint32_t descriptorNum;
+    uint32_t unwrittenNum;
+    uint32_t unsupportedFormatNum;
+};
+
 struct DescriptorSetVal final : public ObjectVal {
     DescriptorSetVal(DeviceVal& device)
-        : ObjectVal(device) {
+        : ObjectVal(device)
+        , m_Slots(device.GetStdAllocator())
+        , m_Ranges(device.GetStdAllocator()) {
     }
 
     inline DescriptorSet* GetImpl() const {
@@ -17,7 +36,26 @@ struct DescriptorSetVal final : public ObjectVal {
         return *m_Desc;
     }
 
-    void SetImpl(DescriptorSet* impl, const DescriptorSetDesc* desc);
+    // Changes only if the content changes, allows to skip repeated validation of unchanged bindings
+    inline uint64_t GetSignature() const {
+        return m_Signature;
+    }
+
+    inline uint32_t GetRangeDescriptorNum(uint32_t rangeIndex) const {
+        return m_Ranges[rangeIndex].descriptorNum;
+    }
+
+    inline const DescriptorRangeStateVal& GetRangeState(uint32_t rangeIndex) const {
+        return m_Ranges[rangeIndex];
+    }
+
+    inline const DescriptorSlotVal& GetSlot(uint32_t rangeIndex, uint32_t descriptorIndex) const {
+        return m_Slots[m_Ranges[rangeIndex].offset + descriptorIndex];
+    }
+
+    void SetImpl(DescriptorSet* impl, const DescriptorSetDesc* desc, uint32_t variableDescriptorNum);
+    void UpdateDescriptors(uint32_t rangeIndex, uint32_t baseDescriptor, const DescriptorVal* const* descriptors, uint32_t descriptorNum);
+    void CopyDescriptors(uint32_t dstRangeIndex, uint32_t dstBaseDescriptor, const DescriptorSetVal& srcSet, uint32_t srcRangeIndex, uint32_t srcBaseDescriptor, uint32_t descriptorNum);
 
     //================================================================================================================
     // NRI
@@ -25,8 +63,14 @@ struct DescriptorSetVal final : public ObjectVal {
 
     void GetOffsets(uint32_t& resourceHeapOffset, uint32_t& samplerHeapOffset) const;
 
+private:
+    void WriteSlot(DescriptorRangeStateVal& range, uint32_t descriptorIndex, const DescriptorSlotVal& slot);
+
 private:
     const DescriptorSetDesc* m_Desc = nullptr; // .natvis
+    Vector<DescriptorSlotVal> m_Slots;
+    Vector<DescriptorRangeStateVal> m_Ranges;
+    uint64_t m_Signature = 0;
 };
 
 } // namespace nri
@@ -1,11 +1,80 @@
 // © 2021 NVIDIA Corporation
 
-NRI_INLINE void DescriptorSetVal::SetImpl(DescriptorSet* impl, const DescriptorSetDesc* desc) {
+static inline FormatSupportBits GetRequiredFormatSupport(DescriptorType descriptorType) {
+    switch (descriptorType) {
+        case DescriptorType::TEXTURE:
+            return FormatSupportBits::TEXTURE;
+        case DescriptorType::STORAGE_TEXTURE:
+            return FormatSupportBits::STORAGE_TEXTURE;
+        case DescriptorType::BUFFER:
+            return FormatSupportBits::BUFFER;
+        case DescriptorType::STORAGE_BUFFER:
+            return FormatSupportBits::STORAGE_BUFFER;
+        default:
+            return FormatSupportBits::UNSUPPORTED;
+    }
+}
+
+NRI_INLINE void DescriptorSetVal::SetImpl(DescriptorSet* impl, const DescriptorSetDesc* desc, uint32_t variableDescriptorNum) {
     m_Impl = impl;
     m_Desc = desc;
+    m_Signature++;
+
+    m_Ranges.resize(desc->rangeNum);
+
+    uint32_t descriptorNum = 0;
+    for (uint32_t i = 0; i < desc->rangeNum; i++) {
+        const DescriptorRangeDesc& rangeDesc = desc->ranges[i];
+        uint32_t rangeDescriptorNum = (rangeDesc.flags & DescriptorRangeBits::VARIABLE_SIZED_ARRAY) ? variableDescriptorNum : rangeDesc.descriptorNum;
+
+        m_Ranges[i] = {descriptorNum, rangeDescriptorNum, rangeDescriptorNum, 0};
+        descriptorNum += rangeDescriptorNum;
+    }
+
+    m_Slots.assign(descriptorNum, {Format::UNKNOWN, DescriptorType::MAX_NUM, true});
+}
+
+NRI_INLINE void DescriptorSetVal::WriteSlot(DescriptorRangeStateVal& range, uint32_t descriptorIndex, const DescriptorSlotVal& slot) {
+    DescriptorSlotVal& dst = m_Slots[range.offset + descriptorIndex];
+
+    range.unwrittenNum -= dst.type == DescriptorType::MAX_NUM ? 1 : 0;
+    range.unsupportedFormatNum -= dst.isFormatSupported ? 0 : 1;
+
+    dst = slot;
+
+    range.unwrittenNum += dst.type == DescriptorType::MAX_NUM ? 1 : 0;
+    range.unsupportedFormatNum += dst.isFormatSupported ? 0 : 1;
+}
+
+NRI_INLINE void DescriptorSetVal::UpdateDescriptors(uint32_t rangeIndex, uint32_t baseDescriptor, const DescriptorVal* const* descriptors, uint32_t descriptorNum) {
+    DescriptorRangeStateVal& range = m_Ranges[rangeIndex];
+
+    for (uint32_t i = 0; i < descriptorNum; i++) {
+        const DescriptorVal& descriptorVal = *descriptors[i];
+
+        DescriptorSlotVal slot = {descriptorVal.GetFormat(), descriptorVal.GetType(), true};
+
+        // Structured and raw buffers have no format
+        FormatSupportBits requiredFormatSupport = GetRequiredFormatSupport(slot.type);
+        if (requiredFormatSupport != FormatSupportBits::UNSUPPORTED && slot.format != Format::UNKNOWN)
+            slot.isFormatSupported = (m_Device.GetFormatSupport(slot.format) & requiredFormatSupport) != 0;
+
+        WriteSlot(range, baseDescriptor + i, slot);
+    }
+
+    m_Signature++;
+}
+
+NRI_INLINE void DescriptorSetVal::CopyDescriptors(uint32_t dstRangeIndex, uint32_t dstBaseDescriptor, const DescriptorSetVal& srcSet, uint32_t srcRangeIndex, uint32_t srcBaseDescriptor, uint32_t descriptorNum) {
+    DescriptorRangeStateVal& dstRange = m_Ranges[dstRangeIndex];
+    const DescriptorRangeStateVal& srcRange = srcSet.m_Ranges[srcRangeIndex];
+
+    for (uint32_t i = 0; i < descriptorNum; i++)
+        WriteSlot(dstRange, dstBaseDescriptor + i, srcSet.m_Slots[srcRange.offset + srcBaseDescriptor + i]);
+
+    m_Signature++;
 }
 
 NRI_INLINE void DescriptorSetVal::GetOffsets(uint32_t& resourceHeapOffset, uint32_t& samplerHeapOffset) const {
     GetCoreInterfaceImpl().GetDescriptorSetOffsets(*GetImpl(), resourceHeapOffset, samplerHeapOffset);
 }
-
@@ -43,6 +43,26 @@ struct DescriptorVal final : public ObjectVal {
         return (DescriptorType)m_Type;
     }
 
+    inline Format GetFormat() const {
+        return m_Format;
+    }
+
+    inline const Buffer* GetBuffer() const {
+        return m_Buffer;
+    }
+
+    inline uint64_t GetBufferOffset() const {
+        return m_BufferOffset;
+    }
+
+    inline uint64_t GetBufferSize() const {
+        return m_BufferSize;
+    }
+
+    inline const TextureViewDesc& GetTextureViewDesc() const {
+        return m_TextureViewDesc;
+    }
+
     inline uint64_t GetNativeObject() const {
         return GetCoreInterfaceImpl().GetDescriptorNativeObject(GetImpl());
     }
@@ -79,6 +99,11 @@ struct DescriptorVal final : public ObjectVal {
 
 private:
     DescriptorTypeExt m_Type = DescriptorTypeExt::MAX_NUM;
+    Format m_Format = Format::UNKNOWN;
+    const Buffer* m_Buffer = nullptr; // buffer views only
+    uint64_t m_BufferOffset = 0;
+    uint64_t m_BufferSize = 0;
+    TextureViewDesc m_TextureViewDesc = {}; // texture views only
     bool m_IsDepthReadonly = false;
     bool m_IsStencilReadonly = false;
 };
@@ -6,7 +6,11 @@ DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, Descript
 }
 
 DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, const BufferViewDesc& bufferViewDesc)
-    : ObjectVal(device, descriptor) {
+    : ObjectVal(device, descriptor)
+    , m_Format(bufferViewDesc.format)
+    , m_Buffer(bufferViewDesc.buffer)
+    , m_BufferOffset(bufferViewDesc.offset)
+    , m_BufferSize(bufferViewDesc.size) {
     switch (bufferViewDesc.type) {
         case BufferView::BUFFER:
             m_Type = DescriptorTypeExt::BUFFER;
@@ -32,7 +36,9 @@ DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, const Bu
 }
 
 DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, const TextureViewDesc& textureViewDesc)
-    : ObjectVal(device, descriptor) {
+    : ObjectVal(device, descriptor)
+    , m_Format(textureViewDesc.format)
+    , m_TextureViewDesc(textureViewDesc) {
     switch (textureViewDesc.type) {
         case TextureView::TEXTURE:
         case TextureView::TEXTURE_ARRAY:
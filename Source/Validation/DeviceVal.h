@@ -4,18 +4,46 @@
 
 namespace nri {
 
+struct FenceVal;
 struct QueueVal;
 
 struct IsExtSupported {
-    uint32_t lowLatency   : 1;
-    uint32_t meshShader   : 1;
-    uint32_t rayTracing   : 1;
-    uint32_t swapChain    : 1;
-    uint32_t wrapperD3D11 : 1;
-    uint32_t wrapperD3D12 : 1;
-    uint32_t wrapperVK    : 1;
+    uint32_t deviceGeneratedCommands : 1;
+    uint32_t lowLatency              : 1;
+    uint32_t meshShader              : 1;
+    uint32_t rayTracing              : 1;
+    uint32_t swapChain               : 1;
+    uint32_t wrapperD3D11            : 1;
+    uint32_t wrapperD3D12            : 1;
+    uint32_t wrapperVK               : 1;
 };
 
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+enum class BarrierIssue : uint8_t {
+    ALL_STAGES,
+    REDUNDANT,
+    TOO_WIDE,
+    UNDONE_TRANSITION
+};
+
+// Recorded by a command buffer, reported on "QueueSubmit" if not yet reported for the resource
+struct BarrierIssueVal {
+    const void* resource; // NULL for global barriers
+    BarrierIssue barrierIssue;
+    char message[256];
+};
+#endif
+
+#if NRI_ENABLE_VALIDATION_PROFILING
+struct EntryPointStatsVal {
+    std::atomic<const char*> name;
+    std::atomic_uint64_t callNum;
+    std::atomic_uint64_t timeNs;
+};
+
+constexpr size_t ENTRY_POINT_NUM = sizeof(CoreInterface) / sizeof(void*);
+#endif
+
 struct DeviceVal final : public DeviceBase {
     DeviceVal(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, DeviceBase& device);
     ~DeviceVal();
@@ -32,6 +60,10 @@ struct DeviceVal final : public DeviceBase {
         return m_iCoreImpl;
     }
 
+    inline const DeviceGeneratedCommandsInterface& GetDeviceGeneratedCommandsInterfaceImpl() const {
+        return m_iDeviceGeneratedCommandsImpl;
+    }
+
     inline const HelperInterface& GetHelperInterfaceImpl() const {
         return m_iHelperImpl;
     }
@@ -72,9 +104,33 @@ struct DeviceVal final : public DeviceBase {
         return m_Lock;
     }
 
+    // Returns NULL for a destroyed fence (must be called under "GetLock")
+    inline FenceVal* FindFence(uint64_t fenceUid) const {
+        auto it = m_Fences.find(fenceUid);
+        return it == m_Fences.end() ? nullptr : it->second;
+    }
+
+    uint64_t RegisterFence(FenceVal& fence);
+    void UnregisterFence(uint64_t fenceUid);
+
     bool Create();
     void RegisterMemoryType(MemoryType memoryType, MemoryLocation memoryLocation);
 
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    void MergeBarrierIssues(const CommandBuffer* const* commandBuffers, uint32_t commandBufferNum);
+    void ForgetBarrierIssues(const void* resource);
+    void ReportBarrierIssues();
+#endif
+
+#if NRI_ENABLE_VALIDATION_PROFILING
+    inline void AddEntryPointStats(size_t index, const char* name, uint64_t timeNs) {
+        EntryPointStatsVal& entryPointStats = m_EntryPointStats[index];
+        entryPointStats.name.store(name, std::memory_order_relaxed);
+        entryPointStats.callNum.fetch_add(1, std::memory_order_relaxed);
+        entryPointStats.timeNs.fetch_add(timeNs, std::memory_order_relaxed);
+    }
+#endif
+
     //================================================================================================================
     // DebugNameBase
     //================================================================================================================
@@ -101,6 +157,7 @@ struct DeviceVal final : public DeviceBase {
 
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(DeviceGeneratedCommandsInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
@@ -112,6 +169,10 @@ struct DeviceVal final : public DeviceBase {
     Result FillFunctionTable(WrapperD3D12Interface& table) const override;
     Result FillFunctionTable(WrapperVKInterface& table) const override;
 
+#if NRI_ENABLE_VALIDATION_PROFILING
+    Result GetEntryPointStats(EntryPointStats* entryPointStats, uint32_t& entryPointStatNum) const override;
+#endif
+
 #if NRI_ENABLE_IMGUI_EXTENSION
     Result FillFunctionTable(ImguiInterface& table) const override;
 #endif
@@ -156,6 +217,8 @@ struct DeviceVal final : public DeviceBase {
     Result CreateAccelerationStructure(const AccelerationStructureDesc& accelerationStructureDesc, AccelerationStructure*& accelerationStructure);
     Result CreateAccelerationStructure(const AccelerationStructureVKDesc& accelerationStructureVKDesc, AccelerationStructure*& accelerationStructure);
     Result CreateAccelerationStructure(const AccelerationStructureD3D12Desc& accelerationStructureD3D12Desc, AccelerationStructure*& accelerationStructure);
+    Result CreateIndirectCommandLayout(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout);
+    Result CreateIndirectExecutionSet(const IndirectExecutionSetDesc& indirectExecutionSetDesc, IndirectExecutionSet*& indirectExecutionSet);
     Result CreateCommittedBuffer(MemoryLocation memoryLocation, float priority, const BufferDesc& bufferDesc, Buffer*& buffer);
     Result CreateCommittedTexture(MemoryLocation memoryLocation, float priority, const TextureDesc& textureDesc, Texture*& texture);
     Result CreateCommittedMicromap(MemoryLocation memoryLocation, float priority, const MicromapDesc& micromapDesc, Micromap*& micromap);
@@ -186,10 +249,13 @@ struct DeviceVal final : public DeviceBase {
     void DestroyCommandBuffer(CommandBuffer* commandBuffer);
     void DestroyCommandAllocator(CommandAllocator* commandAllocator);
     void DestroyAccelerationStructure(AccelerationStructure* accelerationStructure);
+    void DestroyIndirectCommandLayout(IndirectCommandLayout* indirectCommandLayout);
+    void DestroyIndirectExecutionSet(IndirectExecutionSet* indirectExecutionSet);
     void CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDescriptorRangeDescs, uint32_t copyDescriptorRangeDescNum);
     void UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* updateDescriptorRangeDescs, uint32_t updateDescriptorRangeDescNum);
 
     FormatSupportBits GetFormatSupport(Format format) const;
+    uint64_t GetIndirectCommandsPreprocessBufferSize(const IndirectCommandsPreprocessDesc& indirectCommandsPreprocessDesc) const;
 
 private:
     char* m_Name = nullptr; // .natvis
@@ -203,6 +269,7 @@ private:
 
     // Implementation
     CoreInterface m_iCoreImpl = {};
+    DeviceGeneratedCommandsInterface m_iDeviceGeneratedCommandsImpl = {};
     HelperInterface m_iHelperImpl = {};
     LowLatencyInterface m_iLowLatencyImpl = {};
     MeshShaderInterface m_iMeshShaderImpl = {};
@@ -218,6 +285,18 @@ private:
     };
 
     Lock m_Lock;
+    UnorderedMap<uint64_t, FenceVal*> m_Fences; // alive fences by "FenceVal::GetUid", in-flight buffers remember UIDs
+    uint64_t m_FenceUidNext = 1;
+
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    UnorderedMap<const void*, uint32_t> m_ReportedBarrierIssues; // resource => "BarrierIssue" mask (guarded by "m_Lock")
+    uint32_t m_BarrierIssueNum = 0;                              // since the last "QueuePresent" (guarded by "m_Lock")
+    uint32_t m_BarrierWastedSubresourceNum = 0;                  // since the last "QueuePresent" (guarded by "m_Lock")
+#endif
+
+#if NRI_ENABLE_VALIDATION_PROFILING
+    std::array<EntryPointStatsVal, ENTRY_POINT_NUM> m_EntryPointStats = {};
+#endif
 };
 
 } // namespace nri
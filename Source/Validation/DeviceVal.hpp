@@ -99,7 +99,12 @@ static inline bool IsViewTypeSupported(const TextureDesc& textureDesc, TextureVi
 DeviceVal::DeviceVal(const CallbackInterface& callbacks, const AllocationCallbacks& allocationCallbacks, DeviceBase& device)
     : DeviceBase(callbacks, allocationCallbacks, NRI_OBJECT_SIGNATURE)
     , m_Impl(*(Device*)&device)
-    , m_MemoryTypeMap(GetStdAllocator()) {
+    , m_MemoryTypeMap(GetStdAllocator())
+    , m_Fences(GetStdAllocator())
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    , m_ReportedBarrierIssues(GetStdAllocator())
+#endif
+{
 }
 
 DeviceVal::~DeviceVal() {
@@ -114,6 +119,21 @@ DeviceVal::~DeviceVal() {
     ((DeviceBase*)&m_Impl)->Destruct();
 }
 
+uint64_t DeviceVal::RegisterFence(FenceVal& fence) {
+    ExclusiveScope lock(m_Lock);
+
+    uint64_t fenceUid = m_FenceUidNext++;
+    m_Fences[fenceUid] = &fence;
+
+    return fenceUid;
+}
+
+void DeviceVal::UnregisterFence(uint64_t fenceUid) {
+    ExclusiveScope lock(m_Lock);
+
+    m_Fences.erase(fenceUid);
+}
+
 bool DeviceVal::Create() {
     const DeviceBase& deviceBaseImpl = (DeviceBase&)m_Impl;
 
@@ -123,6 +143,7 @@ bool DeviceVal::Create() {
     result = deviceBaseImpl.FillFunctionTable(m_iHelperImpl);
     NRI_RETURN_ON_FAILURE(this, result == Result::SUCCESS, false, "Failed to get 'HelperInterface' interface");
 
+    m_IsExtSupported.deviceGeneratedCommands = deviceBaseImpl.FillFunctionTable(m_iDeviceGeneratedCommandsImpl) == Result::SUCCESS;
     m_IsExtSupported.lowLatency = deviceBaseImpl.FillFunctionTable(m_iLowLatencyImpl) == Result::SUCCESS;
     m_IsExtSupported.meshShader = deviceBaseImpl.FillFunctionTable(m_iMeshShaderImpl) == Result::SUCCESS;
     m_IsExtSupported.rayTracing = deviceBaseImpl.FillFunctionTable(m_iRayTracingImpl) == Result::SUCCESS;
@@ -146,6 +167,74 @@ void DeviceVal::Destruct() {
     Destroy(GetAllocationCallbacks(), this);
 }
 
+#if NRI_ENABLE_VALIDATION_PROFILING
+
+Result DeviceVal::GetEntryPointStats(EntryPointStats* entryPointStats, uint32_t& entryPointStatNum) const {
+    if (!entryPointStats) {
+        entryPointStatNum = (uint32_t)m_EntryPointStats.size();
+        return Result::SUCCESS;
+    }
+
+    entryPointStatNum = std::min(entryPointStatNum, (uint32_t)m_EntryPointStats.size());
+    for (uint32_t i = 0; i < entryPointStatNum; i++) {
+        const EntryPointStatsVal& src = m_EntryPointStats[i];
+        EntryPointStats& dst = entryPointStats[i];
+
+        dst.name = src.name.load(std::memory_order_relaxed);
+        dst.callNum = src.callNum.load(std::memory_order_relaxed);
+        dst.timeNs = src.timeNs.load(std::memory_order_relaxed);
+    }
+
+    return Result::SUCCESS;
+}
+
+#endif
+
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+
+void DeviceVal::MergeBarrierIssues(const CommandBuffer* const* commandBuffers, uint32_t commandBufferNum) {
+    ExclusiveScope lock(m_Lock);
+
+    for (uint32_t i = 0; i < commandBufferNum; i++) {
+        const CommandBufferVal& commandBufferVal = *(CommandBufferVal*)commandBuffers[i];
+
+        m_BarrierIssueNum += commandBufferVal.GetBarrierIssueNum();
+        m_BarrierWastedSubresourceNum += commandBufferVal.GetBarrierWastedSubresourceNum();
+
+        for (const BarrierIssueVal& barrierIssue : commandBufferVal.GetBarrierIssues()) {
+            uint32_t bit = 1u << (uint32_t)barrierIssue.barrierIssue;
+            uint32_t& mask = m_ReportedBarrierIssues[barrierIssue.resource];
+
+            if (!(mask & bit))
+                NRI_REPORT_WARNING(this, "%s", barrierIssue.message);
+
+            mask |= bit;
+        }
+    }
+}
+
+void DeviceVal::ForgetBarrierIssues(const void* resource) {
+    ExclusiveScope lock(m_Lock);
+
+    m_ReportedBarrierIssues.erase(resource);
+}
+
+void DeviceVal::ReportBarrierIssues() {
+    uint32_t barrierIssueNum = 0;
+    uint32_t barrierWastedSubresourceNum = 0;
+    {
+        ExclusiveScope lock(m_Lock);
+
+        std::swap(barrierIssueNum, m_BarrierIssueNum);
+        std::swap(barrierWastedSubresourceNum, m_BarrierWastedSubresourceNum);
+    }
+
+    if (barrierIssueNum)
+        NRI_REPORT_WARNING(this, "%u over-synchronized barriers in the frame (%u wasted subresources)", barrierIssueNum, barrierWastedSubresourceNum);
+}
+
+#endif
+
 NRI_INLINE Result DeviceVal::CreateSwapChain(const SwapChainDesc& swapChainDesc, SwapChain*& swapChain) {
     NRI_RETURN_ON_FAILURE(this, swapChainDesc.queue != nullptr, Result::INVALID_ARGUMENT, "'queue' is NULL");
     NRI_RETURN_ON_FAILURE(this, swapChainDesc.width != 0, Result::INVALID_ARGUMENT, "'width' is 0");
@@ -555,11 +644,19 @@ NRI_INLINE void DeviceVal::DestroyDescriptorPool(DescriptorPool* descriptorPool)
 }
 
 NRI_INLINE void DeviceVal::DestroyBuffer(Buffer* buffer) {
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    ForgetBarrierIssues(buffer);
+#endif
+
     m_iCoreImpl.DestroyBuffer(NRI_GET_IMPL(Buffer, buffer));
     Destroy((BufferVal*)buffer);
 }
 
 NRI_INLINE void DeviceVal::DestroyTexture(Texture* texture) {
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    ForgetBarrierIssues(texture);
+#endif
+
     m_iCoreImpl.DestroyTexture(NRI_GET_IMPL(Texture, texture));
     Destroy((TextureVal*)texture);
 }
@@ -597,8 +694,10 @@ NRI_INLINE Result DeviceVal::CreateCommittedBuffer(MemoryLocation memoryLocation
     Result result = m_iCoreImpl.CreateCommittedBuffer(m_Impl, memoryLocation, priority, bufferDesc, bufferImpl);
 
     buffer = nullptr;
-    if (result == Result::SUCCESS)
+    if (result == Result::SUCCESS) {
         buffer = (Buffer*)Allocate<BufferVal>(GetAllocationCallbacks(), *this, bufferImpl, true);
+        ((BufferVal*)buffer)->SetMemoryLocation(memoryLocation);
+    }
 
     return result;
 }
@@ -711,9 +810,12 @@ NRI_INLINE Result DeviceVal::CreatePlacedBuffer(Memory* memory, uint64_t offset,
         buffer = (Buffer*)Allocate<BufferVal>(GetAllocationCallbacks(), *this, bufferImpl, !memory);
 
     // Update
-    if (buffer && memory) {
-        MemoryVal& memoryVal = *(MemoryVal*)memory;
-        memoryVal.Bind(*(BufferVal*)buffer);
+    if (buffer) {
+        if (memory) {
+            MemoryVal& memoryVal = *(MemoryVal*)memory;
+            memoryVal.Bind(*(BufferVal*)buffer);
+        } else
+            ((BufferVal*)buffer)->SetMemoryLocation((MemoryLocation)offset);
     }
 
     return result;
@@ -930,25 +1032,43 @@ NRI_INLINE void DeviceVal::CopyDescriptorRanges(const CopyDescriptorRangeDesc* c
         const DescriptorRangeDesc& dstRangeDesc = dstSetDesc.ranges[copyDescriptorSetDesc.dstRangeIndex];
         const DescriptorRangeDesc& srcRangeDesc = srcSetDesc.ranges[copyDescriptorSetDesc.srcRangeIndex];
 
+        uint32_t dstRangeDescriptorNum = dstSetVal.GetRangeDescriptorNum(copyDescriptorSetDesc.dstRangeIndex);
+        uint32_t srcRangeDescriptorNum = srcSetVal.GetRangeDescriptorNum(copyDescriptorSetDesc.srcRangeIndex);
+
+        // "ALL" means the allocated size, which is "variableDescriptorNum" for a "VARIABLE_SIZED_ARRAY" range
         uint32_t descriptorNum = copyDescriptorSetDesc.descriptorNum;
         if (descriptorNum == ALL)
-            descriptorNum = srcRangeDesc.descriptorNum;
+            descriptorNum = srcRangeDescriptorNum;
 
-        NRI_RETURN_ON_FAILURE(this, copyDescriptorSetDesc.dstBaseDescriptor + descriptorNum <= dstRangeDesc.descriptorNum, ReturnVoid(),
+        NRI_RETURN_ON_FAILURE(this, copyDescriptorSetDesc.dstBaseDescriptor + descriptorNum <= dstRangeDescriptorNum, ReturnVoid(),
             "'[%u].dstBaseDescriptor = %u + [%u].descriptorNum = %u' is greater than 'descriptorNum = %u' in the range (descriptorType=%s)",
-            i, copyDescriptorSetDesc.dstBaseDescriptor, i, descriptorNum, dstRangeDesc.descriptorNum, GetDescriptorTypeName(dstRangeDesc.descriptorType));
+            i, copyDescriptorSetDesc.dstBaseDescriptor, i, descriptorNum, dstRangeDescriptorNum, GetDescriptorTypeName(dstRangeDesc.descriptorType));
 
-        NRI_RETURN_ON_FAILURE(this, copyDescriptorSetDesc.srcBaseDescriptor + descriptorNum <= srcRangeDesc.descriptorNum, ReturnVoid(),
+        NRI_RETURN_ON_FAILURE(this, copyDescriptorSetDesc.srcBaseDescriptor + descriptorNum <= srcRangeDescriptorNum, ReturnVoid(),
             "'[%u].srcBaseDescriptor = %u + [%u].descriptorNum = %u' is greater than 'descriptorNum = %u' in the range (descriptorType=%s)",
-            i, copyDescriptorSetDesc.srcBaseDescriptor, i, descriptorNum, srcRangeDesc.descriptorNum, GetDescriptorTypeName(srcRangeDesc.descriptorType));
+            i, copyDescriptorSetDesc.srcBaseDescriptor, i, descriptorNum, srcRangeDescriptorNum, GetDescriptorTypeName(srcRangeDesc.descriptorType));
 
         auto& copyDescriptorSetDescImpl = copyDescriptorSetDescsImpl[i];
         copyDescriptorSetDescImpl = copyDescriptorSetDesc;
+        copyDescriptorSetDescImpl.descriptorNum = descriptorNum;
         copyDescriptorSetDescImpl.dstDescriptorSet = NRI_GET_IMPL(DescriptorSet, copyDescriptorSetDesc.dstDescriptorSet);
         copyDescriptorSetDescImpl.srcDescriptorSet = NRI_GET_IMPL(DescriptorSet, copyDescriptorSetDesc.srcDescriptorSet);
     }
 
     GetCoreInterfaceImpl().CopyDescriptorRanges(copyDescriptorSetDescsImpl, copyDescriptorRangeDescNum);
+
+    // Track contents for draw-time validation
+    for (uint32_t i = 0; i < copyDescriptorRangeDescNum; i++) {
+        const CopyDescriptorRangeDesc& copyDescriptorSetDesc = copyDescriptorRangeDescs[i];
+
+        DescriptorSetVal& dstSetVal = *(DescriptorSetVal*)copyDescriptorSetDesc.dstDescriptorSet;
+        const DescriptorSetVal& srcSetVal = *(DescriptorSetVal*)copyDescriptorSetDesc.srcDescriptorSet;
+
+        // Resolved above
+        uint32_t descriptorNum = copyDescriptorSetDescsImpl[i].descriptorNum;
+
+        dstSetVal.CopyDescriptors(copyDescriptorSetDesc.dstRangeIndex, copyDescriptorSetDesc.dstBaseDescriptor, srcSetVal, copyDescriptorSetDesc.srcRangeIndex, copyDescriptorSetDesc.srcBaseDescriptor, descriptorNum);
+    }
 }
 
 NRI_INLINE void DeviceVal::UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* updateDescriptorRangeDescs, uint32_t updateDescriptorRangeDescNum) {
@@ -971,9 +1091,10 @@ NRI_INLINE void DeviceVal::UpdateDescriptorRanges(const UpdateDescriptorRangeDes
 
         NRI_RETURN_ON_FAILURE(this, updateDescriptorRangeDesc.descriptorNum != 0, ReturnVoid(), "'[%u].descriptorNum' is 0", i);
         NRI_RETURN_ON_FAILURE(this, updateDescriptorRangeDesc.descriptors != nullptr, ReturnVoid(), "'[%u].descriptors' is NULL", i);
-        NRI_RETURN_ON_FAILURE(this, updateDescriptorRangeDesc.baseDescriptor + updateDescriptorRangeDesc.descriptorNum <= rangeDesc.descriptorNum, ReturnVoid(),
+        uint32_t rangeDescriptorNum = setVal.GetRangeDescriptorNum(updateDescriptorRangeDesc.rangeIndex);
+        NRI_RETURN_ON_FAILURE(this, updateDescriptorRangeDesc.baseDescriptor + updateDescriptorRangeDesc.descriptorNum <= rangeDescriptorNum, ReturnVoid(),
             "'[%u].baseDescriptor = %u + [%u].descriptorNum = %u' is greater than 'descriptorNum = %u' in the range (descriptorType=%s)",
-            i, updateDescriptorRangeDesc.baseDescriptor, i, updateDescriptorRangeDesc.descriptorNum, rangeDesc.descriptorNum, GetDescriptorTypeName(rangeDesc.descriptorType));
+            i, updateDescriptorRangeDesc.baseDescriptor, i, updateDescriptorRangeDesc.descriptorNum, rangeDescriptorNum, GetDescriptorTypeName(rangeDesc.descriptorType));
 
         auto& updateDescriptorRangeDescImpl = updateDescriptorRangeDescsImpl[i];
         updateDescriptorRangeDescImpl = updateDescriptorRangeDesc;
@@ -1000,6 +1121,14 @@ NRI_INLINE void DeviceVal::UpdateDescriptorRanges(const UpdateDescriptorRangeDes
     }
 
     GetCoreInterfaceImpl().UpdateDescriptorRanges(updateDescriptorRangeDescsImpl, updateDescriptorRangeDescNum);
+
+    // Track contents for draw-time validation
+    for (uint32_t i = 0; i < updateDescriptorRangeDescNum; i++) {
+        const UpdateDescriptorRangeDesc& updateDescriptorRangeDesc = updateDescriptorRangeDescs[i];
+        DescriptorSetVal& setVal = *(DescriptorSetVal*)updateDescriptorRangeDesc.descriptorSet;
+
+        setVal.UpdateDescriptors(updateDescriptorRangeDesc.rangeIndex, updateDescriptorRangeDesc.baseDescriptor, (const DescriptorVal* const*)updateDescriptorRangeDesc.descriptors, updateDescriptorRangeDesc.descriptorNum);
+    }
 }
 
 NRI_INLINE FormatSupportBits DeviceVal::GetFormatSupport(Format format) const {
@@ -1546,3 +1675,94 @@ NRI_INLINE void DeviceVal::DestroyMicromap(Micromap* micromap) {
     m_iRayTracingImpl.DestroyMicromap(NRI_GET_IMPL(Micromap, micromap));
     Destroy((MicromapVal*)micromap);
 }
+
+NRI_INLINE Result DeviceVal::CreateIndirectCommandLayout(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    NRI_RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.commands != nullptr, Result::INVALID_ARGUMENT, "'commands' is NULL");
+    NRI_RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.commandNum != 0, Result::INVALID_ARGUMENT, "'commandNum' is 0");
+    NRI_RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.stride != 0 && indirectCommandLayoutDesc.stride % 4 == 0, Result::INVALID_ARGUMENT, "'stride' must be a non-zero multiple of 4");
+    NRI_RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.shaderStages != StageBits::NONE, Result::INVALID_ARGUMENT, "'shaderStages' is NONE");
+
+    const PipelineLayoutVal* pipelineLayoutVal = (const PipelineLayoutVal*)indirectCommandLayoutDesc.pipelineLayout;
+    for (uint32_t i = 0; i < indirectCommandLayoutDesc.commandNum; i++) {
+        const IndirectCommandDesc& command = indirectCommandLayoutDesc.commands[i];
+        bool isLast = i == indirectCommandLayoutDesc.commandNum - 1;
+        bool isAction = command.type >= IndirectCommandType::DRAW;
+
+        NRI_RETURN_ON_FAILURE(this, command.type < IndirectCommandType::MAX_NUM, Result::INVALID_ARGUMENT, "'commands[%u].type' is invalid", i);
+        NRI_RETURN_ON_FAILURE(this, isAction == isLast, Result::INVALID_ARGUMENT, "'commands[%u]': an action command (a draw or a dispatch) must be the last one", i);
+        NRI_RETURN_ON_FAILURE(this, command.type != IndirectCommandType::EXECUTION_SET || i == 0, Result::INVALID_ARGUMENT, "'commands[%u]': 'EXECUTION_SET' must be the first command", i);
+        NRI_RETURN_ON_FAILURE(this, command.offset % 4 == 0 && command.offset < indirectCommandLayoutDesc.stride, Result::INVALID_ARGUMENT, "'commands[%u].offset' must be a multiple of 4 and less than 'stride'", i);
+
+        if (command.type == IndirectCommandType::ROOT_CONSTANTS) {
+            NRI_RETURN_ON_FAILURE(this, pipelineLayoutVal, Result::INVALID_ARGUMENT, "'pipelineLayout' is required for 'ROOT_CONSTANTS'");
+            NRI_RETURN_ON_FAILURE(this, command.rootConstantIndex < pipelineLayoutVal->GetPipelineLayoutDesc().rootConstantNum, Result::INVALID_ARGUMENT, "'commands[%u].rootConstantIndex' is out of bounds", i);
+        } else if (command.type == IndirectCommandType::DRAW_MESH_TASKS) {
+            NRI_RETURN_ON_FAILURE(this, m_Desc.features.meshShader, Result::INVALID_ARGUMENT, "'features.meshShader' is false");
+        } else if (command.type == IndirectCommandType::DISPATCH) {
+            NRI_RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.shaderStages == StageBits::COMPUTE_SHADER, Result::INVALID_ARGUMENT, "'shaderStages' must be 'COMPUTE_SHADER' for 'DISPATCH'");
+        }
+    }
+
+    for (uint32_t i = 0; i + 1 < indirectCommandLayoutDesc.commandNum; i++) {
+        IndirectCommandType type = indirectCommandLayoutDesc.commands[i].type;
+        bool isGraphicsOnly = type == IndirectCommandType::VERTEX_BUFFER || type == IndirectCommandType::INDEX_BUFFER;
+        NRI_RETURN_ON_FAILURE(this, !isGraphicsOnly || indirectCommandLayoutDesc.commands[indirectCommandLayoutDesc.commandNum - 1].type != IndirectCommandType::DISPATCH, Result::INVALID_ARGUMENT, "'commands[%u]' is not allowed with 'DISPATCH'", i);
+    }
+
+    auto indirectCommandLayoutDescImpl = indirectCommandLayoutDesc;
+    indirectCommandLayoutDescImpl.pipelineLayout = NRI_GET_IMPL(PipelineLayout, indirectCommandLayoutDesc.pipelineLayout);
+
+    IndirectCommandLayout* indirectCommandLayoutImpl = nullptr;
+    Result result = m_iDeviceGeneratedCommandsImpl.CreateIndirectCommandLayout(m_Impl, indirectCommandLayoutDescImpl, indirectCommandLayoutImpl);
+
+    indirectCommandLayout = nullptr;
+    if (result == Result::SUCCESS)
+        indirectCommandLayout = (IndirectCommandLayout*)Allocate<IndirectCommandLayoutVal>(GetAllocationCallbacks(), *this, indirectCommandLayoutImpl, indirectCommandLayoutDesc);
+
+    return result;
+}
+
+NRI_INLINE Result DeviceVal::CreateIndirectExecutionSet(const IndirectExecutionSetDesc& indirectExecutionSetDesc, IndirectExecutionSet*& indirectExecutionSet) {
+    const PipelineVal* initialPipelineVal = (const PipelineVal*)indirectExecutionSetDesc.initialPipeline;
+
+    NRI_RETURN_ON_FAILURE(this, initialPipelineVal, Result::INVALID_ARGUMENT, "'initialPipeline' is NULL");
+    NRI_RETURN_ON_FAILURE(this, initialPipelineVal->AllowsIndirectBinding(), Result::INVALID_ARGUMENT, "'initialPipeline' must be created with 'allowIndirectBinding = true'");
+    NRI_RETURN_ON_FAILURE(this, indirectExecutionSetDesc.pipelineMaxNum != 0, Result::INVALID_ARGUMENT, "'pipelineMaxNum' is 0");
+
+    auto indirectExecutionSetDescImpl = indirectExecutionSetDesc;
+    indirectExecutionSetDescImpl.initialPipeline = initialPipelineVal->GetImpl();
+
+    IndirectExecutionSet* indirectExecutionSetImpl = nullptr;
+    Result result = m_iDeviceGeneratedCommandsImpl.CreateIndirectExecutionSet(m_Impl, indirectExecutionSetDescImpl, indirectExecutionSetImpl);
+
+    indirectExecutionSet = nullptr;
+    if (result == Result::SUCCESS)
+        indirectExecutionSet = (IndirectExecutionSet*)Allocate<IndirectExecutionSetVal>(GetAllocationCallbacks(), *this, indirectExecutionSetImpl, indirectExecutionSetDesc.pipelineMaxNum);
+
+    return result;
+}
+
+NRI_INLINE uint64_t DeviceVal::GetIndirectCommandsPreprocessBufferSize(const IndirectCommandsPreprocessDesc& indirectCommandsPreprocessDesc) const {
+    const IndirectCommandLayoutVal* indirectCommandLayoutVal = (const IndirectCommandLayoutVal*)indirectCommandsPreprocessDesc.indirectCommandLayout;
+
+    NRI_RETURN_ON_FAILURE(this, indirectCommandLayoutVal, 0, "'indirectCommandLayout' is NULL");
+    NRI_RETURN_ON_FAILURE(this, !indirectCommandLayoutVal->HasExecutionSet() || indirectCommandsPreprocessDesc.indirectExecutionSet, 0, "'indirectExecutionSet' is required for 'EXECUTION_SET'");
+    NRI_RETURN_ON_FAILURE(this, indirectCommandsPreprocessDesc.indirectExecutionSet || indirectCommandsPreprocessDesc.pipeline, 0, "'pipeline' is required if 'indirectExecutionSet' is not provided");
+
+    auto indirectCommandsPreprocessDescImpl = indirectCommandsPreprocessDesc;
+    indirectCommandsPreprocessDescImpl.indirectCommandLayout = indirectCommandLayoutVal->GetImpl();
+    indirectCommandsPreprocessDescImpl.indirectExecutionSet = NRI_GET_IMPL(IndirectExecutionSet, indirectCommandsPreprocessDesc.indirectExecutionSet);
+    indirectCommandsPreprocessDescImpl.pipeline = NRI_GET_IMPL(Pipeline, indirectCommandsPreprocessDesc.pipeline);
+
+    return m_iDeviceGeneratedCommandsImpl.GetIndirectCommandsPreprocessBufferSize(m_Impl, indirectCommandsPreprocessDescImpl);
+}
+
+NRI_INLINE void DeviceVal::DestroyIndirectCommandLayout(IndirectCommandLayout* indirectCommandLayout) {
+    m_iDeviceGeneratedCommandsImpl.DestroyIndirectCommandLayout(NRI_GET_IMPL(IndirectCommandLayout, indirectCommandLayout));
+    Destroy((IndirectCommandLayoutVal*)indirectCommandLayout);
+}
+
+NRI_INLINE void DeviceVal::DestroyIndirectExecutionSet(IndirectExecutionSet* indirectExecutionSet) {
+    m_iDeviceGeneratedCommandsImpl.DestroyIndirectExecutionSet(NRI_GET_IMPL(IndirectExecutionSet, indirectExecutionSet));
+    Destroy((IndirectExecutionSetVal*)indirectExecutionSet);
+}
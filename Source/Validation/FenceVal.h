@@ -5,23 +5,27 @@
 namespace nri {
 
 struct FenceVal final : public ObjectVal {
-    inline FenceVal(DeviceVal& device, Fence* fence)
-        : ObjectVal(device, fence) {
-    }
-
-    inline ~FenceVal() {
-    }
+    FenceVal(DeviceVal& device, Fence* fence);
+    ~FenceVal();
 
     inline Fence* GetImpl() const {
         return (Fence*)m_Impl;
     }
 
+    // Unique for the device lifetime, unlike the address
+    inline uint64_t GetUid() const {
+        return m_Uid;
+    }
+
     //================================================================================================================
     // NRI
     //================================================================================================================
 
     uint64_t GetFenceValue() const;
     void Wait(uint64_t value);
+
+private:
+    uint64_t m_Uid = 0;
 };
 
 } // namespace nri
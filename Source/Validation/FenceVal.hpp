@@ -1,5 +1,14 @@
 // © 2021 NVIDIA Corporation
 
+FenceVal::FenceVal(DeviceVal& device, Fence* fence)
+    : ObjectVal(device, fence) {
+    m_Uid = m_Device.RegisterFence(*this);
+}
+
+FenceVal::~FenceVal() {
+    m_Device.UnregisterFence(m_Uid);
+}
+
 NRI_INLINE uint64_t FenceVal::GetFenceValue() const {
     return GetCoreInterfaceImpl().GetFenceValue(*GetImpl());
 }
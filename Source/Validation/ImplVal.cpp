@@ -11,6 +11,8 @@
 #include "DescriptorVal.h"
 #include "DeviceVal.h"
 #include "FenceVal.h"
+#include "IndirectCommandLayoutVal.h"
+#include "IndirectExecutionSetVal.h"
 #include "MemoryVal.h"
 #include "MicromapVal.h"
 #include "PipelineLayoutVal.h"
@@ -37,6 +39,8 @@ using namespace nri;
 #include "DescriptorVal.hpp"
 #include "DeviceVal.hpp"
 #include "FenceVal.hpp"
+#include "IndirectCommandLayoutVal.hpp"
+#include "IndirectExecutionSetVal.hpp"
 #include "MemoryVal.hpp"
 #include "MicromapVal.hpp"
 #include "PipelineLayoutVal.hpp"
@@ -61,141 +65,230 @@ DeviceBase* CreateDeviceValidation(const DeviceCreationDesc& desc, DeviceBase& d
 #pragma region[  Core  ]
 
 static const DeviceDesc& NRI_CALL GetDeviceDesc(const Device& device) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, GetDeviceDesc);
+
     return ((DeviceVal&)device).GetDesc();
 }
 
 static const BufferDesc& NRI_CALL GetBufferDesc(const Buffer& buffer) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(buffer), GetBufferDesc);
+
     return ((BufferVal&)buffer).GetDesc();
 }
 
 static const TextureDesc& NRI_CALL GetTextureDesc(const Texture& texture) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(texture), GetTextureDesc);
+
     return ((TextureVal&)texture).GetDesc();
 }
 
 static FormatSupportBits NRI_CALL GetFormatSupport(const Device& device, Format format) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, GetFormatSupport);
+
     return ((DeviceVal&)device).GetFormatSupport(format);
 }
 
 static Result NRI_CALL GetQueue(Device& device, QueueType queueType, uint32_t queueIndex, Queue*& queue) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, GetQueue);
+
     return ((DeviceVal&)device).GetQueue(queueType, queueIndex, queue);
 }
 
 static Result NRI_CALL CreateCommandAllocator(Queue& queue, CommandAllocator*& commandAllocator) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(queue), CreateCommandAllocator);
+
     return GetDeviceVal(queue).CreateCommandAllocator(queue, commandAllocator);
 }
 
 static Result NRI_CALL CreateCommandBuffer(CommandAllocator& commandAllocator, CommandBuffer*& commandBuffer) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandAllocator), CreateCommandBuffer);
+
     return ((CommandAllocatorVal&)commandAllocator).CreateCommandBuffer(commandBuffer);
 }
 
+static Result NRI_CALL CreateReusableCommandBuffer(CommandAllocator& commandAllocator, const ReusableCommandBufferDesc& reusableCommandBufferDesc, CommandBuffer*& commandBuffer) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandAllocator), CreateReusableCommandBuffer);
+
+    return ((CommandAllocatorVal&)commandAllocator).CreateReusableCommandBuffer(reusableCommandBufferDesc, commandBuffer);
+}
+
+static Result NRI_CALL CreateCommandBuffers(CommandAllocator& commandAllocator, CommandBuffer** commandBuffers, uint32_t commandBufferNum) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandAllocator), CreateCommandBuffers);
+
+    return ((CommandAllocatorVal&)commandAllocator).CreateCommandBuffers(commandBuffers, commandBufferNum);
+}
+
+static Result NRI_CALL CreateCommandBundle(CommandAllocator& commandAllocator, const CommandBundleDesc& commandBundleDesc, CommandBuffer*& commandBundle) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandAllocator), CreateCommandBundle);
+
+    return ((CommandAllocatorVal&)commandAllocator).CreateCommandBundle(commandBundleDesc, commandBundle);
+}
+
 static Result NRI_CALL CreateFence(Device& device, uint64_t initialValue, Fence*& fence) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateFence);
+
     return ((DeviceVal&)device).CreateFence(initialValue, fence);
 }
 
 static Result NRI_CALL CreateDescriptorPool(Device& device, const DescriptorPoolDesc& descriptorPoolDesc, DescriptorPool*& descriptorPool) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateDescriptorPool);
+
     return ((DeviceVal&)device).CreateDescriptorPool(descriptorPoolDesc, descriptorPool);
 }
 
 static Result NRI_CALL CreatePipelineLayout(Device& device, const PipelineLayoutDesc& pipelineLayoutDesc, PipelineLayout*& pipelineLayout) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreatePipelineLayout);
+
     return ((DeviceVal&)device).CreatePipelineLayout(pipelineLayoutDesc, pipelineLayout);
 }
 
 static Result NRI_CALL CreateGraphicsPipeline(Device& device, const GraphicsPipelineDesc& graphicsPipelineDesc, Pipeline*& pipeline) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateGraphicsPipeline);
+
     return ((DeviceVal&)device).CreatePipeline(graphicsPipelineDesc, pipeline);
 }
 
 static Result NRI_CALL CreateComputePipeline(Device& device, const ComputePipelineDesc& computePipelineDesc, Pipeline*& pipeline) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateComputePipeline);
+
     return ((DeviceVal&)device).CreatePipeline(computePipelineDesc, pipeline);
 }
 
 static Result NRI_CALL CreateQueryPool(Device& device, const QueryPoolDesc& queryPoolDesc, QueryPool*& queryPool) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateQueryPool);
+
     return ((DeviceVal&)device).CreateQueryPool(queryPoolDesc, queryPool);
 }
 
 static Result NRI_CALL CreateSampler(Device& device, const SamplerDesc& samplerDesc, Descriptor*& sampler) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateSampler);
+
     return ((DeviceVal&)device).CreateDescriptor(samplerDesc, sampler);
 }
 
 static Result NRI_CALL CreateBufferView(const BufferViewDesc& bufferViewDesc, Descriptor*& bufferView) {
     DeviceVal& device = GetDeviceVal(*bufferViewDesc.buffer);
+    NRI_PROFILE_ENTRY_POINT(device, CreateBufferView);
 
     return device.CreateDescriptor(bufferViewDesc, bufferView);
 }
 
 static Result NRI_CALL CreateTextureView(const TextureViewDesc& textureViewDesc, Descriptor*& textureView) {
     DeviceVal& device = GetDeviceVal(*textureViewDesc.texture);
+    NRI_PROFILE_ENTRY_POINT(device, CreateTextureView);
 
     return device.CreateDescriptor(textureViewDesc, textureView);
 }
 
 static void NRI_CALL DestroyCommandAllocator(CommandAllocator* commandAllocator) {
-    if (commandAllocator)
+    if (commandAllocator) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*commandAllocator), DestroyCommandAllocator);
+
         GetDeviceVal(*commandAllocator).DestroyCommandAllocator(commandAllocator);
+    }
 }
 
 static void NRI_CALL DestroyCommandBuffer(CommandBuffer* commandBuffer) {
-    if (commandBuffer)
+    if (commandBuffer) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*commandBuffer), DestroyCommandBuffer);
+
         GetDeviceVal(*commandBuffer).DestroyCommandBuffer(commandBuffer);
+    }
 }
 
 static void NRI_CALL DestroyDescriptorPool(DescriptorPool* descriptorPool) {
-    if (descriptorPool)
+    if (descriptorPool) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*descriptorPool), DestroyDescriptorPool);
+
         GetDeviceVal(*descriptorPool).DestroyDescriptorPool(descriptorPool);
+    }
 }
 
 static void NRI_CALL DestroyBuffer(Buffer* buffer) {
-    if (buffer)
+    if (buffer) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*buffer), DestroyBuffer);
+
         GetDeviceVal(*buffer).DestroyBuffer(buffer);
+    }
 }
 
 static void NRI_CALL DestroyTexture(Texture* texture) {
-    if (texture)
+    if (texture) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*texture), DestroyTexture);
+
         GetDeviceVal(*texture).DestroyTexture(texture);
+    }
 }
 
 static void NRI_CALL DestroyDescriptor(Descriptor* descriptor) {
-    if (descriptor)
+    if (descriptor) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*descriptor), DestroyDescriptor);
+
         GetDeviceVal(*descriptor).DestroyDescriptor(descriptor);
+    }
 }
 
 static void NRI_CALL DestroyPipelineLayout(PipelineLayout* pipelineLayout) {
-    if (pipelineLayout)
+    if (pipelineLayout) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*pipelineLayout), DestroyPipelineLayout);
+
         GetDeviceVal(*pipelineLayout).DestroyPipelineLayout(pipelineLayout);
+    }
 }
 
 static void NRI_CALL DestroyPipeline(Pipeline* pipeline) {
-    if (pipeline)
+    if (pipeline) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*pipeline), DestroyPipeline);
+
         GetDeviceVal(*pipeline).DestroyPipeline(pipeline);
+    }
 }
 
 static void NRI_CALL DestroyQueryPool(QueryPool* queryPool) {
-    if (queryPool)
+    if (queryPool) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*queryPool), DestroyQueryPool);
+
         GetDeviceVal(*queryPool).DestroyQueryPool(queryPool);
+    }
 }
 
 static void NRI_CALL DestroyFence(Fence* fence) {
-    if (fence)
+    if (fence) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*fence), DestroyFence);
+
         GetDeviceVal(*fence).DestroyFence(fence);
+    }
 }
 
 static Result NRI_CALL AllocateMemory(Device& device, const AllocateMemoryDesc& allocateMemoryDesc, Memory*& memory) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, AllocateMemory);
+
     return ((DeviceVal&)device).AllocateMemory(allocateMemoryDesc, memory);
 }
 
 static void NRI_CALL FreeMemory(Memory* memory) {
-    if (memory)
+    if (memory) {
+        NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*memory), FreeMemory);
+
         GetDeviceVal(*memory).FreeMemory(memory);
+    }
 }
 
 static Result NRI_CALL CreateBuffer(Device& device, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateBuffer);
+
     return ((DeviceVal&)device).CreateBuffer(bufferDesc, buffer);
 }
 
 static Result NRI_CALL CreateTexture(Device& device, const TextureDesc& textureDesc, Texture*& texture) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateTexture);
+
     return ((DeviceVal&)device).CreateTexture(textureDesc, texture);
 }
 
 static void NRI_CALL GetBufferMemoryDesc(const Buffer& buffer, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(buffer), GetBufferMemoryDesc);
+
     const BufferVal& bufferVal = (BufferVal&)buffer;
     DeviceVal& deviceVal = bufferVal.GetDevice();
 
@@ -204,6 +297,8 @@ static void NRI_CALL GetBufferMemoryDesc(const Buffer& buffer, MemoryLocation me
 }
 
 static void NRI_CALL GetTextureMemoryDesc(const Texture& texture, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(texture), GetTextureMemoryDesc);
+
     const TextureVal& bufferVal = (TextureVal&)texture;
     DeviceVal& deviceVal = bufferVal.GetDevice();
 
@@ -219,6 +314,8 @@ static Result NRI_CALL BindBufferMemory(const BindBufferMemoryDesc* bindBufferMe
         return Result::INVALID_ARGUMENT;
 
     DeviceVal& deviceVal = ((BufferVal*)bindBufferMemoryDescs->buffer)->GetDevice();
+    NRI_PROFILE_ENTRY_POINT(deviceVal, BindBufferMemory);
+
     return deviceVal.BindBufferMemory(bindBufferMemoryDescs, bindBufferMemoryDescNum);
 }
 
@@ -230,38 +327,54 @@ static Result NRI_CALL BindTextureMemory(const BindTextureMemoryDesc* bindTextur
         return Result::INVALID_ARGUMENT;
 
     DeviceVal& deviceVal = ((TextureVal*)bindTextureMemoryDescs->texture)->GetDevice();
+    NRI_PROFILE_ENTRY_POINT(deviceVal, BindTextureMemory);
+
     return deviceVal.BindTextureMemory(bindTextureMemoryDescs, bindTextureMemoryDescNum);
 }
 
 static void NRI_CALL GetBufferMemoryDesc2(const Device& device, const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, GetBufferMemoryDesc2);
+
     DeviceVal& deviceVal = (DeviceVal&)device;
     deviceVal.GetCoreInterfaceImpl().GetBufferMemoryDesc2(deviceVal.GetImpl(), bufferDesc, memoryLocation, memoryDesc);
     deviceVal.RegisterMemoryType(memoryDesc.type, memoryLocation);
 }
 
 static void NRI_CALL GetTextureMemoryDesc2(const Device& device, const TextureDesc& textureDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, GetTextureMemoryDesc2);
+
     DeviceVal& deviceVal = (DeviceVal&)device;
     deviceVal.GetCoreInterfaceImpl().GetTextureMemoryDesc2(deviceVal.GetImpl(), textureDesc, memoryLocation, memoryDesc);
     deviceVal.RegisterMemoryType(memoryDesc.type, memoryLocation);
 }
 
 static Result NRI_CALL CreateCommittedBuffer(Device& device, MemoryLocation memoryLocation, float priority, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateCommittedBuffer);
+
     return ((DeviceVal&)device).CreateCommittedBuffer(memoryLocation, priority, bufferDesc, buffer);
 }
 
 static Result NRI_CALL CreateCommittedTexture(Device& device, MemoryLocation memoryLocation, float priority, const TextureDesc& textureDesc, Texture*& texture) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreateCommittedTexture);
+
     return ((DeviceVal&)device).CreateCommittedTexture(memoryLocation, priority, textureDesc, texture);
 }
 
 static Result NRI_CALL CreatePlacedBuffer(Device& device, Memory* memory, uint64_t offset, const BufferDesc& bufferDesc, Buffer*& buffer) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreatePlacedBuffer);
+
     return ((DeviceVal&)device).CreatePlacedBuffer(memory, offset, bufferDesc, buffer);
 }
 
 static Result NRI_CALL CreatePlacedTexture(Device& device, Memory* memory, uint64_t offset, const TextureDesc& textureDesc, Texture*& texture) {
+    NRI_PROFILE_ENTRY_POINT((DeviceVal&)device, CreatePlacedTexture);
+
     return ((DeviceVal&)device).CreatePlacedTexture(memory, offset, textureDesc, texture);
 }
 
 static Result NRI_CALL AllocateDescriptorSets(DescriptorPool& descriptorPool, const PipelineLayout& pipelineLayout, uint32_t setIndex, DescriptorSet** descriptorSets, uint32_t instanceNum, uint32_t variableDescriptorNum) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(descriptorPool), AllocateDescriptorSets);
+
     return ((DescriptorPoolVal&)descriptorPool).AllocateDescriptorSets(pipelineLayout, setIndex, descriptorSets, instanceNum, variableDescriptorNum);
 }
 
@@ -272,6 +385,8 @@ static void NRI_CALL UpdateDescriptorRanges(const UpdateDescriptorRangeDesc* upd
     NRI_CHECK(updateDescriptorRangeDescs && updateDescriptorRangeDescs->descriptorSet, "Invalid argument!");
 
     DeviceVal& deviceVal = ((DescriptorSetVal*)updateDescriptorRangeDescs->descriptorSet)->GetDevice();
+    NRI_PROFILE_ENTRY_POINT(deviceVal, UpdateDescriptorRanges);
+
     return deviceVal.UpdateDescriptorRanges(updateDescriptorRangeDescs, updateDescriptorRangeDescNum);
 }
 
@@ -282,206 +397,326 @@ static void NRI_CALL CopyDescriptorRanges(const CopyDescriptorRangeDesc* copyDes
     NRI_CHECK(copyDescriptorRangeDescs && copyDescriptorRangeDescs->dstDescriptorSet, "Invalid argument!");
 
     DeviceVal& deviceVal = ((DescriptorSetVal*)copyDescriptorRangeDescs->dstDescriptorSet)->GetDevice();
+    NRI_PROFILE_ENTRY_POINT(deviceVal, CopyDescriptorRanges);
+
     return deviceVal.CopyDescriptorRanges(copyDescriptorRangeDescs, copyDescriptorRangeDescNum);
 }
 
 static void NRI_CALL GetDescriptorSetOffsets(const DescriptorSet& descriptorSet, uint32_t& resourceHeapOffset, uint32_t& samplerHeapOffset) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(descriptorSet), GetDescriptorSetOffsets);
+
     ((DescriptorSetVal&)descriptorSet).GetOffsets(resourceHeapOffset, samplerHeapOffset);
 }
 
 static void NRI_CALL ResetDescriptorPool(DescriptorPool& descriptorPool) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(descriptorPool), ResetDescriptorPool);
+
     ((DescriptorPoolVal&)descriptorPool).Reset();
 }
 
 static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), BeginCommandBuffer);
+
     return ((CommandBufferVal&)commandBuffer).Begin(descriptorPool);
 }
 
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetDescriptorPool);
+
     ((CommandBufferVal&)commandBuffer).SetDescriptorPool(descriptorPool);
 }
 
 static void NRI_CALL CmdSetPipelineLayout(CommandBuffer& commandBuffer, BindPoint bindPoint, const PipelineLayout& pipelineLayout) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetPipelineLayout);
+
     ((CommandBufferVal&)commandBuffer).SetPipelineLayout(bindPoint, pipelineLayout);
 }
 
 static void NRI_CALL CmdSetDescriptorSet(CommandBuffer& commandBuffer, const SetDescriptorSetDesc& setDescriptorSetDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetDescriptorSet);
+
     ((CommandBufferVal&)commandBuffer).SetDescriptorSet(setDescriptorSetDesc);
 }
 
 static void NRI_CALL CmdSetRootConstants(CommandBuffer& commandBuffer, const SetRootConstantsDesc& setRootConstantsDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetRootConstants);
+
     ((CommandBufferVal&)commandBuffer).SetRootConstants(setRootConstantsDesc);
 }
 
 static void NRI_CALL CmdSetRootDescriptor(CommandBuffer& commandBuffer, const SetRootDescriptorDesc& setRootDescriptorDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetRootDescriptor);
+
     ((CommandBufferVal&)commandBuffer).SetRootDescriptor(setRootDescriptorDesc);
 }
 
 static void NRI_CALL CmdSetPipeline(CommandBuffer& commandBuffer, const Pipeline& pipeline) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetPipeline);
+
     ((CommandBufferVal&)commandBuffer).SetPipeline(pipeline);
 }
 
 static void NRI_CALL CmdBarrier(CommandBuffer& commandBuffer, const BarrierDesc& barrierDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdBarrier);
+
     ((CommandBufferVal&)commandBuffer).Barrier(barrierDesc);
 }
 
 static void NRI_CALL CmdSetIndexBuffer(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, IndexType indexType) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetIndexBuffer);
+
     ((CommandBufferVal&)commandBuffer).SetIndexBuffer(buffer, offset, indexType);
 }
 
 static void NRI_CALL CmdSetVertexBuffers(CommandBuffer& commandBuffer, uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetVertexBuffers);
+
     ((CommandBufferVal&)commandBuffer).SetVertexBuffers(baseSlot, vertexBufferDescs, vertexBufferNum);
 }
 
 static void NRI_CALL CmdSetViewports(CommandBuffer& commandBuffer, const Viewport* viewports, uint32_t viewportNum) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetViewports);
+
     ((CommandBufferVal&)commandBuffer).SetViewports(viewports, viewportNum);
 }
 
 static void NRI_CALL CmdSetScissors(CommandBuffer& commandBuffer, const Rect* rects, uint32_t rectNum) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetScissors);
+
     ((CommandBufferVal&)commandBuffer).SetScissors(rects, rectNum);
 }
 
 static void NRI_CALL CmdSetStencilReference(CommandBuffer& commandBuffer, uint8_t frontRef, uint8_t backRef) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetStencilReference);
+
     ((CommandBufferVal&)commandBuffer).SetStencilReference(frontRef, backRef);
 }
 
 static void NRI_CALL CmdSetDepthBounds(CommandBuffer& commandBuffer, float boundsMin, float boundsMax) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetDepthBounds);
+
     ((CommandBufferVal&)commandBuffer).SetDepthBounds(boundsMin, boundsMax);
 }
 
 static void NRI_CALL CmdSetBlendConstants(CommandBuffer& commandBuffer, const Color32f& color) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetBlendConstants);
+
     ((CommandBufferVal&)commandBuffer).SetBlendConstants(color);
 }
 
 static void NRI_CALL CmdSetSampleLocations(CommandBuffer& commandBuffer, const SampleLocation* locations, Sample_t locationNum, Sample_t sampleNum) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetSampleLocations);
+
     ((CommandBufferVal&)commandBuffer).SetSampleLocations(locations, locationNum, sampleNum);
 }
 
 static void NRI_CALL CmdSetShadingRate(CommandBuffer& commandBuffer, const ShadingRateDesc& shadingRateDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetShadingRate);
+
     ((CommandBufferVal&)commandBuffer).SetShadingRate(shadingRateDesc);
 }
 
 static void NRI_CALL CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBiasDesc& depthBiasDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdSetDepthBias);
+
     ((CommandBufferVal&)commandBuffer).SetDepthBias(depthBiasDesc);
 }
 
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const RenderingDesc& renderingDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdBeginRendering);
+
     ((CommandBufferVal&)commandBuffer).BeginRendering(renderingDesc);
 }
 
 static void NRI_CALL CmdClearAttachments(CommandBuffer& commandBuffer, const ClearAttachmentDesc* clearAttachmentDescs, uint32_t clearAttachmentDescNum, const Rect* rects, uint32_t rectNum) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdClearAttachments);
+
     ((CommandBufferVal&)commandBuffer).ClearAttachments(clearAttachmentDescs, clearAttachmentDescNum, rects, rectNum);
 }
 
 static void NRI_CALL CmdDraw(CommandBuffer& commandBuffer, const DrawDesc& drawDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdDraw);
+
     ((CommandBufferVal&)commandBuffer).Draw(drawDesc);
 }
 
 static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawIndexedDesc& drawIndexedDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdDrawIndexed);
+
     ((CommandBufferVal&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawDescNum) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdDrawMulti);
+
+    ((CommandBufferVal&)commandBuffer).DrawMulti(drawDescs, drawDescNum);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawIndexedDescNum) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdDrawIndexedMulti);
+
+    ((CommandBufferVal&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawIndexedDescNum);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdDrawIndirect);
+
     ((CommandBufferVal&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
 
 static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdDrawIndexedIndirect);
+
     ((CommandBufferVal&)commandBuffer).DrawIndexedIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
 
 static void NRI_CALL CmdEndRendering(CommandBuffer& commandBuffer) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdEndRendering);
+
     ((CommandBufferVal&)commandBuffer).EndRendering();
 }
 
+static void NRI_CALL CmdExecuteBundle(CommandBuffer& commandBuffer, const CommandBuffer& commandBundle) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdExecuteBundle);
+
+    ((CommandBufferVal&)commandBuffer).ExecuteBundle(commandBundle);
+}
+
 static void NRI_CALL CmdDispatch(CommandBuffer& commandBuffer, const DispatchDesc& dispatchDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdDispatch);
+
     ((CommandBufferVal&)commandBuffer).Dispatch(dispatchDesc);
 }
 
 static void NRI_CALL CmdDispatchIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdDispatchIndirect);
+
     ((CommandBufferVal&)commandBuffer).DispatchIndirect(buffer, offset);
 }
 
 static void NRI_CALL CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdCopyBuffer);
+
     ((CommandBufferVal&)commandBuffer).CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
 }
 
 static void NRI_CALL CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdCopyTexture);
+
     ((CommandBufferVal&)commandBuffer).CopyTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
 
 static void NRI_CALL CmdUploadBufferToTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdUploadBufferToTexture);
+
     ((CommandBufferVal&)commandBuffer).UploadBufferToTexture(dstTexture, dstRegion, srcBuffer, srcDataLayout);
 }
 
 static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdReadbackTextureToBuffer);
+
     ((CommandBufferVal&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
 static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdZeroBuffer);
+
     ((CommandBufferVal&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
 
 static void NRI_CALL CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion, ResolveOp resolveOp) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdResolveTexture);
+
     ((CommandBufferVal&)commandBuffer).ResolveTexture(dstTexture, dstRegion, srcTexture, srcRegion, resolveOp);
 }
 
 static void NRI_CALL CmdClearStorage(CommandBuffer& commandBuffer, const ClearStorageDesc& clearStorageDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdClearStorage);
+
     ((CommandBufferVal&)commandBuffer).ClearStorage(clearStorageDesc);
 }
 
 static void NRI_CALL CmdResetQueries(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset, uint32_t num) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdResetQueries);
+
     ((CommandBufferVal&)commandBuffer).ResetQueries(queryPool, offset, num);
 }
 
 static void NRI_CALL CmdBeginQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdBeginQuery);
+
     ((CommandBufferVal&)commandBuffer).BeginQuery(queryPool, offset);
 }
 
 static void NRI_CALL CmdEndQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdEndQuery);
+
     ((CommandBufferVal&)commandBuffer).EndQuery(queryPool, offset);
 }
 
 static void NRI_CALL CmdCopyQueries(CommandBuffer& commandBuffer, const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdCopyQueries);
+
     ((CommandBufferVal&)commandBuffer).CopyQueries(queryPool, offset, num, dstBuffer, dstOffset);
 }
 
 static void NRI_CALL CmdBeginAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdBeginAnnotation);
+
     ((CommandBufferVal&)commandBuffer).BeginAnnotation(name, bgra);
 }
 
 static void NRI_CALL CmdEndAnnotation(CommandBuffer& commandBuffer) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdEndAnnotation);
+
     ((CommandBufferVal&)commandBuffer).EndAnnotation();
 }
 
 static void NRI_CALL CmdAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), CmdAnnotation);
+
     ((CommandBufferVal&)commandBuffer).Annotation(name, bgra);
 }
 
 static Result NRI_CALL EndCommandBuffer(CommandBuffer& commandBuffer) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandBuffer), EndCommandBuffer);
+
     return ((CommandBufferVal&)commandBuffer).End();
 }
 
 static void NRI_CALL QueueBeginAnnotation(Queue& queue, const char* name, uint32_t bgra) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(queue), QueueBeginAnnotation);
+
     ((QueueVal&)queue).BeginAnnotation(name, bgra);
 }
 
 static void NRI_CALL QueueEndAnnotation(Queue& queue) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(queue), QueueEndAnnotation);
+
     ((QueueVal&)queue).EndAnnotation();
 }
 
 static void NRI_CALL QueueAnnotation(Queue& queue, const char* name, uint32_t bgra) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(queue), QueueAnnotation);
+
     ((QueueVal&)queue).Annotation(name, bgra);
 }
 
 static void NRI_CALL ResetQueries(QueryPool& queryPool, uint32_t offset, uint32_t num) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(queryPool), ResetQueries);
+
     ((QueryPoolVal&)queryPool).ResetQueries(offset, num);
 }
 
 static uint32_t NRI_CALL GetQuerySize(const QueryPool& queryPool) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(queryPool), GetQuerySize);
+
     return ((QueryPoolVal&)queryPool).GetQuerySize();
 }
 
 static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSubmitDesc) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(queue), QueueSubmit);
+
     return ((QueueVal&)queue).Submit(queueSubmitDesc);
 }
 
@@ -489,6 +724,8 @@ static Result NRI_CALL QueueWaitIdle(Queue* queue) {
     if (!queue)
         return Result::SUCCESS;
 
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(*queue), QueueWaitIdle);
+
     return ((QueueVal*)queue)->WaitIdle();
 }
 
@@ -496,30 +733,44 @@ static Result NRI_CALL DeviceWaitIdle(Device* device) {
     if (!device)
         return Result::SUCCESS;
 
+    NRI_PROFILE_ENTRY_POINT(*(DeviceVal*)device, DeviceWaitIdle);
+
     return ((DeviceVal*)device)->WaitIdle();
 }
 
 static void NRI_CALL Wait(Fence& fence, uint64_t value) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(fence), Wait);
+
     ((FenceVal&)fence).Wait(value);
 }
 
 static uint64_t NRI_CALL GetFenceValue(Fence& fence) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(fence), GetFenceValue);
+
     return ((FenceVal&)fence).GetFenceValue();
 }
 
 static void NRI_CALL ResetCommandAllocator(CommandAllocator& commandAllocator) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(commandAllocator), ResetCommandAllocator);
+
     ((CommandAllocatorVal&)commandAllocator).Reset();
 }
 
 static void* NRI_CALL MapBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(buffer), MapBuffer);
+
     return ((BufferVal&)buffer).Map(offset, size);
 }
 
 static void NRI_CALL UnmapBuffer(Buffer& buffer) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(buffer), UnmapBuffer);
+
     ((BufferVal&)buffer).Unmap();
 }
 
 static uint64_t NRI_CALL GetBufferDeviceAddress(const Buffer& buffer) {
+    NRI_PROFILE_ENTRY_POINT(GetDeviceVal(buffer), GetBufferDeviceAddress);
+
     return ((BufferVal&)buffer).GetDeviceAddress();
 }
 
@@ -583,6 +834,9 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateCommandBundle = ::CreateCommandBundle;
+    table.CreateReusableCommandBuffer = ::CreateReusableCommandBuffer;
+    table.CreateCommandBuffers = ::CreateCommandBuffers;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTextureView = ::CreateTextureView;
@@ -642,9 +896,12 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
+    table.CmdExecuteBundle = ::CmdExecuteBundle;
     table.CmdDispatch = ::CmdDispatch;
     table.CmdDispatchIndirect = ::CmdDispatchIndirect;
     table.CmdCopyBuffer = ::CmdCopyBuffer;
@@ -687,6 +944,56 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  Device generated commands  ]
+
+static Result NRI_CALL CreateIndirectCommandLayout(Device& device, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    return ((DeviceVal&)device).CreateIndirectCommandLayout(indirectCommandLayoutDesc, indirectCommandLayout);
+}
+
+static Result NRI_CALL CreateIndirectExecutionSet(Device& device, const IndirectExecutionSetDesc& indirectExecutionSetDesc, IndirectExecutionSet*& indirectExecutionSet) {
+    return ((DeviceVal&)device).CreateIndirectExecutionSet(indirectExecutionSetDesc, indirectExecutionSet);
+}
+
+static uint64_t NRI_CALL GetIndirectCommandsPreprocessBufferSize(const Device& device, const IndirectCommandsPreprocessDesc& indirectCommandsPreprocessDesc) {
+    return ((DeviceVal&)device).GetIndirectCommandsPreprocessBufferSize(indirectCommandsPreprocessDesc);
+}
+
+static void NRI_CALL UpdateIndirectExecutionSet(IndirectExecutionSet& indirectExecutionSet, uint32_t baseIndex, const Pipeline* const* pipelines, uint32_t pipelineNum) {
+    ((IndirectExecutionSetVal&)indirectExecutionSet).Update(baseIndex, pipelines, pipelineNum);
+}
+
+static void NRI_CALL DestroyIndirectCommandLayout(IndirectCommandLayout* indirectCommandLayout) {
+    if (indirectCommandLayout)
+        GetDeviceVal(*indirectCommandLayout).DestroyIndirectCommandLayout(indirectCommandLayout);
+}
+
+static void NRI_CALL DestroyIndirectExecutionSet(IndirectExecutionSet* indirectExecutionSet) {
+    if (indirectExecutionSet)
+        GetDeviceVal(*indirectExecutionSet).DestroyIndirectExecutionSet(indirectExecutionSet);
+}
+
+static void NRI_CALL CmdExecuteIndirectCommands(CommandBuffer& commandBuffer, const ExecuteIndirectCommandsDesc& executeIndirectCommandsDesc) {
+    ((CommandBufferVal&)commandBuffer).ExecuteIndirectCommands(executeIndirectCommandsDesc);
+}
+
+Result DeviceVal::FillFunctionTable(DeviceGeneratedCommandsInterface& table) const {
+    if (!m_IsExtSupported.deviceGeneratedCommands)
+        return Result::UNSUPPORTED;
+
+    table.CreateIndirectCommandLayout = ::CreateIndirectCommandLayout;
+    table.CreateIndirectExecutionSet = ::CreateIndirectExecutionSet;
+    table.GetIndirectCommandsPreprocessBufferSize = ::GetIndirectCommandsPreprocessBufferSize;
+    table.UpdateIndirectExecutionSet = ::UpdateIndirectExecutionSet;
+    table.DestroyIndirectCommandLayout = ::DestroyIndirectCommandLayout;
+    table.DestroyIndirectExecutionSet = ::DestroyIndirectExecutionSet;
+    table.CmdExecuteIndirectCommands = ::CmdExecuteIndirectCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -796,11 +1103,78 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation
     return deviceVal.GetHelperInterfaceImpl().QueryVideoMemoryInfo(deviceVal.GetImpl(), memoryLocation, videoMemoryInfo);
 }
 
+struct CommandRecorderVal final : public ObjectVal {
+    inline CommandRecorderVal(DeviceVal& device, CommandRecorderImpl* impl)
+        : ObjectVal(device, (Object*)impl) {
+    }
+
+    inline CommandRecorderImpl* GetImpl() const {
+        return (CommandRecorderImpl*)m_Impl;
+    }
+};
+
+static Result NRI_CALL CreateCommandRecorder(Queue& queue, const CommandRecorderDesc& commandRecorderDesc, CommandRecorder*& commandRecorder) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::COMMAND);
+
+    DeviceVal& deviceVal = ((QueueVal&)queue).GetDevice();
+    NRI_RETURN_ON_FAILURE(&deviceVal, commandRecorderDesc.threadNum != 0, Result::INVALID_ARGUMENT, "'threadNum' is 0");
+    NRI_RETURN_ON_FAILURE(&deviceVal, commandRecorderDesc.queuedFrameNum != 0, Result::INVALID_ARGUMENT, "'queuedFrameNum' is 0");
+
+    // Built on top of the validation layer, i.e. acquired command buffers are "CommandBufferVal"
+    CommandRecorderImpl* impl = Allocate<CommandRecorderImpl>(deviceVal.GetAllocationCallbacks(), (Device&)deviceVal, deviceVal.GetCoreInterface(), queue);
+    Result result = impl->Create(commandRecorderDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        commandRecorder = nullptr;
+    } else
+        commandRecorder = (CommandRecorder*)Allocate<CommandRecorderVal>(deviceVal.GetAllocationCallbacks(), deviceVal, impl);
+
+    return result;
+}
+
+static void NRI_CALL DestroyCommandRecorder(CommandRecorder* commandRecorder) {
+    if (!commandRecorder)
+        return;
+
+    CommandRecorderVal* commandRecorderVal = (CommandRecorderVal*)commandRecorder;
+
+    Destroy(commandRecorderVal->GetImpl());
+    Destroy(commandRecorderVal);
+}
+
+static void NRI_CALL BeginCommandRecorderFrame(CommandRecorder& commandRecorder) {
+    ((CommandRecorderVal&)commandRecorder).GetImpl()->BeginFrame();
+}
+
+static Result NRI_CALL AcquireCommandBuffer(CommandRecorder& commandRecorder, uint32_t threadIndex, uint32_t sortKey, CommandBuffer*& commandBuffer) {
+    CommandRecorderVal& commandRecorderVal = (CommandRecorderVal&)commandRecorder;
+    CommandRecorderImpl* commandRecorderImpl = commandRecorderVal.GetImpl();
+
+    uint32_t threadNum = commandRecorderImpl->GetDesc().threadNum;
+    NRI_RETURN_ON_FAILURE(&commandRecorderVal.GetDevice(), threadIndex < threadNum, Result::INVALID_ARGUMENT, "'threadIndex = %u' is out of bounds ('threadNum = %u')", threadIndex, threadNum);
+
+    return commandRecorderImpl->AcquireCommandBuffer(threadIndex, sortKey, commandBuffer);
+}
+
+static Result NRI_CALL SubmitCommandRecorderFrame(CommandRecorder& commandRecorder, const QueueSubmitDesc& queueSubmitDesc) {
+    CommandRecorderVal& commandRecorderVal = (CommandRecorderVal&)commandRecorder;
+    NRI_RETURN_ON_FAILURE(&commandRecorderVal.GetDevice(), queueSubmitDesc.commandBufferNum == 0, Result::INVALID_ARGUMENT, "'commandBuffers' must be empty, acquired command buffers are submitted");
+
+    // "QueueSubmit" of the validation layer checks that all acquired command buffers are ended
+    return commandRecorderVal.GetImpl()->Submit(queueSubmitDesc);
+}
+
 Result DeviceVal::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.CreateCommandRecorder = ::CreateCommandRecorder;
+    table.DestroyCommandRecorder = ::DestroyCommandRecorder;
+    table.BeginCommandRecorderFrame = ::BeginCommandRecorderFrame;
+    table.AcquireCommandBuffer = ::AcquireCommandBuffer;
+    table.SubmitCommandRecorderFrame = ::SubmitCommandRecorderFrame;
 
     return Result::SUCCESS;
 }
@@ -823,6 +1197,8 @@ struct ImguiVal final : public ObjectVal {
 };
 
 static Result NRI_CALL CreateImgui(Device& device, const ImguiDesc& imguiDesc, Imgui*& imgui) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::IMGUI);
+
     DeviceVal& deviceVal = (DeviceVal&)device;
 
     ImguiImpl* impl = Allocate<ImguiImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
@@ -1197,6 +1573,8 @@ struct StreamerVal final : public ObjectVal {
 };
 
 static Result NRI_CALL CreateStreamer(Device& device, const StreamerDesc& streamerDesc, Streamer*& streamer) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::STREAMER);
+
     DeviceVal& deviceVal = (DeviceVal&)device;
 
     bool isUpload = streamerDesc.constantBufferMemoryLocation == MemoryLocation::HOST_UPLOAD || streamerDesc.constantBufferMemoryLocation == MemoryLocation::DEVICE_UPLOAD;
@@ -1372,6 +1750,8 @@ struct UpscalerVal final : public ObjectVal {
 };
 
 static Result NRI_CALL CreateUpscaler(Device& device, const UpscalerDesc& upscalerDesc, Upscaler*& upscaler) {
+    NRI_ALLOCATION_SCOPE(AllocationTag::UPSCALER);
+
     DeviceVal& deviceVal = (DeviceVal&)device;
 
     UpscalerImpl* impl = Allocate<UpscalerImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
@@ -1580,6 +1960,11 @@ static uint32_t NRI_CALL GetQueueFamilyIndexVK(const Queue& queue) {
     return queueVal.GetWrapperVKInterfaceImpl().GetQueueFamilyIndexVK(*queueVal.GetImpl());
 }
 
+static uint32_t NRI_CALL GetFilteredCommandNumVK(const CommandBuffer& commandBuffer) {
+    const CommandBufferVal& commandBufferVal = (CommandBufferVal&)commandBuffer;
+    return commandBufferVal.GetWrapperVKInterfaceImpl().GetFilteredCommandNumVK(*commandBufferVal.GetImpl());
+}
+
 static VKHandle NRI_CALL GetInstanceVK(const Device& device) {
     return ((DeviceVal&)device).GetWrapperVKInterfaceImpl().GetInstanceVK(((DeviceVal&)device).GetImpl());
 }
@@ -1611,6 +1996,7 @@ Result DeviceVal::FillFunctionTable(WrapperVKInterface& table) const {
     table.CreateAccelerationStructureVK = ::CreateAccelerationStructureVK;
     table.GetPhysicalDeviceVK = ::GetPhysicalDeviceVK;
     table.GetQueueFamilyIndexVK = ::GetQueueFamilyIndexVK;
+    table.GetFilteredCommandNumVK = ::GetFilteredCommandNumVK;
     table.GetInstanceVK = ::GetInstanceVK;
     table.GetDeviceProcAddrVK = ::GetDeviceProcAddrVK;
     table.GetInstanceProcAddrVK = ::GetInstanceProcAddrVK;
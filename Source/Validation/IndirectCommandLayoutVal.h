@@ -0,0 +1,32 @@
+// © 2021 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct IndirectCommandLayoutVal final : public ObjectVal {
+    IndirectCommandLayoutVal(DeviceVal& device, IndirectCommandLayout* indirectCommandLayout, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc);
+
+    inline IndirectCommandLayout* GetImpl() const {
+        return (IndirectCommandLayout*)m_Impl;
+    }
+
+    inline IndirectCommandType GetActionType() const {
+        return m_ActionType;
+    }
+
+    inline uint32_t GetStride() const {
+        return m_Stride;
+    }
+
+    inline bool HasExecutionSet() const {
+        return m_HasExecutionSet;
+    }
+
+private:
+    uint32_t m_Stride = 0;
+    IndirectCommandType m_ActionType = IndirectCommandType::MAX_NUM;
+    bool m_HasExecutionSet = false;
+};
+
+} // namespace nri
@@ -0,0 +1,11 @@
+// © 2021 NVIDIA Corporation
+
+IndirectCommandLayoutVal::IndirectCommandLayoutVal(DeviceVal& device, IndirectCommandLayout* indirectCommandLayout, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc)
+    : ObjectVal(device, indirectCommandLayout)
+    , m_Stride(indirectCommandLayoutDesc.stride) {
+    const IndirectCommandDesc* commands = indirectCommandLayoutDesc.commands;
+    uint32_t commandNum = indirectCommandLayoutDesc.commandNum;
+
+    m_ActionType = commands[commandNum - 1].type;
+    m_HasExecutionSet = commands[0].type == IndirectCommandType::EXECUTION_SET;
+}
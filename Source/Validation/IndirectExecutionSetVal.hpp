@@ -0,0 +1,17 @@
+// © 2021 NVIDIA Corporation
+
+NRI_INLINE void IndirectExecutionSetVal::Update(uint32_t baseIndex, const Pipeline* const* pipelines, uint32_t pipelineNum) {
+    NRI_RETURN_ON_FAILURE(&m_Device, pipelines, ReturnVoid(), "'pipelines' is NULL");
+    NRI_RETURN_ON_FAILURE(&m_Device, baseIndex + pipelineNum <= m_PipelineMaxNum, ReturnVoid(), "'baseIndex + pipelineNum = %u' is greater than 'pipelineMaxNum = %u'", baseIndex + pipelineNum, m_PipelineMaxNum);
+
+    Scratch<Pipeline*> pipelinesImpl = NRI_ALLOCATE_SCRATCH(m_Device, Pipeline*, pipelineNum);
+    for (uint32_t i = 0; i < pipelineNum; i++) {
+        const PipelineVal* pipelineVal = (const PipelineVal*)pipelines[i];
+        NRI_RETURN_ON_FAILURE(&m_Device, pipelineVal, ReturnVoid(), "'pipelines[%u]' is NULL", i);
+        NRI_RETURN_ON_FAILURE(&m_Device, pipelineVal->AllowsIndirectBinding(), ReturnVoid(), "'pipelines[%u]' must be created with 'allowIndirectBinding = true'", i);
+
+        pipelinesImpl[i] = pipelineVal->GetImpl();
+    }
+
+    GetDeviceGeneratedCommandsInterfaceImpl().UpdateIndirectExecutionSet(*GetImpl(), baseIndex, pipelinesImpl, pipelineNum);
+}
@@ -26,6 +26,10 @@ struct PipelineVal final : public ObjectVal {
         return m_WritesToStencil;
     }
 
+    inline bool AllowsIndirectBinding() const {
+        return m_AllowIndirectBinding;
+    }
+
     //================================================================================================================
     // NRI
     //================================================================================================================
@@ -36,6 +40,7 @@ private:
     const PipelineLayout* m_PipelineLayout = nullptr;
     bool m_WritesToDepth = false;
     bool m_WritesToStencil = false;
+    bool m_AllowIndirectBinding = false;
 };
 
 } // namespace nri
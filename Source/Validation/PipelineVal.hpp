@@ -9,11 +9,13 @@ PipelineVal::PipelineVal(DeviceVal& device, Pipeline* pipeline, const GraphicsPi
     , m_PipelineLayout(graphicsPipelineDesc.pipelineLayout) {
     m_WritesToDepth = graphicsPipelineDesc.outputMerger.depth.write;
     m_WritesToStencil = graphicsPipelineDesc.outputMerger.stencil.front.writeMask != 0 || graphicsPipelineDesc.outputMerger.stencil.back.writeMask != 0;
+    m_AllowIndirectBinding = graphicsPipelineDesc.allowIndirectBinding;
 }
 
 PipelineVal::PipelineVal(DeviceVal& device, Pipeline* pipeline, const ComputePipelineDesc& computePipelineDesc)
     : ObjectVal(device, pipeline)
-    , m_PipelineLayout(computePipelineDesc.pipelineLayout) {
+    , m_PipelineLayout(computePipelineDesc.pipelineLayout)
+    , m_AllowIndirectBinding(computePipelineDesc.allowIndirectBinding) {
 }
 
 PipelineVal::PipelineVal(DeviceVal& device, Pipeline* pipeline, const RayTracingPipelineDesc& rayTracingPipelineDesc)
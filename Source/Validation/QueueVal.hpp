@@ -23,8 +23,14 @@ NRI_INLINE Result QueueVal::Submit(const QueueSubmitDesc& queueSubmitDesc) {
     queueSubmitDescImpl.waitFences = waitFences;
 
     Scratch<CommandBuffer*> commandBuffers = NRI_ALLOCATE_SCRATCH(m_Device, CommandBuffer*, queueSubmitDesc.commandBufferNum);
-    for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++)
+    for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+        const CommandBufferVal* commandBufferVal = (CommandBufferVal*)queueSubmitDesc.commandBuffers[i];
+        NRI_RETURN_ON_FAILURE(&m_Device, !commandBufferVal->IsBundle(), Result::INVALID_ARGUMENT, "'commandBuffers[%u]' is a bundle, use 'CmdExecuteBundle'", i);
+        NRI_RETURN_ON_FAILURE(&m_Device, !commandBufferVal->IsRecording(), Result::INVALID_ARGUMENT, "'commandBuffers[%u]' is in the recording state", i);
+        NRI_RETURN_ON_FAILURE(&m_Device, !commandBufferVal->IsReRecordingNeeded(), Result::INVALID_ARGUMENT, "'commandBuffers[%u]' has already been submitted (re-record it or use 'CreateReusableCommandBuffer')", i);
+
         commandBuffers[i] = NRI_GET_IMPL(CommandBuffer, queueSubmitDesc.commandBuffers[i]);
+    }
     queueSubmitDescImpl.commandBuffers = commandBuffers;
 
     Scratch<FenceSubmitDesc> signalFences = NRI_ALLOCATE_SCRATCH(m_Device, FenceSubmitDesc, queueSubmitDesc.signalFenceNum);
@@ -36,7 +42,32 @@ NRI_INLINE Result QueueVal::Submit(const QueueSubmitDesc& queueSubmitDesc) {
 
     queueSubmitDescImpl.swapChain = NRI_GET_IMPL(SwapChain, queueSubmitDesc.swapChain);
 
-    return GetCoreInterfaceImpl().QueueSubmit(*GetImpl(), queueSubmitDescImpl);
+    Result result = GetCoreInterfaceImpl().QueueSubmit(*GetImpl(), queueSubmitDescImpl);
+    if (result == Result::SUCCESS) {
+        for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++)
+            ((CommandBufferVal*)queueSubmitDesc.commandBuffers[i])->OnSubmit();
+
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+        m_Device.MergeBarrierIssues(queueSubmitDesc.commandBuffers, queueSubmitDesc.commandBufferNum);
+#endif
+    }
+
+    // Remember the last submission using host-visible buffers (only signaled fences can be tracked)
+    if (result == Result::SUCCESS && queueSubmitDesc.signalFenceNum) {
+        const FenceSubmitDesc& fenceSubmitDesc = queueSubmitDesc.signalFences[queueSubmitDesc.signalFenceNum - 1];
+        FenceVal* fenceVal = (FenceVal*)fenceSubmitDesc.fence;
+
+        ExclusiveScope lock(m_Device.GetLock());
+
+        for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+            const CommandBufferVal& commandBufferVal = *(CommandBufferVal*)queueSubmitDesc.commandBuffers[i];
+
+            for (const BufferUsageVal& bufferUsage : commandBufferVal.GetBufferUsages())
+                bufferUsage.buffer->SetInFlight(fenceVal, fenceSubmitDesc.value, bufferUsage.offset, bufferUsage.size);
+        }
+    }
+
+    return result;
 }
 
 NRI_INLINE Result QueueVal::WaitIdle() {
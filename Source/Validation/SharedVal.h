@@ -4,6 +4,14 @@
 
 #include "SharedExternal.h"
 
+#if NRI_ENABLE_VALIDATION_PROFILING
+#    include <chrono>
+#endif
+
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+#    include <cstdarg> // va_start, va_end
+#endif
+
 #include "DeviceVal.h"
 
 #define NRI_OBJECT_SIGNATURE 0x1234567887654321ull // TODO: 32-bit platform support? not needed, I believe
@@ -35,6 +43,10 @@ struct ObjectVal : public DebugNameBaseVal {
         return m_Device.GetCoreInterfaceImpl();
     }
 
+    inline const DeviceGeneratedCommandsInterface& GetDeviceGeneratedCommandsInterfaceImpl() const {
+        return m_Device.GetDeviceGeneratedCommandsInterfaceImpl();
+    }
+
     inline const HelperInterface& GetHelperInterfaceImpl() const {
         return m_Device.GetHelperInterfaceImpl();
     }
@@ -99,6 +111,36 @@ inline DeviceVal& GetDeviceVal(T& object) {
     return ((ObjectVal&)object).GetDevice();
 }
 
+#if NRI_ENABLE_VALIDATION_PROFILING
+
+struct EntryPointScopeVal {
+    inline EntryPointScopeVal(DeviceVal& device, size_t index, const char* name)
+        : m_Device(device)
+        , m_Name(name)
+        , m_Index(index)
+        , m_Start(std::chrono::steady_clock::now()) {
+    }
+
+    inline ~EntryPointScopeVal() {
+        uint64_t timeNs = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Start).count();
+        m_Device.AddEntryPointStats(m_Index, m_Name, timeNs);
+    }
+
+private:
+    DeviceVal& m_Device;
+    const char* m_Name;
+    size_t m_Index;
+    std::chrono::steady_clock::time_point m_Start;
+};
+
+#    define NRI_PROFILE_ENTRY_POINT(device, entryPoint) EntryPointScopeVal _entryPointScope(device, offsetof(CoreInterface, entryPoint) / sizeof(void*), #entryPoint)
+
+#else
+
+#    define NRI_PROFILE_ENTRY_POINT(device, entryPoint)
+
+#endif
+
 uint64_t GetMemorySizeD3D12(const MemoryD3D12Desc& memoryD3D12Desc);
 
 constexpr std::array<const char*, (size_t)DescriptorType::MAX_NUM> g_descriptorTypeNames = {
@@ -120,6 +162,57 @@ constexpr const char* GetDescriptorTypeName(DescriptorType descriptorType) {
     return g_descriptorTypeNames[(uint32_t)descriptorType];
 }
 
+constexpr std::array<const char*, (size_t)Layout::MAX_NUM> g_layoutNames = {
+    "UNDEFINED",                            // UNDEFINED
+    "GENERAL",                              // GENERAL
+    "PRESENT",                              // PRESENT
+    "COLOR_ATTACHMENT",                     // COLOR_ATTACHMENT
+    "DEPTH_STENCIL_ATTACHMENT",             // DEPTH_STENCIL_ATTACHMENT
+    "DEPTH_READONLY_STENCIL_ATTACHMENT",    // DEPTH_READONLY_STENCIL_ATTACHMENT
+    "DEPTH_ATTACHMENT_STENCIL_READONLY",    // DEPTH_ATTACHMENT_STENCIL_READONLY
+    "DEPTH_STENCIL_READONLY",               // DEPTH_STENCIL_READONLY
+    "SHADING_RATE_ATTACHMENT",              // SHADING_RATE_ATTACHMENT
+    "INPUT_ATTACHMENT",                     // INPUT_ATTACHMENT
+    "SHADER_RESOURCE",                      // SHADER_RESOURCE
+    "SHADER_RESOURCE_STORAGE",              // SHADER_RESOURCE_STORAGE
+    "COPY_SOURCE",                          // COPY_SOURCE
+    "COPY_DESTINATION",                     // COPY_DESTINATION
+    "RESOLVE_SOURCE",                       // RESOLVE_SOURCE
+    "RESOLVE_DESTINATION",                  // RESOLVE_DESTINATION
+};
+NRI_VALIDATE_ARRAY_BY_PTR(g_layoutNames);
+
+constexpr const char* GetLayoutName(Layout layout) {
+    return g_layoutNames[(uint32_t)layout];
+}
+
+constexpr std::array<const char*, 23> g_stageNames = {
+    "INDEX_INPUT",                  // INDEX_INPUT
+    "VERTEX_SHADER",                // VERTEX_SHADER
+    "TESS_CONTROL_SHADER",          // TESS_CONTROL_SHADER
+    "TESS_EVALUATION_SHADER",       // TESS_EVALUATION_SHADER
+    "GEOMETRY_SHADER",              // GEOMETRY_SHADER
+    "TASK_SHADER",                  // TASK_SHADER
+    "MESH_SHADER",                  // MESH_SHADER
+    "FRAGMENT_SHADER",              // FRAGMENT_SHADER
+    "DEPTH_STENCIL_ATTACHMENT",     // DEPTH_STENCIL_ATTACHMENT
+    "COLOR_ATTACHMENT",             // COLOR_ATTACHMENT
+    "COMPUTE_SHADER",               // COMPUTE_SHADER
+    "RAYGEN_SHADER",                // RAYGEN_SHADER
+    "MISS_SHADER",                  // MISS_SHADER
+    "INTERSECTION_SHADER",          // INTERSECTION_SHADER
+    "CLOSEST_HIT_SHADER",           // CLOSEST_HIT_SHADER
+    "ANY_HIT_SHADER",               // ANY_HIT_SHADER
+    "CALLABLE_SHADER",              // CALLABLE_SHADER
+    "ACCELERATION_STRUCTURE",       // ACCELERATION_STRUCTURE
+    "MICROMAP",                     // MICROMAP
+    "COPY",                         // COPY
+    "RESOLVE",                      // RESOLVE
+    "CLEAR_STORAGE",                // CLEAR_STORAGE
+    "INDIRECT",                     // INDIRECT
+};
+NRI_VALIDATE_ARRAY_BY_PTR(g_stageNames);
+
 void ConvertBotomLevelGeometries(const BottomLevelGeometryDesc* geometries, uint32_t geometryNum, BottomLevelGeometryDesc*& outGeometries, BottomLevelMicromapDesc*& outMicromaps);
 QueryType GetQueryTypeVK(uint32_t queryTypeVK);
 
@@ -1,8 +1,13 @@
 // © 2021 NVIDIA Corporation
 
 SwapChainVal::~SwapChainVal() {
-    for (size_t i = 0; i < m_Textures.size(); i++)
+    for (size_t i = 0; i < m_Textures.size(); i++) {
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+        m_Device.ForgetBarrierIssues(m_Textures[i]);
+#endif
+
         Destroy(m_Textures[i]);
+    }
 }
 
 NRI_INLINE Texture* const* SwapChainVal::GetTextures(uint32_t& textureNum) {
@@ -36,6 +41,10 @@ NRI_INLINE Result SwapChainVal::WaitForPresent() {
 NRI_INLINE Result SwapChainVal::Present(Fence& releaseSemaphore) {
     Fence* renderingFinishedSemaphoreImpl = NRI_GET_IMPL(Fence, &releaseSemaphore);
 
+#if NRI_ENABLE_VALIDATION_BARRIER_ANALYZER
+    m_Device.ReportBarrierIssues();
+#endif
+
     return GetSwapChainInterfaceImpl().QueuePresent(*GetImpl(), *renderingFinishedSemaphoreImpl);
 }
 
@@ -271,6 +271,23 @@ static Result NRI_CALL CreateCommandBuffer(CommandAllocator&, CommandBuffer*& co
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL CreateReusableCommandBuffer(CommandAllocator&, const ReusableCommandBufferDesc&, CommandBuffer*& commandBuffer) {
+    commandBuffer = DummyObject<CommandBuffer>();
+
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL CreateCommandBuffers(CommandAllocator&, CommandBuffer** commandBuffers, uint32_t commandBufferNum) {
+    for (uint32_t i = 0; i < commandBufferNum; i++)
+        commandBuffers[i] = DummyObject<CommandBuffer>();
+
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL CreateCommandBundle(CommandAllocator&, const CommandBundleDesc&, CommandBuffer*&) {
+    return Result::UNSUPPORTED;
+}
+
 static Result NRI_CALL CreateFence(Device&, uint64_t, Fence*& fence) {
     fence = DummyObject<Fence>();
 
@@ -509,6 +526,12 @@ static void NRI_CALL CmdDraw(CommandBuffer&, const DrawDesc&) {
 static void NRI_CALL CmdDrawIndexed(CommandBuffer&, const DrawIndexedDesc&) {
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer&, const DrawDesc*, uint32_t) {
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer&, const DrawIndexedDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer&, const Buffer&, uint64_t, uint32_t, uint32_t, const Buffer*, uint64_t) {
 }
 
@@ -518,6 +541,9 @@ static void NRI_CALL CmdDrawIndexedIndirect(CommandBuffer&, const Buffer&, uint6
 static void NRI_CALL CmdEndRendering(CommandBuffer&) {
 }
 
+static void NRI_CALL CmdExecuteBundle(CommandBuffer&, const CommandBuffer&) {
+}
+
 static void NRI_CALL CmdDispatch(CommandBuffer&, const DispatchDesc&) {
 }
 
@@ -657,6 +683,9 @@ Result DeviceWebGPU::FillFunctionTable(CoreInterface& table) const {
     table.GetQueue = ::GetQueue;
     table.CreateCommandAllocator = ::CreateCommandAllocator;
     table.CreateCommandBuffer = ::CreateCommandBuffer;
+    table.CreateCommandBundle = ::CreateCommandBundle;
+    table.CreateReusableCommandBuffer = ::CreateReusableCommandBuffer;
+    table.CreateCommandBuffers = ::CreateCommandBuffers;
     table.CreateDescriptorPool = ::CreateDescriptorPool;
     table.CreateBufferView = ::CreateBufferView;
     table.CreateTextureView = ::CreateTextureView;
@@ -716,9 +745,12 @@ Result DeviceWebGPU::FillFunctionTable(CoreInterface& table) const {
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
+    table.CmdExecuteBundle = ::CmdExecuteBundle;
     table.CmdDispatch = ::CmdDispatch;
     table.CmdDispatchIndirect = ::CmdDispatchIndirect;
     table.CmdCopyBuffer = ::CmdCopyBuffer;
@@ -782,11 +814,38 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device&, MemoryLocation, Video
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL CreateCommandRecorder(Queue&, const CommandRecorderDesc&, CommandRecorder*& commandRecorder) {
+    commandRecorder = DummyObject<CommandRecorder>();
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyCommandRecorder(CommandRecorder*) {
+}
+
+static void NRI_CALL BeginCommandRecorderFrame(CommandRecorder&) {
+}
+
+static Result NRI_CALL AcquireCommandBuffer(CommandRecorder&, uint32_t, uint32_t, CommandBuffer*& commandBuffer) {
+    commandBuffer = DummyObject<CommandBuffer>();
+
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL SubmitCommandRecorderFrame(CommandRecorder&, const QueueSubmitDesc&) {
+    return Result::SUCCESS;
+}
+
 Result DeviceWebGPU::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.CreateCommandRecorder = ::CreateCommandRecorder;
+    table.DestroyCommandRecorder = ::DestroyCommandRecorder;
+    table.BeginCommandRecorderFrame = ::BeginCommandRecorderFrame;
+    table.AcquireCommandBuffer = ::AcquireCommandBuffer;
+    table.SubmitCommandRecorderFrame = ::SubmitCommandRecorderFrame;
 
     return Result::SUCCESS;
 }
@@ -0,0 +1,639 @@
+// © 2021 NVIDIA Corporation
+
+// Replays a capture made with "DeviceCreationDesc::captureFileName" on any backend. Object IDs are remapped to new objects,
+// calls referencing objects, which failed to (re)create on the target backend, are skipped and reported.
+// Usage: NRI_Replay <file> [--api NONE|VK|D3D11|D3D12] [--validation] [--max-speed] [--repeat N]
+// "--max-speed" drops per entry point accounting and reports the replay rate of each pass (device creation is not timed)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "NRI.h"
+
+#include "Extensions/NRIDeviceCreation.h"
+#include "Extensions/NRIHelper.h"
+#include "Extensions/NRIStreamer.h"
+
+#include "StreamCapture.h"
+
+using namespace nri;
+
+constexpr size_t ARENA_CHUNK_SIZE = 1024 * 1024;
+constexpr size_t SLOT_MAX_NUM = 256;
+
+static uint32_t g_ErrorNum = 0;
+
+static void NRI_CALL MessageCallback(Message messageType, const char* file, uint32_t line, const char* message, void*) {
+    if (messageType != Message::ERROR)
+        return;
+
+    // Report a few, but keep going: a failed call only makes dependent calls skipped
+    if (g_ErrorNum++ < 8)
+        fprintf(stderr, "ERROR: %s (%s:%u)\n", message, file, line);
+}
+
+static void NRI_CALL AbortExecution(void*) {
+}
+
+// Per record scratch memory for deserialized structs, arrays and blobs
+struct Arena {
+    void* Allocate(size_t size) {
+        size = (size + 15) & ~size_t(15);
+
+        if (chunks.empty() || offset + size > capacity) {
+            capacity = std::max(size, ARENA_CHUNK_SIZE);
+            chunks.emplace_back(new uint8_t[capacity]);
+            offset = 0;
+        }
+
+        void* memory = chunks.back().get() + offset;
+        offset += size;
+
+        return memory;
+    }
+
+    void Reset() {
+        // Keep the last (biggest recently used) chunk
+        if (chunks.size() > 1)
+            chunks.erase(chunks.begin(), chunks.end() - 1);
+
+        offset = 0;
+    }
+
+    std::vector<std::unique_ptr<uint8_t[]>> chunks;
+    size_t capacity = 0;
+    size_t offset = 0;
+};
+
+struct MappedBuffer {
+    uint8_t* base;
+    uint32_t mapNum;
+};
+
+struct Replayer;
+typedef void (*ReplayFunc)(Replayer& replayer);
+
+static ReplayFunc g_ReplayFuncs[(size_t)CaptureInterface::SPECIAL][SLOT_MAX_NUM];
+static const char* g_ReplayNames[(size_t)CaptureInterface::SPECIAL][SLOT_MAX_NUM];
+
+struct Replayer {
+    static constexpr bool IS_READER = true;
+
+    //================================================================================================================
+    // Archive
+    //================================================================================================================
+
+    inline void Bytes(void* data, size_t size) {
+        if (size > size_t(recordEnd - cur)) {
+            memset(data, 0, size);
+            isCorrupted = true;
+            cur = recordEnd;
+        } else {
+            memcpy(data, cur, size);
+            cur += size;
+        }
+    }
+
+    template <typename T>
+    inline void Device(T*& object) {
+        object = device;
+    }
+
+    template <typename T>
+    inline void Object(T*& object) {
+        uint32_t id = 0;
+        Bytes(&id, sizeof(id));
+
+        lastObjectId = id;
+        object = (T*)Resolve(id);
+    }
+
+    template <typename T>
+    inline void Objects(T* const*& objects, uint64_t num) {
+        T** items = num ? (T**)arena.Allocate(sizeof(T*) * num) : nullptr;
+        for (uint64_t i = 0; i < num; i++)
+            Object(items[i]);
+
+        objects = items;
+    }
+
+    template <typename T>
+    inline void OutObject(T*& object) {
+        uint32_t id = 0;
+        Bytes(&id, sizeof(id));
+
+        object = nullptr;
+        if (id)
+            pendingObjects.push_back({id, (void**)&object});
+    }
+
+    template <typename T>
+    inline void OutObjects(T**& objects, uint64_t num) {
+        objects = num ? (T**)arena.Allocate(sizeof(T*) * num) : nullptr;
+        for (uint64_t i = 0; i < num; i++)
+            OutObject(objects[i]);
+    }
+
+    template <typename T>
+    inline void Array(const T*& items, uint64_t num) {
+        T* dst = nullptr;
+        if (num) {
+            dst = (T*)arena.Allocate(sizeof(T) * num);
+            Bytes(dst, sizeof(T) * num);
+        }
+
+        for (uint64_t i = 0; i < num; i++)
+            Fixup(*this, dst[i]);
+
+        items = dst;
+    }
+
+    template <typename T>
+    inline void Optional(const T*& item) {
+        uint8_t isPresent = 0;
+        Bytes(&isPresent, sizeof(isPresent));
+
+        T* dst = nullptr;
+        if (isPresent) {
+            dst = (T*)arena.Allocate(sizeof(T));
+            Transfer(*this, *dst);
+        }
+
+        item = dst;
+    }
+
+    // Copied, because of alignment requirements (SPIRV, root constants)
+    inline void Blob(const void*& data, uint64_t) {
+        uint64_t size = 0;
+        Bytes(&size, sizeof(size));
+
+        void* dst = nullptr;
+        if (size && size <= uint64_t(recordEnd - cur)) {
+            dst = arena.Allocate((size_t)size);
+            Bytes(dst, (size_t)size);
+        } else if (size)
+            isCorrupted = true;
+
+        data = dst;
+    }
+
+    inline void String(const char*& string) {
+        uint32_t size = 0;
+        Bytes(&size, sizeof(size));
+
+        char* dst = nullptr;
+        if (size && size <= uint64_t(recordEnd - cur)) {
+            dst = (char*)arena.Allocate(size);
+            Bytes(dst, size);
+            dst[size - 1] = '\0';
+        } else if (size)
+            isCorrupted = true;
+
+        string = dst;
+    }
+
+    //================================================================================================================
+    // Calls
+    //================================================================================================================
+
+    template <typename Interface>
+    inline const Interface& GetInterface() const {
+        if constexpr (std::is_same_v<Interface, CoreInterface>)
+            return iCore;
+        else if constexpr (std::is_same_v<Interface, HelperInterface>)
+            return iHelper;
+        else
+            return iStreamer;
+    }
+
+    inline void* Resolve(uint32_t id) {
+        if (!id)
+            return nullptr;
+
+        if (id >= objects.size() || !objects[id]) {
+            isUnresolved = true;
+            return nullptr;
+        }
+
+        return objects[id];
+    }
+
+    inline bool BeginCall() {
+        if (isUnresolved || isCorrupted) {
+            EndCall(false);
+            return false;
+        }
+
+        return true;
+    }
+
+    inline void EndCall(bool isSucceeded) {
+        for (const auto& pendingObject : pendingObjects) {
+            if (pendingObject.first >= objects.size())
+                objects.resize(pendingObject.first + 1, nullptr);
+
+            objects[pendingObject.first] = isSucceeded ? *pendingObject.second : nullptr;
+        }
+
+        pendingObjects.clear();
+    }
+
+    inline void ReleaseObject() {
+        if (lastObjectId < objects.size())
+            objects[lastObjectId] = nullptr;
+
+        if (lastObjectId < mappedBuffers.size())
+            mappedBuffers[lastObjectId] = {};
+    }
+
+    inline void OnMapBuffer(uint64_t offset, void* data) {
+        if (!data)
+            return;
+
+        if (lastObjectId >= mappedBuffers.size())
+            mappedBuffers.resize(lastObjectId + 1, {});
+
+        MappedBuffer& mappedBuffer = mappedBuffers[lastObjectId];
+        mappedBuffer.base = (uint8_t*)data - offset;
+        mappedBuffer.mapNum++;
+    }
+
+    inline void OnUnmapBuffer() {
+        if (lastObjectId < mappedBuffers.size() && mappedBuffers[lastObjectId].mapNum) {
+            MappedBuffer& mappedBuffer = mappedBuffers[lastObjectId];
+            if (--mappedBuffer.mapNum == 0)
+                mappedBuffer.base = nullptr;
+        }
+    }
+
+    void ExecuteSpecial(CaptureSpecial special) {
+        uint32_t id = 0;
+
+        if (special == CaptureSpecial::BUFFER_DATA) {
+            CaptureBufferData bufferData = {};
+            Bytes(&bufferData, sizeof(bufferData));
+
+            Buffer* buffer = (Buffer*)Resolve(bufferData.id);
+            if (!buffer || isCorrupted || bufferData.size > uint64_t(recordEnd - cur)) {
+                skippedNum++;
+                return;
+            }
+
+            // Into the memory mapped by a replayed "MapBuffer" or via a temporary mapping
+            uint8_t* base = bufferData.id < mappedBuffers.size() ? mappedBuffers[bufferData.id].base : nullptr;
+            if (base)
+                memcpy(base + bufferData.offset, cur, (size_t)bufferData.size);
+            else {
+                void* data = iCore.MapBuffer(*buffer, bufferData.offset, bufferData.size);
+                if (data) {
+                    memcpy(data, cur, (size_t)bufferData.size);
+                    iCore.UnmapBuffer(*buffer);
+                } else
+                    skippedNum++;
+            }
+        } else if (special == CaptureSpecial::EXTERNAL_BUFFER) {
+            BufferDesc bufferDesc = {};
+            Bytes(&id, sizeof(id));
+            Bytes(&bufferDesc, sizeof(bufferDesc));
+
+            Buffer* buffer = nullptr;
+            if (!isCorrupted)
+                iCore.CreateCommittedBuffer(*device, MemoryLocation::DEVICE, 0.0f, bufferDesc, buffer);
+
+            pendingObjects.push_back({id, (void**)&buffer});
+            EndCall(buffer != nullptr);
+
+            if (buffer)
+                externalBuffers.push_back(buffer);
+        } else if (special == CaptureSpecial::EXTERNAL_TEXTURE) {
+            TextureDesc textureDesc = {};
+            Bytes(&id, sizeof(id));
+            Bytes(&textureDesc, sizeof(textureDesc));
+
+            Texture* texture = nullptr;
+            if (!isCorrupted)
+                iCore.CreateCommittedTexture(*device, MemoryLocation::DEVICE, 0.0f, textureDesc, texture);
+
+            pendingObjects.push_back({id, (void**)&texture});
+            EndCall(texture != nullptr);
+
+            if (texture)
+                externalTextures.push_back(texture);
+        } else
+            skippedNum++;
+    }
+
+    bool Run(const uint8_t* begin, const uint8_t* end) {
+        cur = begin;
+
+        while (cur < end) {
+            CaptureRecordHeader recordHeader = {};
+            if (size_t(end - cur) < sizeof(recordHeader))
+                return false;
+
+            memcpy(&recordHeader, cur, sizeof(recordHeader));
+            cur += sizeof(recordHeader);
+
+            if (recordHeader.size > size_t(end - cur))
+                return false;
+
+            recordEnd = cur + recordHeader.size;
+            isUnresolved = false;
+            isCorrupted = false;
+
+            if (recordHeader.interfaceIndex == CaptureInterface::SPECIAL)
+                ExecuteSpecial((CaptureSpecial)recordHeader.slot);
+            else if (recordHeader.interfaceIndex < CaptureInterface::SPECIAL) {
+                size_t interfaceIndex = (size_t)recordHeader.interfaceIndex;
+                ReplayFunc replayFunc = g_ReplayFuncs[interfaceIndex][recordHeader.slot];
+
+                if (replayFunc) {
+                    replayFunc(*this);
+                    callNum++;
+
+                    if (isUnresolved || isCorrupted) {
+                        skippedNum++;
+
+                        if (skippedCalls)
+                            skippedCalls[interfaceIndex * SLOT_MAX_NUM + recordHeader.slot]++;
+                    }
+                } else
+                    skippedNum++;
+            } else
+                skippedNum++;
+
+            cur = recordEnd;
+            arena.Reset();
+        }
+
+        return true;
+    }
+
+    void Destroy() {
+        for (Texture* texture : externalTextures)
+            iCore.DestroyTexture(texture);
+
+        for (Buffer* buffer : externalBuffers)
+            iCore.DestroyBuffer(buffer);
+
+        nriDestroyDevice(device);
+    }
+
+    CoreInterface iCore = {};
+    HelperInterface iHelper = {};
+    StreamerInterface iStreamer = {};
+    Arena arena;
+    std::vector<void*> objects;
+    std::vector<MappedBuffer> mappedBuffers;
+    std::vector<std::pair<uint32_t, void**>> pendingObjects;
+    std::vector<Buffer*> externalBuffers;
+    std::vector<Texture*> externalTextures;
+    nri::Device* device = nullptr;
+    uint32_t* skippedCalls = nullptr; // optional, per entry point
+    const uint8_t* cur = nullptr;
+    const uint8_t* recordEnd = nullptr;
+    uint64_t callNum = 0;
+    uint64_t skippedNum = 0;
+    uint32_t lastObjectId = 0;
+    bool isUnresolved = false;
+    bool isCorrupted = false;
+};
+
+template <auto Member>
+struct ReplayThunk;
+
+template <typename Interface, typename R, typename... Args, R (NRI_CALL* Interface::*Member)(Args...)>
+struct ReplayThunk<Member> {
+    using Call = CaptureCall<decltype(Member)>;
+
+    static void Execute(Replayer& replayer) {
+        typename Call::Storage storage = {};
+        TransferArgs<Args...>(replayer, storage, std::index_sequence_for<Args...>{});
+
+        Invoke(replayer, storage, std::index_sequence_for<Args...>{});
+    }
+
+    template <size_t... Is>
+    static void Invoke(Replayer& replayer, typename Call::Storage& storage, std::index_sequence<Is...>) {
+        const Interface& iface = replayer.GetInterface<Interface>();
+
+        if constexpr (std::is_void_v<R> || std::is_reference_v<R>) {
+            if (!replayer.BeginCall())
+                return;
+
+            (iface.*Member)(FromCaptureStorage<Args>(std::get<Is>(storage))...);
+        } else {
+            R result = {};
+            TransferResult(replayer, result);
+
+            if (!replayer.BeginCall())
+                return;
+
+            result = (iface.*Member)(FromCaptureStorage<Args>(std::get<Is>(storage))...);
+
+            if constexpr (IsSameMember<Member, &CoreInterface::MapBuffer>::value)
+                replayer.OnMapBuffer(std::get<1>(storage), result);
+        }
+
+        if constexpr (IsSameMember<Member, &CoreInterface::UnmapBuffer>::value)
+            replayer.OnUnmapBuffer();
+
+        if constexpr (Call::IsDestroy())
+            replayer.ReleaseObject();
+
+        replayer.EndCall(true);
+    }
+};
+
+static void ReplayAllocateAndBindMemory(Replayer& replayer) {
+    ResourceGroupDesc resourceGroupDesc = {};
+    Memory** allocations = nullptr;
+    uint32_t allocationNum = 0;
+    TransferAllocateAndBindMemory(replayer, resourceGroupDesc, allocations, allocationNum);
+
+    if (!replayer.BeginCall())
+        return;
+
+    // The number of allocations can differ on another backend, only captured ones are remapped
+    uint32_t replayAllocationNum = replayer.iHelper.CalculateAllocationNumber(*replayer.device, resourceGroupDesc);
+    std::vector<Memory*> replayAllocations(std::max(replayAllocationNum, allocationNum), nullptr);
+
+    Result result = replayer.iHelper.AllocateAndBindMemory(*replayer.device, resourceGroupDesc, replayAllocations.data());
+    for (uint32_t i = 0; i < allocationNum; i++)
+        allocations[i] = replayAllocations[i];
+
+    replayer.EndCall(result == Result::SUCCESS);
+}
+
+static void RegisterReplayFuncs() {
+#define NRI_REPLAY_REGISTER(interface, name) \
+    g_ReplayFuncs[(size_t)GetCaptureInterface<interface>()][NRI_CAPTURE_SLOT(interface, name)] = ReplayThunk<&interface::name>::Execute; \
+    g_ReplayNames[(size_t)GetCaptureInterface<interface>()][NRI_CAPTURE_SLOT(interface, name)] = #name;
+
+    NRI_CAPTURE_CORE_CALLS(NRI_REPLAY_REGISTER)
+    NRI_CAPTURE_HELPER_CALLS(NRI_REPLAY_REGISTER)
+    NRI_CAPTURE_STREAMER_CALLS(NRI_REPLAY_REGISTER)
+
+#undef NRI_REPLAY_REGISTER
+
+    g_ReplayFuncs[(size_t)CaptureInterface::HELPER][NRI_CAPTURE_SLOT(HelperInterface, AllocateAndBindMemory)] = ReplayAllocateAndBindMemory;
+    g_ReplayNames[(size_t)CaptureInterface::HELPER][NRI_CAPTURE_SLOT(HelperInterface, AllocateAndBindMemory)] = "AllocateAndBindMemory";
+}
+
+static bool CreateReplayer(const CaptureHeader& header, GraphicsAPI graphicsAPI, bool enableValidation, Replayer& replayer) {
+    QueueFamilyDesc queueFamilies[(size_t)QueueType::MAX_NUM] = {};
+    uint32_t queueFamilyNum = 0;
+    for (uint32_t i = 0; i < (uint32_t)QueueType::MAX_NUM; i++) {
+        if (header.queueNum[i]) {
+            QueueFamilyDesc& queueFamily = queueFamilies[queueFamilyNum++];
+            queueFamily.queueNum = header.queueNum[i];
+            queueFamily.queueType = (QueueType)i;
+        }
+    }
+
+    DeviceCreationDesc deviceCreationDesc = {};
+    deviceCreationDesc.graphicsAPI = graphicsAPI;
+    deviceCreationDesc.queueFamilies = queueFamilies;
+    deviceCreationDesc.queueFamilyNum = queueFamilyNum;
+    deviceCreationDesc.callbackInterface.MessageCallback = MessageCallback;
+    deviceCreationDesc.callbackInterface.AbortExecution = AbortExecution;
+    deviceCreationDesc.enableNRIValidation = enableValidation;
+    deviceCreationDesc.enableNONEHostEmulation = graphicsAPI == GraphicsAPI::NONE;
+
+    if (nriCreateDevice(deviceCreationDesc, replayer.device) != Result::SUCCESS)
+        return false;
+
+    bool isOk = nriGetInterface(*replayer.device, NRI_INTERFACE(CoreInterface), &replayer.iCore) == Result::SUCCESS;
+    isOk = isOk && nriGetInterface(*replayer.device, NRI_INTERFACE(HelperInterface), &replayer.iHelper) == Result::SUCCESS;
+    nriGetInterface(*replayer.device, NRI_INTERFACE(StreamerInterface), &replayer.iStreamer); // optional
+
+    if (!isOk) {
+        nriDestroyDevice(replayer.device);
+        return false;
+    }
+
+    replayer.objects.resize(CAPTURE_DEVICE_ID + 1, nullptr);
+    replayer.objects[CAPTURE_DEVICE_ID] = replayer.device;
+
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* fileName = nullptr;
+    const char* apiName = nullptr;
+    bool enableValidation = false;
+    bool isMaxSpeed = false;
+    uint32_t repeatNum = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--api") && i + 1 < argc)
+            apiName = argv[++i];
+        else if (!strcmp(argv[i], "--validation"))
+            enableValidation = true;
+        else if (!strcmp(argv[i], "--max-speed"))
+            isMaxSpeed = true;
+        else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+            repeatNum = std::max(atoi(argv[++i]), 1);
+        else
+            fileName = argv[i];
+    }
+
+    if (!fileName) {
+        printf("Usage: NRI_Replay <file> [--api NONE|VK|D3D11|D3D12] [--validation] [--max-speed] [--repeat N]\n");
+        return 1;
+    }
+
+    // Load
+    FILE* file = fopen(fileName, "rb");
+    if (!file) {
+        printf("Can't open '%s'\n", fileName);
+        return 1;
+    }
+
+    std::vector<uint8_t> data;
+    uint8_t buf[64 * 1024];
+    size_t readSize = 0;
+    while ((readSize = fread(buf, 1, sizeof(buf), file)) != 0)
+        data.insert(data.end(), buf, buf + readSize);
+
+    fclose(file);
+
+    CaptureHeader header = {};
+    if (data.size() < sizeof(header)) {
+        printf("'%s' is not a capture\n", fileName);
+        return 1;
+    }
+
+    memcpy(&header, data.data(), sizeof(header));
+    if (header.magic != CAPTURE_MAGIC || header.version != CAPTURE_VERSION) {
+        printf("'%s' is not a capture or has an unsupported version\n", fileName);
+        return 1;
+    }
+
+    GraphicsAPI graphicsAPI = header.graphicsAPI;
+    if (apiName) {
+        const std::pair<const char*, GraphicsAPI> apis[] = {
+            {"NONE", GraphicsAPI::NONE},
+            {"D3D11", GraphicsAPI::D3D11},
+            {"D3D12", GraphicsAPI::D3D12},
+            {"VK", GraphicsAPI::VK},
+        };
+
+        const auto& it = std::find_if(std::begin(apis), std::end(apis), [&](const auto& api) { return !strcmp(api.first, apiName); });
+        if (it == std::end(apis)) {
+            printf("Unknown API '%s'\n", apiName);
+            return 1;
+        }
+
+        graphicsAPI = it->second;
+    }
+
+    // Replay
+    RegisterReplayFuncs();
+
+    std::vector<uint32_t> skippedCalls((size_t)CaptureInterface::SPECIAL * SLOT_MAX_NUM, 0);
+    const uint8_t* begin = data.data() + sizeof(header);
+    const uint8_t* end = data.data() + data.size();
+    bool isComplete = true;
+    uint64_t skippedNum = 0;
+
+    for (uint32_t pass = 0; pass < repeatNum; pass++) {
+        Replayer replayer;
+        if (!CreateReplayer(header, graphicsAPI, enableValidation, replayer)) {
+            printf("Can't create a device\n");
+            return 1;
+        }
+
+        if (!isMaxSpeed)
+            replayer.skippedCalls = skippedCalls.data();
+
+        auto start = std::chrono::steady_clock::now();
+        isComplete = replayer.Run(begin, end) && isComplete;
+        auto finish = std::chrono::steady_clock::now();
+
+        replayer.Destroy();
+
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        skippedNum = replayer.skippedNum;
+
+        if (isMaxSpeed)
+            printf("Pass %u: %llu calls in %.3f ms (%.0f calls/s, %.1f ns/call)\n", pass, (unsigned long long)replayer.callNum, ns / 1000000.0, replayer.callNum * 1000000000.0 / std::max(ns, 1.0), ns / std::max(replayer.callNum, (uint64_t)1));
+        else
+            printf("Pass %u: %llu calls, %llu skipped\n", pass, (unsigned long long)replayer.callNum, (unsigned long long)replayer.skippedNum);
+    }
+
+    for (size_t i = 0; i < skippedCalls.size(); i++) {
+        if (skippedCalls[i])
+            printf("  %-40s %u skipped\n", g_ReplayNames[i / SLOT_MAX_NUM][i % SLOT_MAX_NUM], skippedCalls[i]);
+    }
+
+    if (!isComplete)
+        printf("The capture is truncated\n");
+
+    return (isComplete && !skippedNum && !g_ErrorNum) ? 0 : 1;
+}